@@ -47,6 +47,10 @@
 #   error "Unsupported platform detected"
 #endif
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /* ============================================================================================== */
 /* Enums and types                                                                                */
 /* ============================================================================================== */
@@ -103,10 +107,99 @@ ZYCORE_EXPORT ZyanU32 ZyanMemoryGetSystemPageSize();
  */
 ZYCORE_EXPORT ZyanU32 ZyanMemoryGetSystemAllocationGranularity();
 
+/**
+ * Returns the system huge page size.
+ *
+ * Huge pages (called large pages on Windows) reduce the number of TLB misses for large memory
+ * regions. The value is typically 2MiB on x86 systems. It is queried once and cached for
+ * subsequent calls.
+ *
+ * @return  The system huge page size or `0`, if huge pages are not supported.
+ */
+ZYCORE_EXPORT ZyanU32 ZyanMemoryGetSystemHugePageSize();
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Memory management                                                                              */
 /* ---------------------------------------------------------------------------------------------- */
 
+/**
+ * Reserves and commits one or more memory pages.
+ *
+ * @param   address     Receives the start address of the allocated memory region.
+ * @param   size        The size.
+ * @param   protection  The page protection value.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory region is aligned to a page boundary and has to be released by calling
+ * `ZyanMemoryVirtualFree`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualAlloc(void** address, ZyanUSize size,
+    ZyanMemoryPageProtection protection);
+
+/**
+ * Reserves and commits one or more memory pages and requests them to be backed by huge pages.
+ *
+ * @param   address     Receives the start address of the allocated memory region.
+ * @param   size        The size. Must be a multiple of the system huge page size.
+ * @param   protection  The page protection value.
+ * @param   page_size   Receives the page size that backs the memory region. This parameter is
+ *                      optional and might be `ZYAN_NULL`.
+ *
+ * @return  A zyan status code.
+ *
+ * On Linux, explicit huge pages (`MAP_HUGETLB`) are tried first. If no huge pages are available,
+ * the function falls back to a huge page aligned region that is advised to be backed by
+ * transparent huge pages (`MADV_HUGEPAGE`). Windows requires the `SeLockMemoryPrivilege`
+ * privilege to allocate large pages.
+ *
+ * If huge pages are not available at all, regular pages are allocated and `page_size` receives
+ * the system page size.
+ *
+ * The memory region has to be released by calling `ZyanMemoryVirtualFree`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualAllocHuge(void** address, ZyanUSize size,
+    ZyanMemoryPageProtection protection, ZyanU32* page_size);
+
+/**
+ * Reserves a range of the virtual address space without committing any physical memory.
+ *
+ * @param   address Receives the start address of the reserved memory region.
+ * @param   size    The size.
+ *
+ * @return  A zyan status code.
+ *
+ * Reserved pages are inaccessible until they are committed by `ZyanMemoryVirtualCommit`. The
+ * memory region has to be released by calling `ZyanMemoryVirtualFree`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualReserve(void** address, ZyanUSize size);
+
+/**
+ * Commits one or more previously reserved memory pages.
+ *
+ * @param   address     The start address aligned to a page boundary.
+ * @param   size        The size.
+ * @param   protection  The page protection value.
+ *
+ * @return  A zyan status code.
+ *
+ * Committed pages are zero-initialized on first access.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualCommit(void* address, ZyanUSize size,
+    ZyanMemoryPageProtection protection);
+
+/**
+ * Decommits one or more memory pages while keeping the address range reserved.
+ *
+ * @param   address The start address aligned to a page boundary.
+ * @param   size    The size.
+ *
+ * @return  A zyan status code.
+ *
+ * The contents of the decommitted pages are discarded.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualDecommit(void* address, ZyanUSize size);
+
 /**
  * Changes the memory protection value of one or more pages.
  *
@@ -133,6 +226,10 @@ ZYCORE_EXPORT ZyanStatus ZyanMemoryVirtualFree(void* address, ZyanUSize size);
 
 /* ============================================================================================== */
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* ZYAN_NO_LIBC */
 
 #endif /* ZYCORE_API_MEMORY_H */
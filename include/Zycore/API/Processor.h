@@ -0,0 +1,125 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief
+ */
+
+#ifndef ZYCORE_API_PROCESSOR_H
+#define ZYCORE_API_PROCESSOR_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Defines.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanProcessorFeature` enum.
+ */
+typedef enum ZyanProcessorFeature_
+{
+    /**
+     * SSE2 instructions.
+     */
+    ZYAN_PROCESSOR_FEATURE_SSE2,
+    /**
+     * SSE3 instructions.
+     */
+    ZYAN_PROCESSOR_FEATURE_SSE3,
+    /**
+     * Supplemental SSE3 instructions.
+     */
+    ZYAN_PROCESSOR_FEATURE_SSSE3,
+    /**
+     * SSE4.1 instructions.
+     */
+    ZYAN_PROCESSOR_FEATURE_SSE41,
+    /**
+     * SSE4.2 instructions.
+     */
+    ZYAN_PROCESSOR_FEATURE_SSE42,
+    /**
+     * The `POPCNT` instruction.
+     */
+    ZYAN_PROCESSOR_FEATURE_POPCNT,
+    /**
+     * AVX instructions (supported by the processor and enabled by the operating system).
+     */
+    ZYAN_PROCESSOR_FEATURE_AVX,
+    /**
+     * AVX2 instructions (supported by the processor and enabled by the operating system).
+     */
+    ZYAN_PROCESSOR_FEATURE_AVX2,
+    /**
+     * BMI1 instructions.
+     */
+    ZYAN_PROCESSOR_FEATURE_BMI1,
+    /**
+     * BMI2 instructions.
+     */
+    ZYAN_PROCESSOR_FEATURE_BMI2
+} ZyanProcessorFeature;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* General                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Checks, if the processor the code is running on supports the given `feature`.
+ *
+ * @param   feature The processor feature.
+ *
+ * @return  `ZYAN_TRUE`, if the feature is supported or `ZYAN_FALSE`, if not.
+ *
+ * The features are detected using the `cpuid` instruction when this function is called for the
+ * first time. Instruction set extensions that require operating system support (like AVX) are
+ * only reported, if the operating system saves the corresponding register state.
+ *
+ * This function always returns `ZYAN_FALSE` on non-x86 platforms.
+ */
+ZYCORE_EXPORT ZyanBool ZyanProcessorHasFeature(ZyanProcessorFeature feature);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_API_PROCESSOR_H */
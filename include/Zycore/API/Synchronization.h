@@ -56,6 +56,18 @@ extern "C" {
 
 typedef pthread_mutex_t ZyanCriticalSection;
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Condition Variable                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+typedef pthread_cond_t ZyanConditionVariable;
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Read-Write Lock                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+typedef pthread_rwlock_t ZyanReadWriteLock;
+
 /* ---------------------------------------------------------------------------------------------- */
 
 #elif defined(ZYAN_WINDOWS)
@@ -68,6 +80,18 @@ typedef pthread_mutex_t ZyanCriticalSection;
 
 typedef CRITICAL_SECTION ZyanCriticalSection;
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Condition Variable                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+typedef CONDITION_VARIABLE ZyanConditionVariable;
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Read-Write Lock                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+typedef SRWLOCK ZyanReadWriteLock;
+
 /* ---------------------------------------------------------------------------------------------- */
 
 #else
@@ -120,6 +144,101 @@ ZYCORE_EXPORT ZyanStatus ZyanCriticalSectionLeave(ZyanCriticalSection* critical_
  */
 ZYCORE_EXPORT ZyanStatus ZyanCriticalSectionDelete(ZyanCriticalSection* critical_section);
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Condition Variable                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes a condition variable.
+ *
+ * @param   condition_variable  A pointer to the `ZyanConditionVariable` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConditionVariableInitialize(
+    ZyanConditionVariable* condition_variable);
+
+/**
+ * Atomically leaves the given critical section and blocks the calling thread until the
+ * condition variable is signaled. The critical section is entered again before returning.
+ *
+ * @param   condition_variable  A pointer to the `ZyanConditionVariable` struct.
+ * @param   critical_section    A pointer to the `ZyanCriticalSection` struct. The calling thread
+ *                              must have entered the critical section exactly once.
+ *
+ * Spurious wakeups are possible. The caller should always re-check the awaited condition.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConditionVariableWait(ZyanConditionVariable* condition_variable,
+    ZyanCriticalSection* critical_section);
+
+/**
+ * Wakes a single thread waiting on the condition variable.
+ *
+ * @param   condition_variable  A pointer to the `ZyanConditionVariable` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConditionVariableWakeOne(ZyanConditionVariable* condition_variable);
+
+/**
+ * Wakes all threads waiting on the condition variable.
+ *
+ * @param   condition_variable  A pointer to the `ZyanConditionVariable` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConditionVariableWakeAll(ZyanConditionVariable* condition_variable);
+
+/**
+ * Deletes a condition variable.
+ *
+ * @param   condition_variable  A pointer to the `ZyanConditionVariable` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanConditionVariableDelete(ZyanConditionVariable* condition_variable);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Read-Write Lock                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes a read-write lock.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockInitialize(ZyanReadWriteLock* lock);
+
+/**
+ * Acquires a read-write lock in shared mode. Any number of threads can hold the lock in shared
+ * mode at the same time, as long as no thread holds it in exclusive mode.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockEnterShared(ZyanReadWriteLock* lock);
+
+/**
+ * Releases a read-write lock that was acquired in shared mode.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockLeaveShared(ZyanReadWriteLock* lock);
+
+/**
+ * Acquires a read-write lock in exclusive mode.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ *
+ * The lock is not recursive. A thread that already holds the lock must not acquire it again.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockEnterExclusive(ZyanReadWriteLock* lock);
+
+/**
+ * Releases a read-write lock that was acquired in exclusive mode.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockLeaveExclusive(ZyanReadWriteLock* lock);
+
+/**
+ * Deletes a read-write lock.
+ *
+ * @param   lock    A pointer to the `ZyanReadWriteLock` struct.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanReadWriteLockDelete(ZyanReadWriteLock* lock);
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
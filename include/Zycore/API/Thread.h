@@ -138,6 +138,19 @@ typedef PFLS_CALLBACK_FUNCTION ZyanThreadTlsCallback;
 #   error "Unsupported platform detected"
 #endif
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Thread procedure                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ *  Defines the `ZyanThreadProcedure` function prototype.
+ *
+ * @param   argument    The argument passed to `ZyanThreadCreate`.
+ */
+typedef void(*ZyanThreadProcedure)(void* argument);
+
+/* ---------------------------------------------------------------------------------------------- */
+
 /* ============================================================================================== */
 /* Exported functions                                                                             */
 /* ============================================================================================== */
@@ -164,6 +177,42 @@ ZYCORE_EXPORT ZyanStatus ZyanThreadGetCurrentThread(ZyanThread* thread);
  */
 ZYCORE_EXPORT ZyanStatus ZyanThreadGetCurrentThreadId(ZyanThreadId* thread_id);
 
+/**
+ * Returns the number of logical processors available to the current process.
+ *
+ * @param   count   Receives the number of logical processors. This is at least `1`.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadGetProcessorCount(ZyanUSize* count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Thread creation                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Creates a new thread.
+ *
+ * @param   thread      Receives the handle of the new thread.
+ * @param   procedure   The procedure to execute in the new thread.
+ * @param   argument    The argument to pass to the `procedure`.
+ *
+ * @return  A zyan status code.
+ *
+ * Every thread created by this function must be passed to `ZyanThreadJoin` exactly once.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadCreate(ZyanThread* thread, ZyanThreadProcedure procedure,
+    void* argument);
+
+/**
+ * Waits for the given thread to finish and releases its resources.
+ *
+ * @param   thread  The handle of the thread.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadJoin(ZyanThread thread);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Thread Local Storage (TLS)                                                                     */
 /* ---------------------------------------------------------------------------------------------- */
@@ -78,11 +78,66 @@ typedef ZyanStatus (*ZyanAllocatorAllocate)(struct ZyanAllocator_* allocator, vo
 typedef ZyanStatus (*ZyanAllocatorDeallocate)(struct ZyanAllocator_* allocator, void* p,
     ZyanUSize element_size, ZyanUSize n);
 
+/**
+ * Defines the `ZyanAllocatorAlignedAllocate` function prototype.
+ *
+ * @param   allocator       A pointer to the `ZyanAllocator` instance.
+ * @param   p               Receives a pointer to the first memory block sufficient to hold an
+ *                          array of `n` elements with a size of `element_size`.
+ * @param   alignment       The required alignment of the memory block. Always a power of two.
+ * @param   element_size    The size of a single element.
+ * @param   n               The number of elements to allocate storage for.
+ *
+ * @return  A zyan status code.
+ */
+typedef ZyanStatus (*ZyanAllocatorAlignedAllocate)(struct ZyanAllocator_* allocator, void** p,
+    ZyanUSize alignment, ZyanUSize element_size, ZyanUSize n);
+
+/**
+ * Defines the `ZyanAllocatorAlignedReallocate` function prototype.
+ *
+ * @param   allocator       A pointer to the `ZyanAllocator` instance.
+ * @param   p               A pointer to the memory block obtained from `aligned_(re-)allocate()`.
+ *                          Receives a pointer to the resized memory block.
+ * @param   alignment       The alignment earlier passed to `aligned_(re-)allocate()`.
+ * @param   element_size    The size of a single element.
+ * @param   old_n           The number of elements earlier passed to `aligned_(re-)allocate()`.
+ * @param   n               The new number of elements.
+ *
+ * @return  A zyan status code.
+ *
+ * The old size is passed to allow implementations without native aligned reallocation support to
+ * copy the exact amount of data.
+ *
+ * If the function fails, `p` must still point to the original, unmodified memory block.
+ */
+typedef ZyanStatus (*ZyanAllocatorAlignedReallocate)(struct ZyanAllocator_* allocator, void** p,
+    ZyanUSize alignment, ZyanUSize element_size, ZyanUSize old_n, ZyanUSize n);
+
+/**
+ * Defines the `ZyanAllocatorAlignedDeallocate` function prototype.
+ *
+ * @param   allocator       A pointer to the `ZyanAllocator` instance.
+ * @param   p               The pointer obtained from `aligned_(re-)allocate()`.
+ * @param   alignment       The alignment earlier passed to `aligned_(re-)allocate()`.
+ * @param   element_size    The size of a single element.
+ * @param   n               The number of elements earlier passed to `aligned_(re-)allocate()`.
+ *
+ * @return  A zyan status code.
+ */
+typedef ZyanStatus (*ZyanAllocatorAlignedDeallocate)(struct ZyanAllocator_* allocator, void* p,
+    ZyanUSize alignment, ZyanUSize element_size, ZyanUSize n);
+
 /**
  * Defines the `ZyanAllocator` struct.
  *
  * This is the base class for all custom allocator implementations.
  *
+ * The aligned functions are optional. Use `ZyanAllocatorAllocateAligned`,
+ * `ZyanAllocatorReallocateAligned` and `ZyanAllocatorDeallocateAligned` to request aligned memory
+ * from any allocator. These functions emulate aligned allocations on top of `allocate()` and
+ * `deallocate()`, if the allocator does not implement them natively.
+ *
  * All fields in this struct should be considered as "private". Any changes may lead to unexpected
  * behavior.
  */
@@ -100,12 +155,28 @@ typedef struct ZyanAllocator_
      * The deallocate function.
      */
     ZyanAllocatorDeallocate deallocate;
+    /**
+     * The aligned allocate function or `ZYAN_NULL`.
+     */
+    ZyanAllocatorAlignedAllocate aligned_allocate;
+    /**
+     * The aligned reallocate function or `ZYAN_NULL`.
+     */
+    ZyanAllocatorAlignedReallocate aligned_reallocate;
+    /**
+     * The aligned deallocate function or `ZYAN_NULL`.
+     */
+    ZyanAllocatorAlignedDeallocate aligned_deallocate;
 } ZyanAllocator;
 
 /* ============================================================================================== */
 /* Exported functions                                                                             */
 /* ============================================================================================== */
 
+/* ---------------------------------------------------------------------------------------------- */
+/* General                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
 /**
  * Initializes the given `ZyanAllocator` instance.
  *
@@ -115,10 +186,33 @@ typedef struct ZyanAllocator_
  * @param   deallocate  The deallocate function.
  *
  * @return  A zyan status code.
+ *
+ * The aligned functions are set to `ZYAN_NULL`.
  */
 ZYCORE_EXPORT ZyanStatus ZyanAllocatorInit(ZyanAllocator* allocator, ZyanAllocatorAllocate allocate,
     ZyanAllocatorAllocate reallocate, ZyanAllocatorDeallocate deallocate);
 
+/**
+ * Initializes the given `ZyanAllocator` instance with support for aligned allocations.
+ *
+ * @param   allocator           A pointer to the `ZyanAllocator` instance.
+ * @param   allocate            The allocate function.
+ * @param   reallocate          The reallocate function.
+ * @param   deallocate          The deallocate function.
+ * @param   aligned_allocate    The aligned allocate function.
+ * @param   aligned_reallocate  The aligned reallocate function.
+ * @param   aligned_deallocate  The aligned deallocate function.
+ *
+ * @return  A zyan status code.
+ *
+ * The aligned functions must either all be set or all be `ZYAN_NULL`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAllocatorInitEx(ZyanAllocator* allocator,
+    ZyanAllocatorAllocate allocate, ZyanAllocatorAllocate reallocate,
+    ZyanAllocatorDeallocate deallocate, ZyanAllocatorAlignedAllocate aligned_allocate,
+    ZyanAllocatorAlignedReallocate aligned_reallocate,
+    ZyanAllocatorAlignedDeallocate aligned_deallocate);
+
 #ifndef ZYAN_NO_LIBC
 
 /**
@@ -134,6 +228,67 @@ ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanAllocator* ZyanAllocatorDefault(void);
 
 #endif // ZYAN_NO_LIBC
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Aligned allocation                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Allocates an aligned memory block using the given `allocator`.
+ *
+ * @param   allocator       A pointer to the `ZyanAllocator` instance.
+ * @param   p               Receives a pointer to the first memory block sufficient to hold an
+ *                          array of `n` elements with a size of `element_size`.
+ * @param   alignment       The required alignment of the memory block. Must be a power of two.
+ * @param   element_size    The size of a single element.
+ * @param   n               The number of elements to allocate storage for.
+ *
+ * @return  A zyan status code.
+ *
+ * If the allocator does not implement `aligned_allocate()`, a larger block is obtained from
+ * `allocate()` and aligned manually.
+ *
+ * Memory blocks obtained from this function must be released by `ZyanAllocatorDeallocateAligned`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAllocatorAllocateAligned(ZyanAllocator* allocator, void** p,
+    ZyanUSize alignment, ZyanUSize element_size, ZyanUSize n);
+
+/**
+ * Resizes an aligned memory block using the given `allocator`.
+ *
+ * @param   allocator       A pointer to the `ZyanAllocator` instance.
+ * @param   p               A pointer to the memory block obtained from
+ *                          `ZyanAllocatorAllocateAligned`. Receives a pointer to the resized
+ *                          memory block.
+ * @param   alignment       The alignment earlier passed to `ZyanAllocatorAllocateAligned`.
+ * @param   element_size    The size of a single element.
+ * @param   old_n           The number of elements earlier passed to
+ *                          `ZyanAllocatorAllocateAligned`.
+ * @param   n               The new number of elements.
+ *
+ * @return  A zyan status code.
+ *
+ * If the function fails, `p` still points to the original, unmodified memory block.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAllocatorReallocateAligned(ZyanAllocator* allocator, void** p,
+    ZyanUSize alignment, ZyanUSize element_size, ZyanUSize old_n, ZyanUSize n);
+
+/**
+ * Releases an aligned memory block using the given `allocator`.
+ *
+ * @param   allocator       A pointer to the `ZyanAllocator` instance.
+ * @param   p               The pointer obtained from `ZyanAllocator(Re)AllocateAligned`.
+ * @param   alignment       The alignment earlier passed to `ZyanAllocatorAllocateAligned`.
+ * @param   element_size    The size of a single element.
+ * @param   n               The number of elements earlier passed to
+ *                          `ZyanAllocator(Re)AllocateAligned`.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanAllocatorDeallocateAligned(ZyanAllocator* allocator, void* p,
+    ZyanUSize alignment, ZyanUSize element_size, ZyanUSize n);
+
+/* ---------------------------------------------------------------------------------------------- */
+
 /* ============================================================================================== */
 
 #ifdef __cplusplus
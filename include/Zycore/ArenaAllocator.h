@@ -0,0 +1,245 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a bump-pointer arena allocator.
+ */
+
+#ifndef ZYCORE_ARENA_ALLOCATOR_H
+#define ZYCORE_ARENA_ALLOCATOR_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The default size (number of bytes) of a single arena chunk.
+ */
+#define ZYAN_ARENA_DEFAULT_CHUNK_SIZE   (64 * 1024)
+
+/**
+ * The alignment of all memory blocks returned by the arena.
+ */
+#define ZYAN_ARENA_ALIGNMENT            (2 * sizeof(void*))
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanArenaChunk` struct.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanArenaChunk_
+{
+    /**
+     * A pointer to the next chunk.
+     */
+    struct ZyanArenaChunk_* next;
+    /**
+     * The usable size of this chunk in bytes (not including the chunk header).
+     */
+    ZyanUSize capacity;
+} ZyanArenaChunk;
+
+/**
+ * Defines the `ZyanArenaAllocator` struct.
+ *
+ * The arena hands out memory by bumping a pointer inside of large chunks that are obtained from a
+ * backing allocator. Individual deallocations are (mostly) no-ops; all memory is released at once
+ * by calling `ZyanArenaReset` or `ZyanArenaDestroy`.
+ *
+ * Pass `&arena.allocator` to the `*InitEx` functions of the container types to use the arena as
+ * memory allocator.
+ *
+ * The arena is not thread-safe.
+ *
+ * All fields in this struct except `allocator` should be considered as "private". Any changes may
+ * lead to unexpected behavior.
+ */
+typedef struct ZyanArenaAllocator_
+{
+    /**
+     * The `ZyanAllocator` interface of the arena.
+     *
+     * This field is required to be the first member of the struct.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The backing allocator used to obtain new chunks or `ZYAN_NULL`, if the arena uses a custom
+     * user defined buffer.
+     */
+    ZyanAllocator* backing;
+    /**
+     * The default size of a single chunk in bytes.
+     */
+    ZyanUSize chunk_size;
+    /**
+     * The first chunk.
+     */
+    ZyanArenaChunk* head;
+    /**
+     * The chunk that is currently used for allocations.
+     */
+    ZyanArenaChunk* current;
+    /**
+     * The next free byte inside the current chunk.
+     */
+    ZyanU8* cursor;
+    /**
+     * The end of the current chunk.
+     */
+    ZyanU8* end;
+    /**
+     * The most recently allocated memory block or `ZYAN_NULL`.
+     */
+    void* last;
+} ZyanArenaAllocator;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanArenaAllocator` instance.
+ *
+ * @param   arena       A pointer to the `ZyanArenaAllocator` instance.
+ * @param   chunk_size  The size of a single chunk in bytes or `0` to use the default chunk size.
+ *
+ * @return  A zyan status code.
+ *
+ * The chunks are dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanArenaDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanArenaInit(ZyanArenaAllocator* arena,
+    ZyanUSize chunk_size);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanArenaAllocator` instance and sets a custom backing `allocator`.
+ *
+ * @param   arena       A pointer to the `ZyanArenaAllocator` instance.
+ * @param   chunk_size  The size of a single chunk in bytes or `0` to use the default chunk size.
+ * @param   allocator   A pointer to the `ZyanAllocator` instance that is used to allocate the
+ *                      chunks.
+ *
+ * @return  A zyan status code.
+ *
+ * Chunks are allocated lazily. Allocations larger than `chunk_size` receive a dedicated chunk.
+ *
+ * Finalization with `ZyanArenaDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanArenaInitEx(ZyanArenaAllocator* arena, ZyanUSize chunk_size,
+    ZyanAllocator* allocator);
+
+/**
+ * Initializes the given `ZyanArenaAllocator` instance and configures it to use a custom user
+ * defined buffer with a fixed size.
+ *
+ * @param   arena       A pointer to the `ZyanArenaAllocator` instance.
+ * @param   buffer      A pointer to the buffer that is used as storage for all allocations.
+ * @param   capacity    The capacity (number of bytes) of the buffer.
+ *
+ * @return  A zyan status code.
+ *
+ * Allocations fail with `ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE`, if the buffer is exhausted.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanArenaInitCustomBuffer(ZyanArenaAllocator* arena, void* buffer,
+    ZyanUSize capacity);
+
+/**
+ * Destroys the given `ZyanArenaAllocator` instance and releases all chunks.
+ *
+ * @param   arena   A pointer to the `ZyanArenaAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All memory blocks obtained from the arena become invalid. Containers that use the arena do not
+ * have to be destroyed individually, as long as their elements do not require finalization.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanArenaDestroy(ZyanArenaAllocator* arena);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Releases all memory blocks obtained from the given arena in a single step.
+ *
+ * @param   arena   A pointer to the `ZyanArenaAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All memory blocks obtained from the arena become invalid. The chunks are kept and reused by
+ * subsequent allocations, which makes this function run in constant time.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanArenaReset(ZyanArenaAllocator* arena);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the total size of all chunks currently owned by the arena.
+ *
+ * @param   arena   A pointer to the `ZyanArenaAllocator` instance.
+ * @param   size    Receives the total size of all chunks in bytes.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanArenaGetCapacity(const ZyanArenaAllocator* arena, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_ARENA_ALLOCATOR_H */
@@ -0,0 +1,202 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a thread-caching allocator for small memory blocks.
+ */
+
+#ifndef ZYCORE_CACHING_ALLOCATOR_H
+#define ZYCORE_CACHING_ALLOCATOR_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/API/Synchronization.h>
+#include <Zycore/API/Thread.h>
+
+#ifndef ZYAN_NO_LIBC
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The number of size-classes managed by the caching allocator.
+ */
+#define ZYAN_CACHING_CLASS_COUNT        40
+
+/**
+ * The size of the largest block (number of bytes) that is served from the per-thread caches.
+ *
+ * Larger blocks are directly obtained from the default memory manager.
+ */
+#define ZYAN_CACHING_MAX_BLOCK_SIZE     32768
+
+/**
+ * The alignment of all memory blocks returned by the caching allocator.
+ */
+#define ZYAN_CACHING_ALIGNMENT          16
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+struct ZyanCachingThreadCache_;
+
+/**
+ * Defines the `ZyanCachingDepot` struct.
+ *
+ * The depot holds batches of free blocks of a single size-class that are shared between all
+ * threads.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanCachingDepot_
+{
+    /**
+     * The critical section that guards the depot.
+     */
+    ZyanCriticalSection lock;
+    /**
+     * The first block of the first batch in the depot.
+     */
+    void* batches;
+} ZyanCachingDepot;
+
+/**
+ * Defines the `ZyanCachingAllocator` struct.
+ *
+ * The caching allocator serves small memory blocks from per-thread size-class caches without any
+ * locking. Free blocks exceeding the cache limit are returned to a central depot in batches, and
+ * empty caches are refilled from the depot (or from a fresh slab) one batch at a time.
+ *
+ * Blocks may be released by a different thread than the one that allocated them. They are simply
+ * put into the cache of the releasing thread.
+ *
+ * Memory used for cached blocks is not returned to the system before the allocator is destroyed.
+ *
+ * All fields in this struct except `allocator` should be considered as "private". Any changes may
+ * lead to unexpected behavior.
+ */
+typedef struct ZyanCachingAllocator_
+{
+    /**
+     * The `ZyanAllocator` interface of the caching allocator.
+     *
+     * This field is required to be the first member of the struct.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The TLS slot that holds the cache of each thread.
+     */
+    ZyanThreadTlsIndex tls_index;
+    /**
+     * The critical section that guards the `caches` and `slabs` lists.
+     */
+    ZyanCriticalSection lock;
+    /**
+     * The list of all thread caches.
+     */
+    struct ZyanCachingThreadCache_* caches;
+    /**
+     * The list of all slabs.
+     */
+    void* slabs;
+    /**
+     * The central depots (one for each size-class).
+     */
+    ZyanCachingDepot depots[ZYAN_CACHING_CLASS_COUNT];
+} ZyanCachingAllocator;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the given `ZyanCachingAllocator` instance.
+ *
+ * @param   allocator   A pointer to the `ZyanCachingAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The instance must not be moved in memory while it is in use.
+ *
+ * Finalization with `ZyanCachingDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCachingInit(ZyanCachingAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanCachingAllocator` instance.
+ *
+ * @param   allocator   A pointer to the `ZyanCachingAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All memory blocks obtained from the allocator become invalid. Blocks larger than
+ * `ZYAN_CACHING_MAX_BLOCK_SIZE` are not tracked and have to be released before calling this
+ * function.
+ *
+ * Other threads must not use the allocator while this function is running.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCachingDestroy(ZyanCachingAllocator* allocator);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Cache management                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns all blocks from the cache of the calling thread to the central depot.
+ *
+ * @param   allocator   A pointer to the `ZyanCachingAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * This function is automatically called when a thread exits.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanCachingFlush(ZyanCachingAllocator* allocator);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYAN_NO_LIBC */
+
+#endif /* ZYCORE_CACHING_ALLOCATOR_H */
@@ -269,6 +269,32 @@
 #   define ZYAN_FALLTHROUGH
 #endif
 
+/**
+ * Hints the processor to fetch the cache line at the given `address` for a future read.
+ *
+ * @param   address The address to prefetch.
+ */
+#if defined(ZYAN_GNUC)
+#   define ZYAN_PREFETCH(address) __builtin_prefetch(address)
+#else
+#   define ZYAN_PREFETCH(address) (void)(address)
+#endif
+
+/**
+ * Enables additional instruction set extensions for a single function.
+ *
+ * @param   features    The instruction set extensions (e.g. `"avx2"`).
+ *
+ * Functions marked with this attribute must only be called after checking that the processor
+ * supports the given extensions. On compilers that do not need the attribute to emit intrinsics
+ * (like MSVC), this macro expands to nothing.
+ */
+#if defined(ZYAN_GNUC)
+#   define ZYAN_TARGET(features) __attribute__((target(features)))
+#else
+#   define ZYAN_TARGET(features)
+#endif
+
 /**
  * Declares a bitfield.
  *
@@ -0,0 +1,268 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a read-only search index that stores sorted elements in Eytzinger (BFS) order.
+ */
+
+#ifndef ZYCORE_EYTZINGER_INDEX_H
+#define ZYCORE_EYTZINGER_INDEX_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Comparison.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The alignment of the element storage of an Eytzinger index.
+ */
+#define ZYAN_EYTZINGER_ALIGNMENT        64
+
+/**
+ * The distance (in tree levels) at which the descendants of the current element are prefetched
+ * during a search.
+ */
+#define ZYAN_EYTZINGER_PREFETCH_LEVELS  4
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanEytzingerIndex` struct.
+ *
+ * The index holds a copy of the elements of a sorted vector, laid out like an implicit binary
+ * search tree in breadth-first order: the children of the element at position `k` are stored at
+ * positions `2k` and `2k + 1`. The first levels of the tree share a few cache lines and the
+ * descendants of an element can be prefetched several levels in advance, which makes lookups
+ * much more cache friendly than a binary search on the sorted vector itself.
+ *
+ * The index is read-only. It has to be rebuilt after the source vector was modified.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanEytzingerIndex_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The size of a single element in bytes.
+     */
+    ZyanUSize element_size;
+    /**
+     * The number of elements.
+     */
+    ZyanUSize size;
+    /**
+     * The elements in Eytzinger order (`size + 1` elements, position `0` is unused).
+     */
+    void* data;
+    /**
+     * The index of each element in the sorted source vector (`size + 1` entries).
+     */
+    ZyanUSize* ranks;
+} ZyanEytzingerIndex;
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * Returns the position of the lower bound, given the position at which a search descending the
+ * tree ended.
+ *
+ * @param   k   The position at which the search ended.
+ *
+ * @return  The position of the lower bound or `0`, if all elements are less than the searched
+ *          value.
+ *
+ * Every right turn of the search appends a `1` bit to `k` and every left turn a `0` bit. The
+ * lower bound is the element at which the search went left for the last time, so all trailing
+ * right turns and the last left turn are stripped.
+ */
+ZYAN_INLINE ZyanUSize ZyanEytzingerIndexResolvePosition(ZyanUSize k)
+{
+#if defined(ZYAN_GNUC)
+    return k >> (__builtin_ctzll(~(unsigned long long)k) + 1);
+#else
+    while (k & 1)
+    {
+        k >>= 1;
+    }
+    return k >> 1;
+#endif
+}
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/**
+ * Declares a typed search function for a `ZyanEytzingerIndex` of integral elements.
+ *
+ * @param   name    The name of the function.
+ * @param   type    The name of the integral data-type.
+ *
+ * The declared function has the signature
+ * `ZyanBool name(const ZyanEytzingerIndex* eytzinger, type value, ZyanUSize* found_index)` and
+ * behaves like `ZyanEytzingerIndexSearch`, but inlines the comparison instead of calling a
+ * comparison function for every visited element.
+ */
+#define ZYAN_DECLARE_EYTZINGER_SEARCH(name, type) \
+    ZyanBool name(const ZyanEytzingerIndex* eytzinger, type value, ZyanUSize* found_index) \
+    { \
+        ZYAN_ASSERT(eytzinger); \
+        ZYAN_ASSERT(eytzinger->element_size == sizeof(type)); \
+        ZYAN_ASSERT(found_index); \
+        \
+        const type* const elements = (const type*)eytzinger->data; \
+        const ZyanUSize size = eytzinger->size; \
+        ZyanUSize k = 1; \
+        while (k <= size) \
+        { \
+            ZYAN_PREFETCH((const void*)((ZyanUPointer)elements + \
+                (k << ZYAN_EYTZINGER_PREFETCH_LEVELS) * sizeof(type))); \
+            k = 2 * k + ((elements[k] < value) ? 1 : 0); \
+        } \
+        k = ZyanEytzingerIndexResolvePosition(k); \
+        *found_index = eytzinger->ranks[k]; \
+        return (k && (elements[k] == value)) ? ZYAN_TRUE : ZYAN_FALSE; \
+    }
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Builds a `ZyanEytzingerIndex` from the given sorted vector.
+ *
+ * @param   eytzinger   A pointer to the `ZyanEytzingerIndex` instance.
+ * @param   vector      A pointer to the `ZyanVector` instance. The elements are required to be
+ *                      sorted in ascending order.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the index is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanEytzingerIndexDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanEytzingerIndexInit(ZyanEytzingerIndex* eytzinger,
+    const ZyanVector* vector);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Builds a `ZyanEytzingerIndex` from the given sorted vector and sets a custom `allocator`.
+ *
+ * @param   eytzinger   A pointer to the `ZyanEytzingerIndex` instance.
+ * @param   vector      A pointer to the `ZyanVector` instance. The elements are required to be
+ *                      sorted in ascending order.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanEytzingerIndexDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEytzingerIndexInitEx(ZyanEytzingerIndex* eytzinger,
+    const ZyanVector* vector, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanEytzingerIndex` instance.
+ *
+ * @param   eytzinger   A pointer to the `ZyanEytzingerIndex` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEytzingerIndexDestroy(ZyanEytzingerIndex* eytzinger);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Searching                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Searches for the first occurrence of `element` in the given index.
+ *
+ * @param   eytzinger   A pointer to the `ZyanEytzingerIndex` instance.
+ * @param   element     A pointer to the element to search for.
+ * @param   found_index A pointer to a variable that receives the index of the found element.
+ * @param   comparison  The comparison function to use.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was found, `ZYAN_STATUS_FALSE` if not or a generic
+ *          zyan status code if an error occurred.
+ *
+ * The result matches `ZyanVectorBinarySearch` on the source vector: If found, `found_index`
+ * contains the index of the first matching element in the source vector. If not found,
+ * `found_index` contains the index of the first entry larger than `element`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEytzingerIndexSearch(const ZyanEytzingerIndex* eytzinger,
+    const void* element, ZyanUSize* found_index, ZyanComparison comparison);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of elements in the given index.
+ *
+ * @param   eytzinger   A pointer to the `ZyanEytzingerIndex` instance.
+ * @param   size        Receives the number of elements.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanEytzingerIndexGetSize(const ZyanEytzingerIndex* eytzinger,
+    ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_EYTZINGER_INDEX_H */
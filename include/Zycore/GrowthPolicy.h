@@ -0,0 +1,166 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements pluggable growth policies for the dynamically allocated container types.
+ */
+
+#ifndef ZYCORE_GROWTH_POLICY_H
+#define ZYCORE_GROWTH_POLICY_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The default threshold (number of bytes) above which the linear growth policy stops growing
+ * geometrically.
+ */
+#define ZYAN_GROWTH_POLICY_DEFAULT_LINEAR_THRESHOLD (64 * 1024 * 1024)
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+struct ZyanGrowthPolicy_;
+
+/**
+ * Defines the `ZyanGrowthPolicyCalculate` function prototype.
+ *
+ * @param   policy          A pointer to the `ZyanGrowthPolicy` instance.
+ * @param   element_size    The size of a single element.
+ * @param   size            The number of elements the container has to hold.
+ *
+ * @return  The new capacity (number of elements) of the container. Values less than `size` are
+ *          treated as `size`.
+ *
+ * This function is invoked every time a container grows beyond its capacity or shrinks below its
+ * shrink threshold.
+ */
+typedef ZyanUSize (*ZyanGrowthPolicyCalculate)(const struct ZyanGrowthPolicy_* policy,
+    ZyanUSize element_size, ZyanUSize size);
+
+/**
+ * Defines the `ZyanGrowthPolicy` struct.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanGrowthPolicy_
+{
+    /**
+     * The capacity calculation function.
+     */
+    ZyanGrowthPolicyCalculate calculate;
+    /**
+     * A policy specific parameter.
+     */
+    ZyanUSize parameter;
+} ZyanGrowthPolicy;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Initialization                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the given `ZyanGrowthPolicy` instance.
+ *
+ * @param   policy      A pointer to the `ZyanGrowthPolicy` instance.
+ * @param   calculate   The capacity calculation function.
+ * @param   parameter   A policy specific parameter that is available to the `calculate` function.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanGrowthPolicyInit(ZyanGrowthPolicy* policy,
+    ZyanGrowthPolicyCalculate calculate, ZyanUSize parameter);
+
+/**
+ * Initializes the given `ZyanGrowthPolicy` instance with a policy that grows geometrically by a
+ * factor of `1.5` up to the given `threshold` and linearly in steps of `threshold` bytes beyond.
+ *
+ * @param   policy      A pointer to the `ZyanGrowthPolicy` instance.
+ * @param   threshold   The threshold (number of bytes) or `0` to use
+ *                      `ZYAN_GROWTH_POLICY_DEFAULT_LINEAR_THRESHOLD`.
+ *
+ * @return  A zyan status code.
+ *
+ * This policy limits the memory overhead of very large containers to `threshold` bytes.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanGrowthPolicyInitLinear(ZyanGrowthPolicy* policy,
+    ZyanUSize threshold);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Built-in policies                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a policy that grows geometrically by a factor of `1.5`.
+ *
+ * @return  A pointer to the growth policy.
+ */
+ZYCORE_EXPORT const ZyanGrowthPolicy* ZyanGrowthPolicyGeometric(void);
+
+/**
+ * Returns a policy that rounds the capacity up to the next power of two.
+ *
+ * @return  A pointer to the growth policy.
+ */
+ZYCORE_EXPORT const ZyanGrowthPolicy* ZyanGrowthPolicyPowerOfTwo(void);
+
+/**
+ * Returns a policy that grows geometrically by a factor of `1.5` and rounds the size of the
+ * buffer up to the next allocator size-class.
+ *
+ * @return  A pointer to the growth policy.
+ *
+ * Size-classes are multiples of 16 bytes up to 128 bytes, four classes per power of two up to
+ * 4KiB and multiples of 4KiB beyond. Rounding to these classes avoids wasting the slack that
+ * common memory allocators add to each block anyways.
+ */
+ZYCORE_EXPORT const ZyanGrowthPolicy* ZyanGrowthPolicySizeClass(void);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_GROWTH_POLICY_H */
@@ -0,0 +1,261 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Provides fast non-cryptographic hash functions.
+ */
+
+#ifndef ZYCORE_HASH_H
+#define ZYCORE_HASH_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Defines.h>
+#include <Zycore/Status.h>
+#include <Zycore/String.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanHashState` struct.
+ *
+ * The state of an incremental hash computation. Feeding the data in multiple chunks produces the
+ * same hash value as hashing all data at once.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanHashState_
+{
+    /**
+     * The lanes of the hash function.
+     */
+    ZyanU64 lanes[3];
+    /**
+     * The total number of bytes that have been fed to the hash function.
+     */
+    ZyanU64 length;
+    /**
+     * The number of pending bytes in the buffer.
+     */
+    ZyanUSize pending;
+    /**
+     * The last 16 bytes of the previous block, followed by the pending bytes that have not been
+     * processed yet.
+     */
+    ZyanU8 buffer[64];
+} ZyanHashState;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Integer mixers                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Mixes the bits of the given 32-bit `value`.
+ *
+ * @param   value   The value.
+ *
+ * @return  The mixed value.
+ *
+ * This is a bijection, so different values never produce the same result.
+ */
+ZYAN_INLINE ZyanU32 ZyanHashU32(ZyanU32 value)
+{
+    value ^= value >> 16;
+    value *= 0x21F0AAAD;
+    value ^= value >> 15;
+    value *= 0x735A2D97;
+    value ^= value >> 15;
+    return value;
+}
+
+/**
+ * Mixes the bits of the given 64-bit `value`.
+ *
+ * @param   value   The value.
+ *
+ * @return  The mixed value.
+ *
+ * This is a bijection, so different values never produce the same result.
+ */
+ZYAN_INLINE ZyanU64 ZyanHashU64(ZyanU64 value)
+{
+    value ^= value >> 30;
+    value *= 0xBF58476D1CE4E5B9;
+    value ^= value >> 27;
+    value *= 0x94D049BB133111EB;
+    value ^= value >> 31;
+    return value;
+}
+
+/**
+ * Combines the given hash values.
+ *
+ * @param   seed    The hash value of the preceding elements.
+ * @param   value   The hash value of the next element.
+ *
+ * @return  The combined hash value.
+ *
+ * The result depends on the order of the elements.
+ */
+ZYAN_INLINE ZyanU64 ZyanHashCombine(ZyanU64 seed, ZyanU64 value)
+{
+    return ZyanHashU64(seed ^ (value + 0x9E3779B97F4A7C15 + (seed << 6) + (seed >> 2)));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* One-shot hashing                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Calculates the 64-bit hash value of the given data.
+ *
+ * @param   data    A pointer to the data. May be `ZYAN_NULL`, if `size` is `0`.
+ * @param   size    The size of the data in bytes.
+ * @param   seed    The seed value.
+ *
+ * @return  The hash value.
+ *
+ * This is a variant of `wyhash`. The hash values are not guaranteed to be stable across different
+ * versions of this library or between platforms with different byte order, so they should not be
+ * persisted.
+ */
+ZYCORE_EXPORT ZyanU64 ZyanHash(const void* data, ZyanUSize size, ZyanU64 seed);
+
+/**
+ * Calculates the 64-bit hash value of the given data, ignoring the case of ASCII letters.
+ *
+ * @param   data    A pointer to the data. May be `ZYAN_NULL`, if `size` is `0`.
+ * @param   size    The size of the data in bytes.
+ * @param   seed    The seed value.
+ *
+ * @return  The hash value.
+ *
+ * Matches the semantics of `ZyanStringCompareI`: bytes that only differ in bit 5 (`0x20`) are
+ * considered equal. The result equals the `ZyanHash` of the data with bit 5 set in every byte.
+ */
+ZYCORE_EXPORT ZyanU64 ZyanHashI(const void* data, ZyanUSize size, ZyanU64 seed);
+
+/**
+ * Calculates the 64-bit hash value of the given string.
+ *
+ * @param   string  A pointer to the `ZyanStringView` instance.
+ * @param   seed    The seed value.
+ * @param   hash    Receives the hash value.
+ *
+ * @return  A zyan status code.
+ *
+ * The terminating zero character is not included.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashString(const ZyanStringView* string, ZyanU64 seed,
+    ZyanU64* hash);
+
+/**
+ * Calculates the 64-bit hash value of the given string, ignoring the case of ASCII letters.
+ *
+ * @param   string  A pointer to the `ZyanStringView` instance.
+ * @param   seed    The seed value.
+ * @param   hash    Receives the hash value.
+ *
+ * @return  A zyan status code.
+ *
+ * Strings that are equal according to `ZyanStringCompareI` produce the same hash value.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashStringI(const ZyanStringView* string, ZyanU64 seed,
+    ZyanU64* hash);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Incremental hashing                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the given `ZyanHashState` instance.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   seed    The seed value.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashInit(ZyanHashState* state, ZyanU64 seed);
+
+/**
+ * Feeds the given data to the hash function.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   data    A pointer to the data. May be `ZYAN_NULL`, if `size` is `0`.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashUpdate(ZyanHashState* state, const void* data, ZyanUSize size);
+
+/**
+ * Feeds the given data to the hash function, ignoring the case of ASCII letters.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   data    A pointer to the data. May be `ZYAN_NULL`, if `size` is `0`.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  A zyan status code.
+ *
+ * Bit 5 (`0x20`) is set in every byte before it is fed to the hash function (see `ZyanHashI`).
+ * Calls to this function and `ZyanHashUpdate` can be mixed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashUpdateI(ZyanHashState* state, const void* data,
+    ZyanUSize size);
+
+/**
+ * Returns the hash value of all data that has been fed to the hash function so far.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   hash    Receives the hash value.
+ *
+ * @return  A zyan status code.
+ *
+ * The state is not modified, so more data can be fed to the hash function afterwards.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashFinalize(const ZyanHashState* state, ZyanU64* hash);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_HASH_H */
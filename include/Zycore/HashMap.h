@@ -0,0 +1,415 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a hash map using open addressing with Robin Hood probing.
+ */
+
+#ifndef ZYCORE_HASH_MAP_H
+#define ZYCORE_HASH_MAP_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Comparison.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The initial minimum capacity (number of entries) for all dynamically allocated hash map
+ * instances.
+ */
+#define ZYAN_HASH_MAP_MIN_CAPACITY                  7
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanHashMapHashFunction` function prototype.
+ *
+ * @param   key A pointer to the key.
+ *
+ * @return  This function should return a hash value for the given `key`. Keys that are considered
+ *          equal by the equality callback must produce the same hash value.
+ *
+ * The hash map scrambles the returned value before using it, so a hash function with a poor bit
+ * distribution (e.g. the identity function for integer keys) is acceptable.
+ */
+typedef ZyanU64 (*ZyanHashMapHashFunction)(const void* key);
+
+/**
+ * Defines the `ZyanHashMapDestructor` function prototype.
+ *
+ * @param   key     A pointer to the key of the entry.
+ * @param   value   A pointer to the value of the entry.
+ */
+typedef void (*ZyanHashMapDestructor)(void* key, void* value);
+
+/**
+ * Defines the `ZyanHashMap` struct.
+ *
+ * Keys and values are fixed-size objects that are stored inline in a single buffer. The buffer
+ * is split into a power of two number of slots, followed by one byte per slot that holds the
+ * distance of the entry from its preferred slot (or `0` for empty slots). Robin Hood probing
+ * keeps these distances short, which allows lookups to stop early and erasing entries without
+ * tombstones.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanHashMap_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The hash callback.
+     */
+    ZyanHashMapHashFunction hash;
+    /**
+     * The equality callback.
+     */
+    ZyanEqualityComparison equals;
+    /**
+     * The entry destructor callback.
+     */
+    ZyanHashMapDestructor destructor;
+    /**
+     * The current number of entries in the hash map.
+     */
+    ZyanUSize size;
+    /**
+     * The maximum number of entries before the hash map has to grow.
+     */
+    ZyanUSize capacity;
+    /**
+     * The number of slots. Always a power of two.
+     */
+    ZyanUSize slot_count;
+    /**
+     * The shift that maps a scrambled hash value to a slot index.
+     */
+    ZyanU8 shift;
+    /**
+     * The size of a single key in bytes.
+     */
+    ZyanUSize key_size;
+    /**
+     * The size of a single value in bytes.
+     */
+    ZyanUSize value_size;
+    /**
+     * The offset of the value inside an entry.
+     */
+    ZyanUSize value_offset;
+    /**
+     * The size of a single entry (key and value, including padding) in bytes.
+     */
+    ZyanUSize entry_size;
+    /**
+     * The probe distances.
+     */
+    ZyanU8* distances;
+    /**
+     * The data pointer.
+     */
+    void* data;
+} ZyanHashMap;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanHashMap` instance.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes. May be `0` to use the hash map as a
+ *                      hash set.
+ * @param   capacity    The initial capacity (number of entries).
+ * @param   hash        The hash callback or `ZYAN_NULL` to hash the raw key bytes.
+ * @param   equals      The equality callback or `ZYAN_NULL` to compare the raw key bytes.
+ * @param   destructor  A destructor callback that is invoked every time an entry is deleted, or
+ *                      `ZYAN_NULL` if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the entries is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanHashMapDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanHashMapInit(ZyanHashMap* map, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanUSize capacity, ZyanHashMapHashFunction hash,
+    ZyanEqualityComparison equals, ZyanHashMapDestructor destructor);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanHashMap` instance and sets a custom `allocator`.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes. May be `0` to use the hash map as a
+ *                      hash set.
+ * @param   capacity    The initial capacity (number of entries).
+ * @param   hash        The hash callback or `ZYAN_NULL` to hash the raw key bytes.
+ * @param   equals      The equality callback or `ZYAN_NULL` to compare the raw key bytes.
+ * @param   destructor  A destructor callback that is invoked every time an entry is deleted, or
+ *                      `ZYAN_NULL` if not needed.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanHashMapDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapInitEx(ZyanHashMap* map, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanUSize capacity, ZyanHashMapHashFunction hash,
+    ZyanEqualityComparison equals, ZyanHashMapDestructor destructor, ZyanAllocator* allocator);
+
+/**
+ * Initializes the given `ZyanHashMap` instance and configures it to use a custom user defined
+ * buffer with a fixed size.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes. May be `0` to use the hash map as a
+ *                      hash set.
+ * @param   hash        The hash callback or `ZYAN_NULL` to hash the raw key bytes.
+ * @param   equals      The equality callback or `ZYAN_NULL` to compare the raw key bytes.
+ * @param   buffer      A pointer to the buffer that is used as storage for the entries. The buffer
+ *                      must be suitably aligned for the key and value types.
+ * @param   buffer_size The size of the buffer in bytes.
+ * @param   destructor  A destructor callback that is invoked every time an entry is deleted, or
+ *                      `ZYAN_NULL` if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * The hash map uses as many slots of the buffer as possible. Use `ZyanHashMapGetCapacity` to
+ * query the resulting number of entries that fit into the buffer.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapInitCustomBuffer(ZyanHashMap* map, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanHashMapHashFunction hash, ZyanEqualityComparison equals,
+    void* buffer, ZyanUSize buffer_size, ZyanHashMapDestructor destructor);
+
+/**
+ * Destroys the given `ZyanHashMap` instance.
+ *
+ * @param   map A pointer to the `ZyanHashMap` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapDestroy(ZyanHashMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Searches for the entry with the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a constant pointer to the value of the entry, if found. May be
+ *                  `ZYAN_NULL`.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the key was found, `ZYAN_STATUS_FALSE` if not, or another zyan
+ *          status code, if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when entries are added or removed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapFind(const ZyanHashMap* map, const void* key,
+    const void** value);
+
+/**
+ * Searches for the entry with the given `key`.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a mutable pointer to the value of the entry, if found. May be
+ *                  `ZYAN_NULL`.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the key was found, `ZYAN_STATUS_FALSE` if not, or another zyan
+ *          status code, if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when entries are added or removed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapFindMutable(const ZyanHashMap* map, const void* key,
+    void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts a new entry or replaces the existing entry with the same `key`.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   A pointer to the value. May be `ZYAN_NULL`, if the value size is `0`.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a new entry was inserted, `ZYAN_STATUS_FALSE` if an existing
+ *          entry was replaced, or another zyan status code, if an error occurred.
+ *
+ * The destructor callback is invoked for a replaced entry before the new key and value are
+ * stored.
+ *
+ * If more than 254 keys share the same hash value, the insertion fails with
+ * `ZYAN_STATUS_INVALID_OPERATION`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapInsert(ZyanHashMap* map, const void* key, const void* value);
+
+/**
+ * Returns the value of the entry with the given `key` and inserts a new entry, if the key does
+ * not exist yet.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   value   Receives a mutable pointer to the value of the entry.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a new entry was inserted, `ZYAN_STATUS_FALSE` if the key already
+ *          existed, or another zyan status code, if an error occurred.
+ *
+ * The value of a newly inserted entry is uninitialized and has to be initialized by the caller.
+ *
+ * Note that the returned pointer might get invalid when entries are added or removed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapEmplace(ZyanHashMap* map, const void* key, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the entry with the given `key`.
+ *
+ * @param   map A pointer to the `ZyanHashMap` instance.
+ * @param   key A pointer to the key.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the entry was removed, `ZYAN_STATUS_FALSE` if the key was not
+ *          found, or another zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapErase(ZyanHashMap* map, const void* key);
+
+/**
+ * Removes all entries from the hash map.
+ *
+ * @param   map A pointer to the `ZyanHashMap` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The capacity of the hash map is not changed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapClear(ZyanHashMap* map);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Advances the given `iterator` to the next entry of the hash map.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   iterator    A pointer to the iterator state. Has to be initialized to `0` before the
+ *                      first call.
+ * @param   key         Receives a constant pointer to the key of the entry. May be `ZYAN_NULL`.
+ * @param   value       Receives a mutable pointer to the value of the entry. May be `ZYAN_NULL`.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if an entry was returned, `ZYAN_STATUS_FALSE` if there are no more
+ *          entries, or another zyan status code, if an error occurred.
+ *
+ * The entries are returned in an unspecified order. Adding or removing entries invalidates the
+ * iterator.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapIterate(const ZyanHashMap* map, ZyanUSize* iterator,
+    const void** key, void** value);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Makes sure the hash map is able to hold at least `capacity` entries without growing.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   capacity    The new minimum capacity of the hash map.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapReserve(ZyanHashMap* map, ZyanUSize capacity);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current capacity of the hash map.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   capacity    Receives the maximum number of entries that fit into the hash map
+ *                      without growing.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapGetCapacity(const ZyanHashMap* map, ZyanUSize* capacity);
+
+/**
+ * Returns the current size of the hash map.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   size    Receives the number of entries in the hash map.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHashMapGetSize(const ZyanHashMap* map, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_HASH_MAP_H */
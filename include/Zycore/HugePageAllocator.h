@@ -0,0 +1,165 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements an allocator that backs large memory blocks with huge pages.
+ */
+
+#ifndef ZYCORE_HUGE_PAGE_ALLOCATOR_H
+#define ZYCORE_HUGE_PAGE_ALLOCATOR_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifndef ZYAN_NO_LIBC
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The alignment of all memory blocks returned by the huge page allocator.
+ *
+ * Blocks below the threshold keep the alignment of the backing allocator up to this value.
+ */
+#define ZYAN_HUGE_PAGE_ALIGNMENT        16
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanHugePageAllocator` struct.
+ *
+ * Memory blocks of at least `threshold` bytes are placed in dedicated memory regions that are
+ * backed by huge pages (see `ZyanMemoryVirtualAllocHuge`). Smaller blocks are obtained from the
+ * backing allocator. Reallocations move blocks between both kinds of storage when they cross the
+ * threshold.
+ *
+ * The size of huge page backed regions is rounded up to a multiple of the huge page size.
+ * Shrinking such a block keeps its region.
+ *
+ * If huge pages are not supported by the system, all requests are forwarded to the backing
+ * allocator.
+ *
+ * All fields in this struct except `allocator` should be considered as "private". Any changes may
+ * lead to unexpected behavior.
+ */
+typedef struct ZyanHugePageAllocator_
+{
+    /**
+     * The `ZyanAllocator` interface of the huge page allocator.
+     *
+     * This field is required to be the first member of the struct.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The backing allocator used for blocks below the threshold.
+     */
+    ZyanAllocator* backing;
+    /**
+     * The minimum size of a memory block (number of bytes) that is backed by huge pages.
+     */
+    ZyanUSize threshold;
+    /**
+     * The system huge page size or `0`, if huge pages are not supported.
+     */
+    ZyanU32 page_size;
+} ZyanHugePageAllocator;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the given `ZyanHugePageAllocator` instance.
+ *
+ * @param   allocator   A pointer to the `ZyanHugePageAllocator` instance.
+ * @param   threshold   The minimum size of a memory block (number of bytes) that is backed by
+ *                      huge pages or `0` to use the system huge page size.
+ *
+ * @return  A zyan status code.
+ *
+ * Blocks below the threshold are allocated by the default allocator.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHugePageInit(ZyanHugePageAllocator* allocator,
+    ZyanUSize threshold);
+
+/**
+ * Initializes the given `ZyanHugePageAllocator` instance and sets a custom backing `allocator`.
+ *
+ * @param   allocator   A pointer to the `ZyanHugePageAllocator` instance.
+ * @param   threshold   The minimum size of a memory block (number of bytes) that is backed by
+ *                      huge pages or `0` to use the system huge page size.
+ * @param   backing     A pointer to the `ZyanAllocator` instance that is used for blocks below
+ *                      the threshold.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHugePageInitEx(ZyanHugePageAllocator* allocator,
+    ZyanUSize threshold, ZyanAllocator* backing);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the huge page size used by the given allocator.
+ *
+ * @param   allocator   A pointer to the `ZyanHugePageAllocator` instance.
+ * @param   page_size   Receives the huge page size or `0`, if huge pages are not supported.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanHugePageGetPageSize(const ZyanHugePageAllocator* allocator,
+    ZyanU32* page_size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYAN_NO_LIBC */
+
+#endif /* ZYCORE_HUGE_PAGE_ALLOCATOR_H */
@@ -153,6 +153,19 @@ typedef struct ZyanList_
 /* Helper macros                                                                                  */
 /* ---------------------------------------------------------------------------------------------- */
 
+/**
+ * Returns the number of bytes allocated for a single node of a list with the given
+ * `element_size`.
+ *
+ * @param   element_size    The size of a single element in bytes.
+ *
+ * @result  The number of bytes allocated for a single node (including the element data).
+ *
+ * This value can be used to configure a `ZyanPoolAllocator` for the list nodes.
+ */
+#define ZYAN_LIST_NODE_SIZE(element_size) \
+    (sizeof(ZyanListNode) + (element_size))
+
 /**
  * Returns the data value of the given `node`.
  *
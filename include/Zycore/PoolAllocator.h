@@ -0,0 +1,219 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a fixed-size block pool allocator.
+ */
+
+#ifndef ZYCORE_POOL_ALLOCATOR_H
+#define ZYCORE_POOL_ALLOCATOR_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The default size (number of bytes) of a single pool slab.
+ */
+#define ZYAN_POOL_DEFAULT_SLAB_SIZE     4096
+
+/**
+ * The alignment of all memory blocks returned by the pool.
+ */
+#define ZYAN_POOL_ALIGNMENT             sizeof(void*)
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanPoolSlab` struct.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanPoolSlab_
+{
+    /**
+     * A pointer to the next slab.
+     */
+    struct ZyanPoolSlab_* next;
+    /**
+     * The total size of this slab in bytes (including the slab header).
+     */
+    ZyanUSize size;
+} ZyanPoolSlab;
+
+/**
+ * Defines the `ZyanPoolAllocator` struct.
+ *
+ * The pool hands out memory blocks of a single fixed size. Blocks are carved from slabs that are
+ * obtained from a backing allocator and recycled through an intrusive free-list. Slabs are never
+ * released before the pool is destroyed.
+ *
+ * The pool is intended to be used as allocator for `ZyanList` instances. Use
+ * `ZYAN_LIST_NODE_SIZE(element_size)` as block size and pass `&pool.allocator` to
+ * `ZyanListInitEx`. Multiple lists with the same element size can share a single pool.
+ *
+ * The pool is not thread-safe.
+ *
+ * All fields in this struct except `allocator` should be considered as "private". Any changes may
+ * lead to unexpected behavior.
+ */
+typedef struct ZyanPoolAllocator_
+{
+    /**
+     * The `ZyanAllocator` interface of the pool.
+     *
+     * This field is required to be the first member of the struct.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The backing allocator used to obtain new slabs.
+     */
+    ZyanAllocator* backing;
+    /**
+     * The size of a single block in bytes.
+     */
+    ZyanUSize block_size;
+    /**
+     * The size of a single slab in bytes.
+     */
+    ZyanUSize slab_size;
+    /**
+     * The most recently allocated slab.
+     */
+    ZyanPoolSlab* slabs;
+    /**
+     * The next unused block inside the most recently allocated slab.
+     */
+    ZyanU8* cursor;
+    /**
+     * The end of the most recently allocated slab.
+     */
+    ZyanU8* end;
+    /**
+     * The first free block.
+     *
+     * Free blocks store a pointer to the next free block in their first bytes.
+     */
+    void* free_list;
+} ZyanPoolAllocator;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanPoolAllocator` instance.
+ *
+ * @param   pool        A pointer to the `ZyanPoolAllocator` instance.
+ * @param   block_size  The size of a single block in bytes.
+ *
+ * @return  A zyan status code.
+ *
+ * The slabs are dynamically allocated by the default allocator and have the size of a single
+ * system page.
+ *
+ * Finalization with `ZyanPoolDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanPoolInit(ZyanPoolAllocator* pool,
+    ZyanUSize block_size);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanPoolAllocator` instance and sets a custom backing `allocator`.
+ *
+ * @param   pool        A pointer to the `ZyanPoolAllocator` instance.
+ * @param   block_size  The size of a single block in bytes.
+ * @param   slab_size   The size of a single slab in bytes or `0` to use the default slab size.
+ * @param   allocator   A pointer to the `ZyanAllocator` instance that is used to allocate the
+ *                      slabs.
+ *
+ * @return  A zyan status code.
+ *
+ * The slab size is increased automatically, if it is not sufficient to hold at least a single
+ * block.
+ *
+ * Finalization with `ZyanPoolDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolInitEx(ZyanPoolAllocator* pool, ZyanUSize block_size,
+    ZyanUSize slab_size, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanPoolAllocator` instance and releases all slabs.
+ *
+ * @param   pool    A pointer to the `ZyanPoolAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All memory blocks obtained from the pool become invalid.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolDestroy(ZyanPoolAllocator* pool);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the size of a single block of the given pool.
+ *
+ * @param   pool    A pointer to the `ZyanPoolAllocator` instance.
+ * @param   size    Receives the size of a single block in bytes.
+ *
+ * @return  A zyan status code.
+ *
+ * The returned value might be larger than the block size passed to the constructor, as it is
+ * rounded up to `ZYAN_POOL_ALIGNMENT`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanPoolGetBlockSize(const ZyanPoolAllocator* pool, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_POOL_ALLOCATOR_H */
@@ -0,0 +1,435 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a double-ended queue on top of a circular buffer.
+ */
+
+#ifndef ZYCORE_RING_BUFFER_H
+#define ZYCORE_RING_BUFFER_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Object.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The initial minimum capacity (number of elements) for all dynamically allocated ring buffer
+ * instances.
+ */
+#define ZYAN_RING_BUFFER_MIN_CAPACITY               1
+
+/**
+ * The default growth factor for all ring buffer instances.
+ */
+#define ZYAN_RING_BUFFER_DEFAULT_GROWTH_FACTOR      2
+
+/**
+ * The default shrink threshold for all ring buffer instances.
+ */
+#define ZYAN_RING_BUFFER_DEFAULT_SHRINK_THRESHOLD   4
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanRingBuffer` struct.
+ *
+ * The elements are stored in a circular buffer, starting at the `head` index and wrapping around
+ * at the end of the buffer. This allows adding and removing elements at both ends in constant
+ * time, which makes the ring buffer suitable as a FIFO queue or double-ended queue.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanRingBuffer_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The growth factor.
+     */
+    ZyanU8 growth_factor;
+    /**
+     * The shrink threshold.
+     */
+    ZyanU8 shrink_threshold;
+    /**
+     * The index of the first element in the buffer.
+     */
+    ZyanUSize head;
+    /**
+     * The current number of elements in the ring buffer.
+     */
+    ZyanUSize size;
+    /**
+     * The maximum capacity (number of elements).
+     */
+    ZyanUSize capacity;
+    /**
+     * The size of a single element in bytes.
+     */
+    ZyanUSize element_size;
+    /**
+     * The element destructor callback.
+     */
+    ZyanMemberProcedure destructor;
+    /**
+     * The data pointer.
+     */
+    void* data;
+} ZyanRingBuffer;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanRingBuffer` instance.
+ *
+ * @param   buffer          A pointer to the `ZyanRingBuffer` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   capacity        The initial capacity (number of elements).
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the elements is dynamically allocated by the default allocator using the default
+ * growth factor and the default shrink threshold.
+ *
+ * Finalization with `ZyanRingBufferDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanRingBufferInit(ZyanRingBuffer* buffer,
+    ZyanUSize element_size, ZyanUSize capacity, ZyanMemberProcedure destructor);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanRingBuffer` instance and sets a custom `allocator` and memory
+ * allocation/deallocation parameters.
+ *
+ * @param   buffer              A pointer to the `ZyanRingBuffer` instance.
+ * @param   element_size        The size of a single element in bytes.
+ * @param   capacity            The initial capacity (number of elements).
+ * @param   destructor          A destructor callback that is invoked every time an item is deleted,
+ *                              or `ZYAN_NULL` if not needed.
+ * @param   allocator           A pointer to a `ZyanAllocator` instance.
+ * @param   growth_factor       The growth factor.
+ * @param   shrink_threshold    The shrink threshold.
+ *
+ * @return  A zyan status code.
+ *
+ * A growth factor of `1` disables overallocation and a shrink threshold of `0` disables
+ * dynamic shrinking.
+ *
+ * Finalization with `ZyanRingBufferDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferInitEx(ZyanRingBuffer* buffer, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold);
+
+/**
+ * Initializes the given `ZyanRingBuffer` instance and configures it to use a custom user defined
+ * buffer with a fixed size.
+ *
+ * @param   buffer          A pointer to the `ZyanRingBuffer` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   storage         A pointer to the buffer that is used as storage for the elements.
+ * @param   capacity        The maximum capacity (number of elements) of the buffer.
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferInitCustomBuffer(ZyanRingBuffer* buffer,
+    ZyanUSize element_size, void* storage, ZyanUSize capacity, ZyanMemberProcedure destructor);
+
+/**
+ * Destroys the given `ZyanRingBuffer` instance.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferDestroy(ZyanRingBuffer* buffer);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Element access                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a constant pointer to the element at the given `index`.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ * @param   index   The element index, relative to the front of the ring buffer.
+ *
+ * @return  A constant pointer to the desired element or `ZYAN_NULL`, if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when elements are added or removed.
+ */
+ZYCORE_EXPORT const void* ZyanRingBufferGet(const ZyanRingBuffer* buffer, ZyanUSize index);
+
+/**
+ * Returns a mutable pointer to the element at the given `index`.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ * @param   index   The element index, relative to the front of the ring buffer.
+ *
+ * @return  A mutable pointer to the desired element or `ZYAN_NULL`, if an error occurred.
+ *
+ * Note that the returned pointer might get invalid when elements are added or removed.
+ */
+ZYCORE_EXPORT void* ZyanRingBufferGetMutable(const ZyanRingBuffer* buffer, ZyanUSize index);
+
+/**
+ * Returns the elements of the ring buffer as two contiguous spans.
+ *
+ * @param   buffer          A pointer to the `ZyanRingBuffer` instance.
+ * @param   first           Receives a pointer to the first span or `ZYAN_NULL`, if the ring
+ *                          buffer is empty.
+ * @param   first_count     Receives the number of elements in the first span.
+ * @param   second          Receives a pointer to the second span or `ZYAN_NULL`, if the elements
+ *                          do not wrap around the end of the buffer.
+ * @param   second_count    Receives the number of elements in the second span.
+ *
+ * @return  A zyan status code.
+ *
+ * The first span starts with the front element and is followed by the second span. This allows
+ * reading all elements without copying them, e.g. to pass them to a function that expects a
+ * contiguous array.
+ *
+ * Note that the returned pointers might get invalid when elements are added or removed.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferGetSpans(const ZyanRingBuffer* buffer,
+    const void** first, ZyanUSize* first_count, const void** second, ZyanUSize* second_count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Adds a new `element` to the back of the ring buffer.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ * @param   element A pointer to the element to add.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferPushBack(ZyanRingBuffer* buffer, const void* element);
+
+/**
+ * Adds multiple `elements` to the back of the ring buffer.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   elements    A pointer to the first element.
+ * @param   count       The number of elements to add.
+ *
+ * @return  A zyan status code.
+ *
+ * The last of the given elements becomes the new back element.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferPushBackRange(ZyanRingBuffer* buffer,
+    const void* elements, ZyanUSize count);
+
+/**
+ * Adds a new `element` to the front of the ring buffer.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ * @param   element A pointer to the element to add.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferPushFront(ZyanRingBuffer* buffer, const void* element);
+
+/**
+ * Adds multiple `elements` to the front of the ring buffer.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   elements    A pointer to the first element.
+ * @param   count       The number of elements to add.
+ *
+ * @return  A zyan status code.
+ *
+ * The order of the elements is preserved: the first of the given elements becomes the new front
+ * element.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferPushFrontRange(ZyanRingBuffer* buffer,
+    const void* elements, ZyanUSize count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Removes the front element of the ring buffer.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ * @param   element A pointer to a buffer that receives the removed element or `ZYAN_NULL`, if
+ *                  the element should be destroyed.
+ *
+ * @return  A zyan status code.
+ *
+ * The destructor callback is only invoked, if `element` is `ZYAN_NULL`. Otherwise the ownership
+ * of the element is transferred to the caller.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferPopFront(ZyanRingBuffer* buffer, void* element);
+
+/**
+ * Removes multiple elements from the front of the ring buffer.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   elements    A pointer to a buffer that receives the removed elements in order or
+ *                      `ZYAN_NULL`, if the elements should be destroyed.
+ * @param   count       The number of elements to remove.
+ *
+ * @return  A zyan status code.
+ *
+ * The destructor callback is only invoked, if `elements` is `ZYAN_NULL`. Otherwise the ownership
+ * of the elements is transferred to the caller.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferPopFrontRange(ZyanRingBuffer* buffer, void* elements,
+    ZyanUSize count);
+
+/**
+ * Removes the back element of the ring buffer.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ * @param   element A pointer to a buffer that receives the removed element or `ZYAN_NULL`, if
+ *                  the element should be destroyed.
+ *
+ * @return  A zyan status code.
+ *
+ * The destructor callback is only invoked, if `element` is `ZYAN_NULL`. Otherwise the ownership
+ * of the element is transferred to the caller.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferPopBack(ZyanRingBuffer* buffer, void* element);
+
+/**
+ * Removes multiple elements from the back of the ring buffer.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   elements    A pointer to a buffer that receives the removed elements in order or
+ *                      `ZYAN_NULL`, if the elements should be destroyed.
+ * @param   count       The number of elements to remove.
+ *
+ * @return  A zyan status code.
+ *
+ * The destructor callback is only invoked, if `elements` is `ZYAN_NULL`. Otherwise the ownership
+ * of the elements is transferred to the caller.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferPopBackRange(ZyanRingBuffer* buffer, void* elements,
+    ZyanUSize count);
+
+/**
+ * Removes all elements from the ring buffer.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferClear(ZyanRingBuffer* buffer);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Changes the capacity of the given `ZyanRingBuffer` instance.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   capacity    The new minimum capacity of the ring buffer.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferReserve(ZyanRingBuffer* buffer, ZyanUSize capacity);
+
+/**
+ * Shrinks the capacity of the given ring buffer to match its size.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferShrinkToFit(ZyanRingBuffer* buffer);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current capacity of the ring buffer.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   capacity    Receives the capacity of the ring buffer.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferGetCapacity(const ZyanRingBuffer* buffer,
+    ZyanUSize* capacity);
+
+/**
+ * Returns the current size of the ring buffer.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ * @param   size    Receives the size of the ring buffer.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRingBufferGetSize(const ZyanRingBuffer* buffer, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_RING_BUFFER_H */
@@ -0,0 +1,424 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a rope for large editable strings.
+ */
+
+#ifndef ZYCORE_ROPE_H
+#define ZYCORE_ROPE_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/String.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The capacity (number of characters) of a single rope node.
+ */
+#define ZYAN_ROPE_CHUNK_SIZE    1024
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Rope                                                                                           */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Defines the `ZyanRopeNode` struct.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanRopeNode_
+{
+    /**
+     * A pointer to the left child node.
+     */
+    struct ZyanRopeNode_* left;
+    /**
+     * A pointer to the right child node.
+     */
+    struct ZyanRopeNode_* right;
+    /**
+     * The total number of characters in the subtree rooted at this node.
+     */
+    ZyanUSize weight;
+    /**
+     * The number of characters stored in this node.
+     */
+    ZyanUSize length;
+    /**
+     * The heap priority of the node.
+     */
+    ZyanU32 priority;
+    /**
+     * The characters stored in this node.
+     */
+    char data[ZYAN_ROPE_CHUNK_SIZE];
+} ZyanRopeNode;
+
+/**
+ * Defines the `ZyanRope` struct.
+ *
+ * The rope splits its content into chunks of up to `ZYAN_ROPE_CHUNK_SIZE` characters, which are
+ * kept in order by a randomized balanced search tree (treap) keyed by character position.
+ * Inserting, deleting and locating text only touches the nodes on a single path, so all of these
+ * operations take `O(log n)` expected time plus the size of the inserted or copied text,
+ * regardless of the position inside the rope.
+ *
+ * Other than `ZyanString`, the content of a rope is not stored in contiguous memory and is not
+ * null-terminated. Use a `ZyanRopeCursor` to iterate over the content, or `ZyanRopeCopy` to copy
+ * parts of the rope to a `ZyanString`.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanRope_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The root node.
+     */
+    ZyanRopeNode* root;
+    /**
+     * The state of the random number generator used for the node priorities.
+     */
+    ZyanU32 seed;
+    /**
+     * A list of unused nodes, linked by their `right` pointers.
+     *
+     * Operations that might have to split nodes reserve all required nodes in advance, so they
+     * can not fail after the tree has been modified.
+     */
+    ZyanRopeNode* spare;
+    /**
+     * The number of unused nodes.
+     */
+    ZyanUSize spare_count;
+} ZyanRope;
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Cursor                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Defines the `ZyanRopeCursor` struct.
+ *
+ * A cursor iterates over the content of a rope, either character by character or chunk by chunk.
+ * Modifying the rope invalidates all of its cursors.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanRopeCursor_
+{
+    /**
+     * The rope.
+     */
+    const ZyanRope* rope;
+    /**
+     * The current position inside the rope.
+     */
+    ZyanUSize position;
+    /**
+     * A pointer to the character at the current position, or `ZYAN_NULL`, if the cursor has not
+     * located the current chunk yet.
+     */
+    const char* data;
+    /**
+     * The number of characters left in the current chunk.
+     */
+    ZyanUSize remaining;
+} ZyanRopeCursor;
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Macros                                                                                         */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* General                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Defines an uninitialized `ZyanRope` instance.
+ */
+#define ZYAN_ROPE_INITIALIZER \
+    { \
+        /* allocator   */ ZYAN_NULL, \
+        /* root        */ ZYAN_NULL, \
+        /* seed        */ 0, \
+        /* spare       */ ZYAN_NULL, \
+        /* spare_count */ 0 \
+    }
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanRope` instance.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the rope nodes is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanRopeDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanRopeInit(ZyanRope* rope);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanRope` instance and sets a custom `allocator`.
+ *
+ * @param   rope        A pointer to the `ZyanRope` instance.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanRopeDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeInitEx(ZyanRope* rope, ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanRope` instance.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeDestroy(ZyanRope* rope);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts the content of the given `source` string at the given `index`.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   index   The insert index.
+ * @param   source  The string to insert.
+ *
+ * @return  A zyan status code.
+ *
+ * The rope is not modified, if the function fails.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeInsert(ZyanRope* rope, ZyanUSize index,
+    const ZyanStringView* source);
+
+/**
+ * Appends the content of the given `source` string to the end of the rope.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   source  The string to append.
+ *
+ * @return  A zyan status code.
+ *
+ * The rope is not modified, if the function fails.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeAppend(ZyanRope* rope, const ZyanStringView* source);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Deletes characters from the rope.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   index   The index of the first character to delete.
+ * @param   count   The number of characters to delete.
+ *
+ * @return  A zyan status code.
+ *
+ * The rope is not modified, if the function fails.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeDelete(ZyanRope* rope, ZyanUSize index, ZyanUSize count);
+
+/**
+ * Erases the content of the rope.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeClear(ZyanRope* rope);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Access                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the character at the given `index`.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   index   The character index.
+ * @param   value   Receives the desired character.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeGetChar(const ZyanRope* rope, ZyanUSize index, char* value);
+
+/**
+ * Appends a range of characters of the rope to the given `destination` string.
+ *
+ * @param   rope        A pointer to the `ZyanRope` instance.
+ * @param   index       The index of the first character to copy.
+ * @param   count       The number of characters to copy.
+ * @param   destination The destination string.
+ *
+ * @return  A zyan status code.
+ *
+ * The `destination` string has to be initialized. Locating the range takes `O(log n)` time,
+ * copying the characters takes `O(count)` time.
+ *
+ * Use `ZyanRopeCopy(rope, 0, size, destination)` to convert the whole rope to a `ZyanString`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeCopy(const ZyanRope* rope, ZyanUSize index, ZyanUSize count,
+    ZyanString* destination);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Cursor                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the given `ZyanRopeCursor` instance.
+ *
+ * @param   cursor  A pointer to the `ZyanRopeCursor` instance.
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   index   The index of the first character the cursor returns.
+ *
+ * @return  A zyan status code.
+ *
+ * The `index` may be equal to the size of the rope, in which case the cursor is at the end of the
+ * rope right away.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeCursorInit(ZyanRopeCursor* cursor, const ZyanRope* rope,
+    ZyanUSize index);
+
+/**
+ * Returns the character at the current cursor position and advances the cursor.
+ *
+ * @param   cursor  A pointer to the `ZyanRopeCursor` instance.
+ * @param   value   Receives the character.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a character was returned, `ZYAN_STATUS_FALSE`, if the cursor is
+ *          at the end of the rope, or another zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeCursorNext(ZyanRopeCursor* cursor, char* value);
+
+/**
+ * Returns the contiguous run of characters at the current cursor position and advances the
+ * cursor past it.
+ *
+ * @param   cursor  A pointer to the `ZyanRopeCursor` instance.
+ * @param   data    Receives a pointer to the first character of the run.
+ * @param   size    Receives the number of characters in the run.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if a run was returned, `ZYAN_STATUS_FALSE`, if the cursor is at the
+ *          end of the rope, or another zyan status code, if an error occurred.
+ *
+ * The run ends at the end of the current chunk and never exceeds `ZYAN_ROPE_CHUNK_SIZE`
+ * characters.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeCursorNextChunk(ZyanRopeCursor* cursor, const char** data,
+    ZyanUSize* size);
+
+/**
+ * Returns the current position of the cursor.
+ *
+ * @param   cursor      A pointer to the `ZyanRopeCursor` instance.
+ * @param   position    Receives the index of the character the cursor returns next.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeCursorGetPosition(const ZyanRopeCursor* cursor,
+    ZyanUSize* position);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the current size (number of characters) of the rope.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   size    Receives the size of the rope.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeGetSize(const ZyanRope* rope, ZyanUSize* size);
+
+/**
+ * Returns the current number of nodes of the rope.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   count   Receives the number of nodes.
+ *
+ * @return  A zyan status code.
+ *
+ * This function walks the whole tree and takes `O(n)` time.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanRopeGetNodeCount(const ZyanRope* rope, ZyanUSize* count);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_ROPE_H */
@@ -80,6 +80,11 @@ typedef ZyanU8 ZyanStringFlags;
  */
 #define ZYAN_STRING_HAS_FIXED_CAPACITY  0x01 // (1 << 0)
 
+/**
+ * The string stores its characters inline, in place of the buffer related fields of its vector.
+ */
+#define ZYAN_STRING_IS_INLINE           0x02 // (1 << 1)
+
 /* ---------------------------------------------------------------------------------------------- */
 /* String                                                                                         */
 /* ---------------------------------------------------------------------------------------------- */
@@ -92,6 +97,12 @@ typedef ZyanU8 ZyanStringFlags;
  * Nevertheless null-termination is guaranteed at all times to provide maximum compatibility with
  * default C-style strings (use `ZyanStringGetData` to access the C-style string).
  *
+ * Short strings created by `ZyanStringInit` or `ZyanStringInitEx` don't allocate any memory.
+ * Their characters are stored inline in place of the vector fields starting at `vector.capacity`
+ * (`ZYAN_STRING_IS_INLINE`), which is why such strings can still be copied or moved in memory
+ * (e.g. as elements of a `ZyanVector`). As soon as the inline storage overflows, the characters
+ * are moved to a dynamically allocated buffer.
+ *
  * All fields in this struct should be considered as "private". Any changes may lead to unexpected
  * behavior.
  */
@@ -119,7 +130,8 @@ typedef struct ZyanString_
  * by design and can't be directly converted to a C-style string.
  *
  * Views might become invalid (e.g. pointing to invalid memory), if the underlying string gets
- * destroyed or resized.
+ * destroyed or resized. Views into inline strings additionally become invalid, if the string is
+ * moved in memory.
  *
  * The `ZYAN_STRING_TO_VIEW` macro can be used to cast a `ZyanString` to a `ZyanStringView` pointer
  * without any runtime overhead.
@@ -165,9 +177,48 @@ typedef struct ZyanStringView_
 
 /**
  * Casts a `ZyanString` pointer to a constant `ZyanStringView` pointer.
+ *
+ * The view shares the flags of the string and thus resolves the location of the characters of
+ * inline strings on each access.
  */
 #define ZYAN_STRING_TO_VIEW(string) (const ZyanStringView*)(string)
 
+/**
+ * Returns a pointer to the inline storage of the given `ZyanString` instance.
+ *
+ * @param   string  A pointer to the `ZyanString` instance.
+ */
+#define ZYAN_STRING_INLINE_DATA(string) \
+    ((char*)&(string)->vector.capacity)
+
+/**
+ * Returns the size of the inline storage of the given `ZyanString` instance (number of
+ * characters, including the terminating '\0').
+ *
+ * @param   string  A pointer to the `ZyanString` instance.
+ */
+#define ZYAN_STRING_INLINE_SIZE(string) \
+    ((ZyanUSize)((const char*)(&(string)->vector + 1) - (const char*)&(string)->vector.capacity))
+
+/**
+ * Returns a pointer to the characters of the given `ZyanString` instance.
+ *
+ * @param   string  A pointer to the `ZyanString` instance (use `&view->string` for views).
+ */
+#define ZYAN_STRING_DATA(string) \
+    (((string)->flags & ZYAN_STRING_IS_INLINE) ? ZYAN_STRING_INLINE_DATA(string) : \
+        (char*)(string)->vector.data)
+
+/**
+ * Returns the size of the character buffer of the given `ZyanString` instance (number of
+ * characters, including the terminating '\0').
+ *
+ * @param   string  A pointer to the `ZyanString` instance.
+ */
+#define ZYAN_STRING_BUFFER_SIZE(string) \
+    (((string)->flags & ZYAN_STRING_IS_INLINE) ? ZYAN_STRING_INLINE_SIZE(string) : \
+        (string)->vector.capacity)
+
 /**
  * Defines a `ZyanStringView` struct that provides a view into a static C-style string.
  *
@@ -181,11 +232,15 @@ typedef struct ZyanStringView_
             /* vector */ \
             { \
                 /* allocator        */ ZYAN_NULL, \
+                /* growth_policy    */ ZYAN_NULL, \
                 /* growth_factor    */ 1, \
                 /* shrink_threshold */ 0, \
+                /* in_small_buffer  */ ZYAN_FALSE, \
                 /* size             */ sizeof(string), \
                 /* capacity         */ sizeof(string), \
                 /* element_size     */ sizeof(char), \
+                /* alignment        */ 0, \
+                /* max_capacity     */ 0, \
                 /* destructor       */ ZYAN_NULL, \
                 /* data             */ (char*)(string) \
             } \
@@ -216,7 +271,8 @@ typedef struct ZyanStringView_
  * growth factor and the default shrink threshold.
  *
  * The allocated buffer will be at least one character larger than the given `capacity`, to reserve
- * space for the terminating '\0'.
+ * space for the terminating '\0'. Strings with a small `capacity` are stored inline and don't
+ * allocate any memory until they outgrow the inline storage.
  *
  * Finalization with `ZyanStringDestroy` is required for all strings created by this function.
  */
@@ -240,7 +296,8 @@ ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanStringInit(ZyanString* string, Z
  * dynamic shrinking.
  *
  * The allocated buffer will be at least one character larger than the given `capacity`, to reserve
- * space for the terminating '\0'.
+ * space for the terminating '\0'. Strings with a small `capacity` are stored inline and don't
+ * allocate any memory until they outgrow the inline storage.
  *
  * Finalization with `ZyanStringDestroy` is required for all strings created by this function.
  */
@@ -298,7 +355,8 @@ ZYCORE_EXPORT ZyanStatus ZyanStringDestroy(ZyanString* string);
  * growth factor and the default shrink threshold.
  *
  * The allocated buffer will be at least one character larger than the given `capacity`, to reserve
- * space for the terminating '\0'.
+ * space for the terminating '\0'. Strings with a small `capacity` are stored inline and don't
+ * allocate any memory until they outgrow the inline storage.
  *
  * Finalization with `ZyanStringDestroy` is required for all strings created by this function.
  */
@@ -330,7 +388,8 @@ ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanStringDuplicate(ZyanString* dest
  * dynamic shrinking.
  *
  * The allocated buffer will be at least one character larger than the given `capacity`, to reserve
- * space for the terminating '\0'.
+ * space for the terminating '\0'. Strings with a small `capacity` are stored inline and don't
+ * allocate any memory until they outgrow the inline storage.
  *
  * Finalization with `ZyanStringDestroy` is required for all strings created by this function.
  */
@@ -390,7 +449,8 @@ ZYCORE_EXPORT ZyanStatus ZyanStringDuplicateCustomBuffer(ZyanString* destination
  * growth factor and the default shrink threshold.
  *
  * The allocated buffer will be at least one character larger than the given `capacity`, to reserve
- * space for the terminating '\0'.
+ * space for the terminating '\0'. Strings with a small `capacity` are stored inline and don't
+ * allocate any memory until they outgrow the inline storage.
  *
  * Finalization with `ZyanStringDestroy` is required for all strings created by this function.
  */
@@ -426,7 +486,8 @@ ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanStringConcat(ZyanString* destina
  * dynamic shrinking.
  *
  * The allocated buffer will be at least one character larger than the given `capacity`, to reserve
- * space for the terminating '\0'.
+ * space for the terminating '\0'. Strings with a small `capacity` are stored inline and don't
+ * allocate any memory until they outgrow the inline storage.
  *
  * Finalization with `ZyanStringDestroy` is required for all strings created by this function.
  */
@@ -966,6 +1027,21 @@ ZYCORE_EXPORT ZyanStatus ZyanStringReserve(ZyanString* string, ZyanUSize capacit
  */
 ZYCORE_EXPORT ZyanStatus ZyanStringShrinkToFit(ZyanString* string);
 
+/**
+ * Sets the growth policy of the given `ZyanString` instance.
+ *
+ * @param   string  A pointer to the `ZyanString` instance.
+ * @param   policy  A pointer to the `ZyanGrowthPolicy` instance or `ZYAN_NULL` to use the growth
+ *                  factor passed at initialization.
+ *
+ * @return  A zyan status code.
+ *
+ * This function will fail, if the `ZYAN_STRING_HAS_FIXED_CAPACITY` flag is set for the specified
+ * `ZyanString` instance.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringSetGrowthPolicy(ZyanString* string,
+    const ZyanGrowthPolicy* policy);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Information                                                                                    */
 /* ---------------------------------------------------------------------------------------------- */
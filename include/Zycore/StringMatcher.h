@@ -0,0 +1,307 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a multi-pattern string matcher.
+ */
+
+#ifndef ZYCORE_STRING_MATCHER_H
+#define ZYCORE_STRING_MATCHER_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/String.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Matcher flags                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Defines the `ZyanStringMatcherFlags` data-type.
+ */
+typedef ZyanU8 ZyanStringMatcherFlags;
+
+/**
+ * The matcher ignores the case of all characters.
+ *
+ * Two characters are considered equal, if they only differ in bit `0x20`, which matches the
+ * behavior of `ZyanStringCompareI`.
+ */
+#define ZYAN_STRING_MATCHER_CASE_INSENSITIVE    0x01 // (1 << 0)
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Matcher                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Defines the `ZyanStringMatch` struct.
+ */
+typedef struct ZyanStringMatch_
+{
+    /**
+     * The index of the pattern that matched.
+     */
+    ZyanUSize pattern;
+    /**
+     * The index of the first character of the match inside the haystack.
+     */
+    ZyanUSize index;
+    /**
+     * The number of characters of the match.
+     */
+    ZyanUSize size;
+} ZyanStringMatch;
+
+/**
+ * Defines the `ZyanStringMatcherCallback` function prototype.
+ *
+ * @param   match       A pointer to the `ZyanStringMatch` struct that describes the match.
+ * @param   user_data   A pointer to user-defined data.
+ *
+ * @return  `ZYAN_STATUS_FALSE` to stop the search, any other success status code to continue or
+ *          an error status code to abort the search.
+ */
+typedef ZyanStatus (*ZyanStringMatcherCallback)(const ZyanStringMatch* match, void* user_data);
+
+/**
+ * Defines the `ZyanStringMatcher` struct.
+ *
+ * The matcher compiles a set of patterns into a deterministic Aho-Corasick automaton. Characters
+ * that do not occur in any pattern share a single character class, so a state only needs one
+ * transition per distinct pattern character. Every transition is a single table lookup, which
+ * makes the cost per haystack character independent of the number of patterns.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanStringMatcher_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * Maps every character to its character class.
+     */
+    ZyanU8 classes[256];
+    /**
+     * The number of character classes.
+     */
+    ZyanUSize class_count;
+    /**
+     * The number of patterns.
+     */
+    ZyanUSize pattern_count;
+    /**
+     * The number of states.
+     */
+    ZyanUSize state_count;
+    /**
+     * The first state that reports matches, multiplied by `class_count`.
+     */
+    ZyanU32 match_state;
+    /**
+     * The transition table. Contains `class_count` entries per state. Every entry holds the
+     * index of the target state, multiplied by `class_count`.
+     */
+    const ZyanU32* transitions;
+    /**
+     * Contains the index of the first entry in `outputs` for every state that reports matches,
+     * followed by the total number of entries.
+     */
+    const ZyanU32* output_offsets;
+    /**
+     * The indices of the patterns that match in every state that reports matches.
+     */
+    const ZyanU32* outputs;
+    /**
+     * The length of every pattern.
+     */
+    const ZyanUSize* sizes;
+    /**
+     * The buffer that holds all tables.
+     */
+    void* buffer;
+    /**
+     * The size of the buffer in bytes.
+     */
+    ZyanUSize buffer_size;
+} ZyanStringMatcher;
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanStringMatcher` instance.
+ *
+ * @param   matcher     A pointer to the `ZyanStringMatcher` instance.
+ * @param   patterns    A pointer to an array of `ZyanStringView` instances that describe the
+ *                      patterns.
+ * @param   count       The number of patterns.
+ * @param   flags       The matcher flags.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory is dynamically allocated by the default allocator.
+ *
+ * Patterns must not be empty. The same pattern may be passed multiple times, in which case every
+ * copy reports its own matches. The matcher does not keep references to the patterns.
+ *
+ * Finalization with `ZyanStringMatcherDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanStringMatcherInit(ZyanStringMatcher* matcher,
+    const ZyanStringView* patterns, ZyanUSize count, ZyanStringMatcherFlags flags);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanStringMatcher` instance and sets a custom `allocator`.
+ *
+ * @param   matcher     A pointer to the `ZyanStringMatcher` instance.
+ * @param   patterns    A pointer to an array of `ZyanStringView` instances that describe the
+ *                      patterns.
+ * @param   count       The number of patterns.
+ * @param   flags       The matcher flags.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanStringMatcherDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringMatcherInitEx(ZyanStringMatcher* matcher,
+    const ZyanStringView* patterns, ZyanUSize count, ZyanStringMatcherFlags flags,
+    ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanStringMatcher` instance.
+ *
+ * @param   matcher A pointer to the `ZyanStringMatcher` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringMatcherDestroy(ZyanStringMatcher* matcher);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Matching                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Reports all occurrences of all patterns in the given `haystack`.
+ *
+ * @param   matcher     A pointer to the `ZyanStringMatcher` instance.
+ * @param   haystack    The string to search in.
+ * @param   callback    The callback that is invoked for every match.
+ * @param   user_data   A pointer to user-defined data that is passed to the callback.
+ *
+ * @return  A zyan status code.
+ *
+ * If the callback returns an error status code, the search is aborted and the status code is
+ * returned by this function.
+ *
+ * Matches are reported in the order of their last character. Overlapping matches are reported
+ * as well. If multiple patterns end at the same character, longer patterns are reported first.
+ *
+ * The matcher is not modified by this function, so multiple threads can search with the same
+ * matcher at the same time.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringMatcherFind(const ZyanStringMatcher* matcher,
+    const ZyanStringView* haystack, ZyanStringMatcherCallback callback, void* user_data);
+
+/**
+ * Appends all occurrences of all patterns in the given `haystack` to a vector.
+ *
+ * @param   matcher     A pointer to the `ZyanStringMatcher` instance.
+ * @param   haystack    The string to search in.
+ * @param   matches     A pointer to a `ZyanVector` instance with `ZyanStringMatch` elements
+ *                      that receives the matches.
+ *
+ * @return  A zyan status code.
+ *
+ * Matches are appended in the same order as reported by `ZyanStringMatcherFind`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringMatcherFindAll(const ZyanStringMatcher* matcher,
+    const ZyanStringView* haystack, ZyanVector* matches);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of states of the automaton.
+ *
+ * @param   matcher A pointer to the `ZyanStringMatcher` instance.
+ * @param   count   Receives the number of states.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringMatcherGetStateCount(const ZyanStringMatcher* matcher,
+    ZyanUSize* count);
+
+/**
+ * Returns the number of character classes of the automaton.
+ *
+ * @param   matcher A pointer to the `ZyanStringMatcher` instance.
+ * @param   count   Receives the number of character classes.
+ *
+ * @return  A zyan status code.
+ *
+ * The transition table holds one entry per state and character class.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringMatcherGetClassCount(const ZyanStringMatcher* matcher,
+    ZyanUSize* count);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_STRING_MATCHER_H */
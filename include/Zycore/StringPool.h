@@ -0,0 +1,276 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a string interning table.
+ */
+
+#ifndef ZYCORE_STRING_POOL_H
+#define ZYCORE_STRING_POOL_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/HashMap.h>
+#include <Zycore/Status.h>
+#include <Zycore/String.h>
+#include <Zycore/Types.h>
+#include <Zycore/Vector.h>
+#ifndef ZYAN_NO_LIBC
+#   include <Zycore/API/Synchronization.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The default size (number of bytes) of a single string pool block.
+ */
+#define ZYAN_STRING_POOL_DEFAULT_BLOCK_SIZE (64 * 1024)
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanStringPoolBlock` struct.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanStringPoolBlock_
+{
+    /**
+     * A pointer to the next block.
+     */
+    struct ZyanStringPoolBlock_* next;
+    /**
+     * The usable size of this block in bytes (not including the block header).
+     */
+    ZyanUSize capacity;
+} ZyanStringPoolBlock;
+
+/**
+ * Defines the `ZyanStringPool` struct.
+ *
+ * The string pool stores a single copy of every distinct string. The characters of all strings
+ * are packed into large blocks that are never moved or freed before the pool is destroyed, so the
+ * views returned by the pool stay valid for the whole lifetime of the pool. Every string is
+ * identified by a small integer ID, which allows comparing interned strings by comparing their
+ * IDs.
+ *
+ * In builds with libc support, all functions are thread-safe. Lookups only acquire a shared lock,
+ * so any number of threads can look up strings at the same time.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanStringPool_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The default size of a single block in bytes.
+     */
+    ZyanUSize block_size;
+    /**
+     * The most recently allocated block.
+     */
+    ZyanStringPoolBlock* blocks;
+    /**
+     * The next free byte inside the current block.
+     */
+    ZyanU8* cursor;
+    /**
+     * The end of the current block.
+     */
+    ZyanU8* end;
+    /**
+     * The interned strings, indexed by their ID.
+     */
+    ZyanVector strings;
+    /**
+     * Maps the contents of the interned strings to their ID.
+     */
+    ZyanHashMap index;
+#ifndef ZYAN_NO_LIBC
+    /**
+     * The lock that protects all other fields.
+     */
+    ZyanReadWriteLock lock;
+#endif
+} ZyanStringPool;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanStringPool` instance.
+ *
+ * @param   pool        A pointer to the `ZyanStringPool` instance.
+ * @param   block_size  The size of a single block in bytes or `0` to use the default block size.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory is dynamically allocated by the default allocator.
+ *
+ * Finalization with `ZyanStringPoolDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanStringPoolInit(ZyanStringPool* pool,
+    ZyanUSize block_size);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanStringPool` instance and sets a custom `allocator`.
+ *
+ * @param   pool        A pointer to the `ZyanStringPool` instance.
+ * @param   block_size  The size of a single block in bytes or `0` to use the default block size.
+ * @param   allocator   A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization with `ZyanStringPoolDestroy` is required for all instances created by this
+ * function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringPoolInitEx(ZyanStringPool* pool, ZyanUSize block_size,
+    ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanStringPool` instance.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All views returned by the pool get invalid.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringPoolDestroy(ZyanStringPool* pool);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Interning                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the ID of the given string and adds it to the pool, if it is not interned yet.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ * @param   string  A pointer to the `ZyanStringView` instance.
+ * @param   id      Receives the ID of the string.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the string was added to the pool, `ZYAN_STATUS_FALSE` if it was
+ *          already interned, or another zyan status code, if an error occurred.
+ *
+ * IDs are assigned sequentially, starting at `0`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringPoolIntern(ZyanStringPool* pool, const ZyanStringView* string,
+    ZyanU32* id);
+
+/**
+ * Returns the ID of the given string and adds it to the pool, if it is not interned yet.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ * @param   data    A pointer to the characters of the string. May be `ZYAN_NULL`, if `size` is
+ *                  `0`.
+ * @param   size    The length of the string.
+ * @param   id      Receives the ID of the string.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the string was added to the pool, `ZYAN_STATUS_FALSE` if it was
+ *          already interned, or another zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringPoolInternBuffer(ZyanStringPool* pool, const char* data,
+    ZyanUSize size, ZyanU32* id);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Searches for the given string without adding it to the pool.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ * @param   string  A pointer to the `ZyanStringView` instance.
+ * @param   id      Receives the ID of the string, if found. May be `ZYAN_NULL`.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the string is interned, `ZYAN_STATUS_FALSE` if not, or another
+ *          zyan status code, if an error occurred.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringPoolFind(ZyanStringPool* pool, const ZyanStringView* string,
+    ZyanU32* id);
+
+/**
+ * Returns a view of the interned string with the given `id`.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ * @param   id      The ID of the string.
+ * @param   view    Receives a view of the string.
+ *
+ * @return  A zyan status code.
+ *
+ * The view stays valid until the pool is destroyed. The viewed characters are followed by a
+ * terminating zero character.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringPoolGetView(ZyanStringPool* pool, ZyanU32 id,
+    ZyanStringView* view);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of strings in the pool.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ * @param   size    Receives the number of interned strings.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanStringPoolGetSize(ZyanStringPool* pool, ZyanUSize* size);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_STRING_POOL_H */
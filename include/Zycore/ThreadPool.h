@@ -0,0 +1,226 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements a pool of worker threads that execute batches of indexed tasks.
+ */
+
+#ifndef ZYCORE_THREAD_POOL_H
+#define ZYCORE_THREAD_POOL_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+#include <Zycore/API/Synchronization.h>
+#include <Zycore/API/Thread.h>
+
+#ifndef ZYAN_NO_LIBC
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanThreadPoolTask` function prototype.
+ *
+ * @param   context A pointer to the user-defined context passed to `ZyanThreadPoolRun`.
+ * @param   index   The index of the task.
+ *
+ * @return  A zyan status code.
+ */
+typedef ZyanStatus (*ZyanThreadPoolTask)(void* context, ZyanUSize index);
+
+/**
+ * Defines the `ZyanThreadPool` struct.
+ *
+ * The pool owns a fixed number of worker threads. Work is submitted in batches of indexed tasks
+ * using `ZyanThreadPoolRun`, which blocks until all tasks of the batch are completed. The calling
+ * thread executes tasks as well, so a pool with `n` worker threads runs up to `n + 1` tasks
+ * concurrently.
+ *
+ * All fields in this struct should be considered as "private". Any changes may lead to unexpected
+ * behavior.
+ */
+typedef struct ZyanThreadPool_
+{
+    /**
+     * The memory allocator.
+     */
+    ZyanAllocator* allocator;
+    /**
+     * The worker threads.
+     */
+    ZyanThread* threads;
+    /**
+     * The number of worker threads.
+     */
+    ZyanUSize thread_count;
+    /**
+     * Serializes concurrent calls to `ZyanThreadPoolRun`.
+     */
+    ZyanCriticalSection run_lock;
+    /**
+     * Protects all of the following fields.
+     */
+    ZyanCriticalSection lock;
+    /**
+     * Signaled when a new batch is submitted or the pool is destroyed.
+     */
+    ZyanConditionVariable work_available;
+    /**
+     * Signaled when the last task of the current batch is completed.
+     */
+    ZyanConditionVariable work_done;
+    /**
+     * The task function of the current batch.
+     */
+    ZyanThreadPoolTask task;
+    /**
+     * The user-defined context of the current batch.
+     */
+    void* context;
+    /**
+     * The number of tasks in the current batch.
+     */
+    ZyanUSize task_count;
+    /**
+     * The index of the next task to execute.
+     */
+    ZyanUSize next_task;
+    /**
+     * The number of tasks that are not completed yet.
+     */
+    ZyanUSize pending_tasks;
+    /**
+     * The status code of the first failed task of the current batch.
+     */
+    ZyanStatus status;
+    /**
+     * Signals the worker threads to exit.
+     */
+    ZyanBool shutdown;
+} ZyanThreadPool;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the given `ZyanThreadPool` instance.
+ *
+ * @param   pool            A pointer to the `ZyanThreadPool` instance.
+ * @param   thread_count    The number of worker threads or `0` to start one worker thread for
+ *                          each logical processor except the one of the calling thread.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the thread handles is allocated using the default allocator.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanThreadPoolInit(ZyanThreadPool* pool,
+    ZyanUSize thread_count);
+
+/**
+ * Initializes the given `ZyanThreadPool` instance and sets a custom `allocator`.
+ *
+ * @param   pool            A pointer to the `ZyanThreadPool` instance.
+ * @param   thread_count    The number of worker threads or `0` to start one worker thread for
+ *                          each logical processor except the one of the calling thread.
+ * @param   allocator       A pointer to a `ZyanAllocator` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolInitEx(ZyanThreadPool* pool, ZyanUSize thread_count,
+    ZyanAllocator* allocator);
+
+/**
+ * Destroys the given `ZyanThreadPool` instance and joins all worker threads.
+ *
+ * @param   pool    A pointer to the `ZyanThreadPool` instance.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolDestroy(ZyanThreadPool* pool);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Execution                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Executes `task` for every index in the range `[0, task_count)` and waits for all tasks to
+ * complete.
+ *
+ * @param   pool        A pointer to the `ZyanThreadPool` instance.
+ * @param   task        The task function.
+ * @param   context     A pointer to a user-defined context that is passed to every task.
+ * @param   task_count  The number of tasks.
+ *
+ * @return  `ZYAN_STATUS_SUCCESS` if all tasks succeeded, the status code of the first failed
+ *          task or a generic zyan status code if an error occurred.
+ *
+ * Tasks are executed in an unspecified order by the worker threads and the calling thread. The
+ * remaining tasks of a batch are still executed, if one of the tasks fails.
+ *
+ * This function must not be called from within a task.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolRun(ZyanThreadPool* pool, ZyanThreadPoolTask task,
+    void* context, ZyanUSize task_count);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of worker threads of the given `ZyanThreadPool` instance.
+ *
+ * @param   pool            A pointer to the `ZyanThreadPool` instance.
+ * @param   thread_count    Receives the number of worker threads.
+ *
+ * @return  A zyan status code.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanThreadPoolGetThreadCount(const ZyanThreadPool* pool,
+    ZyanUSize* thread_count);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYAN_NO_LIBC */
+
+#endif /* ZYCORE_THREAD_POOL_H */
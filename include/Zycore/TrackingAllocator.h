@@ -0,0 +1,219 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * Implements an allocator that records statistics about the requests passed to another allocator.
+ */
+
+#ifndef ZYCORE_TRACKING_ALLOCATOR_H
+#define ZYCORE_TRACKING_ALLOCATOR_H
+
+#include <ZycoreExportConfig.h>
+#include <Zycore/Allocator.h>
+#include <Zycore/Status.h>
+#include <Zycore/Types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================================== */
+/* Constants                                                                                      */
+/* ============================================================================================== */
+
+/**
+ * The number of buckets in the request size histogram.
+ *
+ * Bucket `0` counts zero-sized requests, bucket `i` counts requests with a size in the range of
+ * `[2^(i-1), 2^i)` bytes and the last bucket additionally counts all larger requests.
+ */
+#define ZYAN_TRACKING_HISTOGRAM_SIZE    32
+
+/**
+ * The size of the header that precedes each memory block.
+ *
+ * Memory blocks keep the alignment of the backing allocator up to this value.
+ */
+#define ZYAN_TRACKING_HEADER_SIZE       16
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanTrackingStatistics` struct.
+ *
+ * All sizes are specified in bytes and do not include the block headers of the tracking
+ * allocator.
+ */
+typedef struct ZyanTrackingStatistics_
+{
+    /**
+     * The number of `allocate` requests.
+     */
+    ZyanU64 allocation_count;
+    /**
+     * The number of `reallocate` requests.
+     */
+    ZyanU64 reallocation_count;
+    /**
+     * The number of `reallocate` requests that moved the memory block to a different address.
+     */
+    ZyanU64 reallocation_move_count;
+    /**
+     * The number of `deallocate` requests.
+     */
+    ZyanU64 deallocation_count;
+    /**
+     * The total number of bytes requested by `allocate` and `reallocate`.
+     */
+    ZyanU64 bytes_requested;
+    /**
+     * The number of bytes currently allocated.
+     */
+    ZyanU64 bytes_live;
+    /**
+     * The maximum value of `bytes_live`.
+     */
+    ZyanU64 bytes_peak;
+    /**
+     * The number of bytes copied by `reallocate` requests that moved the memory block.
+     */
+    ZyanU64 bytes_copied;
+    /**
+     * The request size histogram.
+     */
+    ZyanU64 histogram[ZYAN_TRACKING_HISTOGRAM_SIZE];
+} ZyanTrackingStatistics;
+
+/**
+ * Defines the `ZyanTrackingAllocator` struct.
+ *
+ * The tracking allocator forwards all requests to a backing allocator and updates its statistics
+ * using atomic operations. It is thread-safe, if the backing allocator is thread-safe.
+ *
+ * Pass `&tracking.allocator` to the `*InitEx` functions of the container types to track their
+ * memory usage.
+ *
+ * All fields in this struct except `allocator` should be considered as "private". Any changes may
+ * lead to unexpected behavior.
+ */
+typedef struct ZyanTrackingAllocator_
+{
+    /**
+     * The `ZyanAllocator` interface of the tracking allocator.
+     *
+     * This field is required to be the first member of the struct.
+     */
+    ZyanAllocator allocator;
+    /**
+     * The backing allocator.
+     */
+    ZyanAllocator* backing;
+    /**
+     * The statistics.
+     */
+    ZyanTrackingStatistics statistics;
+} ZyanTrackingAllocator;
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanTrackingAllocator` instance.
+ *
+ * @param   tracking    A pointer to the `ZyanTrackingAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All requests are forwarded to the default allocator.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanTrackingInit(ZyanTrackingAllocator* tracking);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanTrackingAllocator` instance and sets a custom backing `allocator`.
+ *
+ * @param   tracking    A pointer to the `ZyanTrackingAllocator` instance.
+ * @param   allocator   A pointer to the `ZyanAllocator` instance that serves all requests.
+ *
+ * @return  A zyan status code.
+ *
+ * Finalization is not required for instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTrackingInitEx(ZyanTrackingAllocator* tracking,
+    ZyanAllocator* allocator);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Statistics                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a snapshot of the statistics of the given tracking allocator.
+ *
+ * @param   tracking    A pointer to the `ZyanTrackingAllocator` instance.
+ * @param   statistics  Receives the statistics.
+ *
+ * @return  A zyan status code.
+ *
+ * Each counter is read atomically, but requests running concurrently on other threads might only
+ * be reflected by some of the counters.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTrackingGetStatistics(const ZyanTrackingAllocator* tracking,
+    ZyanTrackingStatistics* statistics);
+
+/**
+ * Resets the statistics of the given tracking allocator.
+ *
+ * @param   tracking    A pointer to the `ZyanTrackingAllocator` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * All counters are set to zero, except for `bytes_live`, which keeps tracking the memory blocks
+ * that are still allocated. `bytes_peak` is set to the current value of `bytes_live`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanTrackingReset(ZyanTrackingAllocator* tracking);
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZYCORE_TRACKING_ALLOCATOR_H */
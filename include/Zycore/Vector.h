@@ -35,6 +35,7 @@
 #include <ZycoreExportConfig.h>
 #include <Zycore/Allocator.h>
 #include <Zycore/Comparison.h>
+#include <Zycore/GrowthPolicy.h>
 #include <Zycore/Object.h>
 #include <Zycore/Status.h>
 #include <Zycore/Types.h>
@@ -63,10 +64,26 @@ extern "C" {
  */
 #define ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD    4
 
+/**
+ * The default minimum number of elements per range for `ZyanVectorParallelForEach`.
+ */
+#define ZYAN_VECTOR_DEFAULT_PARALLEL_GRAIN_SIZE 4096
+
+/**
+ * Vectors with less elements than this value are sorted on the calling thread by
+ * `ZyanVectorParallelSort`.
+ */
+#define ZYAN_VECTOR_PARALLEL_SORT_THRESHOLD     32768
+
 /* ============================================================================================== */
 /* Enums and types                                                                                */
 /* ============================================================================================== */
 
+// Forward declarations, as `Bitset.h` depends on this header and `ThreadPool.h` is only available
+// if LibC is
+struct ZyanBitset_;
+struct ZyanThreadPool_;
+
 /**
  * Defines the `ZyanVector` struct.
  *
@@ -79,6 +96,10 @@ typedef struct ZyanVector_
      * The memory allocator.
      */
     ZyanAllocator* allocator;
+    /**
+     * The growth policy or `ZYAN_NULL`, if the `growth_factor` is used.
+     */
+    const ZyanGrowthPolicy* growth_policy;
     /**
      * The growth factor.
      */
@@ -87,6 +108,10 @@ typedef struct ZyanVector_
      * The shrink threshold.
      */
     ZyanU8 shrink_threshold;
+    /**
+     * Signals, if the elements are currently stored in the caller-provided small buffer.
+     */
+    ZyanBool in_small_buffer;
     /**
      * The current number of elements in the vector.
      */
@@ -99,6 +124,16 @@ typedef struct ZyanVector_
      * The size of a single element in bytes.
      */
     ZyanUSize element_size;
+    /**
+     * The alignment of the data buffer or `0`, if the default alignment of the allocator is
+     * sufficient.
+     */
+    ZyanUSize alignment;
+    /**
+     * The maximum capacity (number of elements) of the reserved virtual address range or `0`, if
+     * the vector does not use virtual memory.
+     */
+    ZyanUSize max_capacity;
     /**
      * The element destructor callback.
      */
@@ -109,6 +144,29 @@ typedef struct ZyanVector_
     void* data;
 } ZyanVector;
 
+/**
+ * Defines the `ZyanVectorRangeFunction` function prototype.
+ *
+ * @param   elements    A pointer to the first element of the range.
+ * @param   index       The index of the first element of the range.
+ * @param   count       The number of elements in the range.
+ * @param   user_data   A pointer to user-defined data.
+ *
+ * @return  A zyan status code.
+ */
+typedef ZyanStatus (*ZyanVectorRangeFunction)(void* elements, ZyanUSize index, ZyanUSize count,
+    void* user_data);
+
+/**
+ * Defines the `ZyanVectorPredicate` function prototype.
+ *
+ * @param   element     A pointer to the element.
+ * @param   user_data   A pointer to user-defined data.
+ *
+ * @return  `ZYAN_TRUE`, if the element matches the predicate or `ZYAN_FALSE`, if not.
+ */
+typedef ZyanBool (*ZyanVectorPredicate)(const void* element, void* user_data);
+
 /* ============================================================================================== */
 /* Macros                                                                                         */
 /* ============================================================================================== */
@@ -123,15 +181,36 @@ typedef struct ZyanVector_
 #define ZYAN_VECTOR_INITIALIZER \
     { \
         /* allocator        */ ZYAN_NULL, \
+        /* growth_policy    */ ZYAN_NULL, \
         /* growth_factor    */ 0, \
         /* shrink_threshold */ 0, \
+        /* in_small_buffer  */ ZYAN_FALSE, \
         /* size             */ 0, \
         /* capacity         */ 0, \
         /* element_size     */ 0, \
+        /* alignment        */ 0, \
+        /* max_capacity     */ 0, \
         /* destructor       */ ZYAN_NULL, \
         /* data             */ ZYAN_NULL \
     }
 
+/**
+ * Declares a struct type that embeds a `ZyanVector` together with an inline small buffer.
+ *
+ * @param   name        The name of the struct type.
+ * @param   type        The element type.
+ * @param   capacity    The capacity (number of elements) of the small buffer.
+ *
+ * Pass `&instance.vector` and `instance.buffer` to `ZyanVectorInitSmallBuffer` to initialize the
+ * vector. The instance must not be moved in memory while the vector uses the small buffer.
+ */
+#define ZYAN_DECLARE_SMALL_VECTOR(name, type, capacity) \
+    typedef struct name##_ \
+    { \
+        ZyanVector vector; \
+        type buffer[capacity]; \
+    } name
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Helper macros                                                                                  */
 /* ---------------------------------------------------------------------------------------------- */
@@ -199,6 +278,299 @@ typedef struct ZyanVector_
         } \
     }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Typed search functions                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Declares a typed function that sequentially searches for the first occurrence of a `value` in a
+ * vector of integral elements.
+ *
+ * @param   name    The name of the function.
+ * @param   type    The name of the integral data-type.
+ *
+ * The declared function has the signature `ZyanISize name(const ZyanVector* vector, type value)`
+ * and returns the index of the first matching element or `-1`, if no element matches.
+ *
+ * The comparison is inlined into the generated function, which avoids the indirect call per
+ * element that `ZyanVectorFind` has to make.
+ */
+#define ZYAN_DECLARE_VECTOR_FIND(name, type) \
+    ZyanISize name(const ZyanVector* vector, type value) \
+    { \
+        ZYAN_ASSERT(vector); \
+        ZYAN_ASSERT(vector->element_size == sizeof(type)); \
+        \
+        const type* const elements = (const type*)vector->data; \
+        for (ZyanUSize i = 0; i < vector->size; ++i) \
+        { \
+            if (elements[i] == value) \
+            { \
+                return (ZyanISize)i; \
+            } \
+        } \
+        return -1; \
+    }
+
+/**
+ * Declares a typed function that sequentially searches for the first element of a vector of
+ * structs whose integral `field_name` equals a given `value`.
+ *
+ * @param   name        The name of the function.
+ * @param   type        The name of the struct data-type.
+ * @param   key_type    The name of the integral data-type of the struct field.
+ * @param   field_name  The name of the struct field.
+ *
+ * The declared function has the signature
+ * `ZyanISize name(const ZyanVector* vector, key_type value)` and returns the index of the first
+ * matching element or `-1`, if no element matches.
+ */
+#define ZYAN_DECLARE_VECTOR_FIND_FOR_FIELD(name, type, key_type, field_name) \
+    ZyanISize name(const ZyanVector* vector, key_type value) \
+    { \
+        ZYAN_ASSERT(vector); \
+        ZYAN_ASSERT(vector->element_size == sizeof(type)); \
+        \
+        const type* const elements = (const type*)vector->data; \
+        for (ZyanUSize i = 0; i < vector->size; ++i) \
+        { \
+            if (elements[i].field_name == value) \
+            { \
+                return (ZyanISize)i; \
+            } \
+        } \
+        return -1; \
+    }
+
+/**
+ * Declares a typed function that returns the index of the first element of a sorted vector of
+ * integral elements that is not less than a given `value`.
+ *
+ * @param   name    The name of the function.
+ * @param   type    The name of the integral data-type.
+ *
+ * The declared function has the signature `ZyanUSize name(const ZyanVector* vector, type value)`
+ * and returns `vector->size`, if all elements are less than `value`.
+ *
+ * The search is branchless: the next probe is selected by a conditional move instead of a
+ * (frequently mispredicted) branch, and both candidates for the probe after it are prefetched.
+ */
+#define ZYAN_DECLARE_VECTOR_LOWER_BOUND(name, type) \
+    ZyanUSize name(const ZyanVector* vector, type value) \
+    { \
+        ZYAN_ASSERT(vector); \
+        ZYAN_ASSERT(vector->element_size == sizeof(type)); \
+        \
+        const type* const elements = (const type*)vector->data; \
+        const type* base = elements; \
+        ZyanUSize n = vector->size; \
+        if (!n) \
+        { \
+            return 0; \
+        } \
+        while (n > 1) \
+        { \
+            const ZyanUSize half = n >> 1; \
+            ZYAN_PREFETCH(base + (half >> 1)); \
+            ZYAN_PREFETCH(base + half + (half >> 1)); \
+            base = (base[half] < value) ? base + half : base; \
+            n -= half; \
+        } \
+        return (ZyanUSize)(base - elements) + ((base[0] < value) ? 1 : 0); \
+    }
+
+/**
+ * Declares a typed function that returns the index of the first element of a vector of structs,
+ * sorted by the integral `field_name`, whose field is not less than a given `value`.
+ *
+ * @param   name        The name of the function.
+ * @param   type        The name of the struct data-type.
+ * @param   key_type    The name of the integral data-type of the struct field.
+ * @param   field_name  The name of the struct field.
+ *
+ * The declared function has the signature
+ * `ZyanUSize name(const ZyanVector* vector, key_type value)` and returns `vector->size`, if all
+ * fields are less than `value`.
+ */
+#define ZYAN_DECLARE_VECTOR_LOWER_BOUND_FOR_FIELD(name, type, key_type, field_name) \
+    ZyanUSize name(const ZyanVector* vector, key_type value) \
+    { \
+        ZYAN_ASSERT(vector); \
+        ZYAN_ASSERT(vector->element_size == sizeof(type)); \
+        \
+        const type* const elements = (const type*)vector->data; \
+        const type* base = elements; \
+        ZyanUSize n = vector->size; \
+        if (!n) \
+        { \
+            return 0; \
+        } \
+        while (n > 1) \
+        { \
+            const ZyanUSize half = n >> 1; \
+            ZYAN_PREFETCH(base + (half >> 1)); \
+            ZYAN_PREFETCH(base + half + (half >> 1)); \
+            base = (base[half].field_name < value) ? base + half : base; \
+            n -= half; \
+        } \
+        return (ZyanUSize)(base - elements) + ((base[0].field_name < value) ? 1 : 0); \
+    }
+
+/**
+ * Declares a typed function that returns the index of the first element of a sorted vector of
+ * integral elements that is greater than a given `value`.
+ *
+ * @param   name    The name of the function.
+ * @param   type    The name of the integral data-type.
+ *
+ * The declared function has the signature `ZyanUSize name(const ZyanVector* vector, type value)`
+ * and returns `vector->size`, if no element is greater than `value`.
+ */
+#define ZYAN_DECLARE_VECTOR_UPPER_BOUND(name, type) \
+    ZyanUSize name(const ZyanVector* vector, type value) \
+    { \
+        ZYAN_ASSERT(vector); \
+        ZYAN_ASSERT(vector->element_size == sizeof(type)); \
+        \
+        const type* const elements = (const type*)vector->data; \
+        const type* base = elements; \
+        ZyanUSize n = vector->size; \
+        if (!n) \
+        { \
+            return 0; \
+        } \
+        while (n > 1) \
+        { \
+            const ZyanUSize half = n >> 1; \
+            ZYAN_PREFETCH(base + (half >> 1)); \
+            ZYAN_PREFETCH(base + half + (half >> 1)); \
+            base = (value < base[half]) ? base : base + half; \
+            n -= half; \
+        } \
+        return (ZyanUSize)(base - elements) + ((value < base[0]) ? 0 : 1); \
+    }
+
+/**
+ * Declares a typed function that returns the index of the first element of a vector of structs,
+ * sorted by the integral `field_name`, whose field is greater than a given `value`.
+ *
+ * @param   name        The name of the function.
+ * @param   type        The name of the struct data-type.
+ * @param   key_type    The name of the integral data-type of the struct field.
+ * @param   field_name  The name of the struct field.
+ *
+ * The declared function has the signature
+ * `ZyanUSize name(const ZyanVector* vector, key_type value)` and returns `vector->size`, if no
+ * field is greater than `value`.
+ */
+#define ZYAN_DECLARE_VECTOR_UPPER_BOUND_FOR_FIELD(name, type, key_type, field_name) \
+    ZyanUSize name(const ZyanVector* vector, key_type value) \
+    { \
+        ZYAN_ASSERT(vector); \
+        ZYAN_ASSERT(vector->element_size == sizeof(type)); \
+        \
+        const type* const elements = (const type*)vector->data; \
+        const type* base = elements; \
+        ZyanUSize n = vector->size; \
+        if (!n) \
+        { \
+            return 0; \
+        } \
+        while (n > 1) \
+        { \
+            const ZyanUSize half = n >> 1; \
+            ZYAN_PREFETCH(base + (half >> 1)); \
+            ZYAN_PREFETCH(base + half + (half >> 1)); \
+            base = (value < base[half].field_name) ? base : base + half; \
+            n -= half; \
+        } \
+        return (ZyanUSize)(base - elements) + ((value < base[0].field_name) ? 0 : 1); \
+    }
+
+/**
+ * Declares a typed binary-search function for a sorted vector of integral elements.
+ *
+ * @param   name    The name of the function.
+ * @param   type    The name of the integral data-type.
+ *
+ * The declared function has the signature
+ * `ZyanBool name(const ZyanVector* vector, type value, ZyanUSize* found_index)` and returns
+ * `ZYAN_TRUE`, if the `value` was found. Like `ZyanVectorBinarySearch`, `found_index` receives the
+ * index of the first matching element or the index of the first element larger than `value`.
+ *
+ * The search is branchless, see `ZYAN_DECLARE_VECTOR_LOWER_BOUND`.
+ */
+#define ZYAN_DECLARE_VECTOR_BINARY_SEARCH(name, type) \
+    ZyanBool name(const ZyanVector* vector, type value, ZyanUSize* found_index) \
+    { \
+        ZYAN_ASSERT(vector); \
+        ZYAN_ASSERT(vector->element_size == sizeof(type)); \
+        ZYAN_ASSERT(found_index); \
+        \
+        const type* const elements = (const type*)vector->data; \
+        const type* base = elements; \
+        ZyanUSize n = vector->size; \
+        if (!n) \
+        { \
+            *found_index = 0; \
+            return ZYAN_FALSE; \
+        } \
+        while (n > 1) \
+        { \
+            const ZyanUSize half = n >> 1; \
+            ZYAN_PREFETCH(base + (half >> 1)); \
+            ZYAN_PREFETCH(base + half + (half >> 1)); \
+            base = (base[half] < value) ? base + half : base; \
+            n -= half; \
+        } \
+        const ZyanUSize l = (ZyanUSize)(base - elements) + ((base[0] < value) ? 1 : 0); \
+        *found_index = l; \
+        return ((l < vector->size) && (elements[l] == value)) ? ZYAN_TRUE : ZYAN_FALSE; \
+    }
+
+/**
+ * Declares a typed binary-search function for a vector of structs, sorted by the integral
+ * `field_name`.
+ *
+ * @param   name        The name of the function.
+ * @param   type        The name of the struct data-type.
+ * @param   key_type    The name of the integral data-type of the struct field.
+ * @param   field_name  The name of the struct field.
+ *
+ * The declared function has the signature
+ * `ZyanBool name(const ZyanVector* vector, key_type value, ZyanUSize* found_index)` and returns
+ * `ZYAN_TRUE`, if an element with a matching field was found. Like `ZyanVectorBinarySearch`,
+ * `found_index` receives the index of the first matching element or the index of the first
+ * element with a larger field.
+ */
+#define ZYAN_DECLARE_VECTOR_BINARY_SEARCH_FOR_FIELD(name, type, key_type, field_name) \
+    ZyanBool name(const ZyanVector* vector, key_type value, ZyanUSize* found_index) \
+    { \
+        ZYAN_ASSERT(vector); \
+        ZYAN_ASSERT(vector->element_size == sizeof(type)); \
+        ZYAN_ASSERT(found_index); \
+        \
+        const type* const elements = (const type*)vector->data; \
+        const type* base = elements; \
+        ZyanUSize n = vector->size; \
+        if (!n) \
+        { \
+            *found_index = 0; \
+            return ZYAN_FALSE; \
+        } \
+        while (n > 1) \
+        { \
+            const ZyanUSize half = n >> 1; \
+            ZYAN_PREFETCH(base + (half >> 1)); \
+            ZYAN_PREFETCH(base + half + (half >> 1)); \
+            base = (base[half].field_name < value) ? base + half : base; \
+            n -= half; \
+        } \
+        const ZyanUSize l = (ZyanUSize)(base - elements) + ((base[0].field_name < value) ? 1 : 0); \
+        *found_index = l; \
+        return ((l < vector->size) && (elements[l].field_name == value)) ? ZYAN_TRUE : ZYAN_FALSE; \
+    }
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -256,6 +628,62 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorInitEx(ZyanVector* vector, ZyanUSize element_
     ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator,
     ZyanU8 growth_factor, ZyanU8 shrink_threshold);
 
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanVector` instance and guarantees a specific alignment for its data
+ * buffer.
+ *
+ * @param   vector          A pointer to the `ZyanVector` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   capacity        The initial capacity (number of elements).
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ * @param   alignment       The alignment of the data buffer. Must be a power of two.
+ *
+ * @return  A zyan status code.
+ *
+ * The memory for the vector elements is dynamically allocated by the default allocator using the
+ * default growth factor and the default shrink threshold.
+ *
+ * Finalization with `ZyanVectorDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorInitAligned(ZyanVector* vector,
+    ZyanUSize element_size, ZyanUSize capacity, ZyanMemberProcedure destructor,
+    ZyanUSize alignment);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanVector` instance, sets a custom `allocator` and memory
+ * allocation/deallocation parameters and guarantees a specific alignment for its data buffer.
+ *
+ * @param   vector              A pointer to the `ZyanVector` instance.
+ * @param   element_size        The size of a single element in bytes.
+ * @param   capacity            The initial capacity (number of elements).
+ * @param   destructor          A destructor callback that is invoked every time an item is deleted,
+ *                              or `ZYAN_NULL` if not needed.
+ * @param   allocator           A pointer to a `ZyanAllocator` instance.
+ * @param   growth_factor       The growth factor.
+ * @param   shrink_threshold    The shrink threshold.
+ * @param   alignment           The alignment of the data buffer. Must be a power of two or `0` to
+ *                              use the default alignment of the `allocator`.
+ *
+ * @return  A zyan status code.
+ *
+ * The data buffer is (re-)allocated by `ZyanAllocatorAllocateAligned` and
+ * `ZyanAllocatorReallocateAligned`, which fall back to manual alignment, if the `allocator` does
+ * not implement the aligned functions.
+ *
+ * A growth factor of `1` disables overallocation and a shrink threshold of `0` disables
+ * dynamic shrinking.
+ *
+ * Finalization with `ZyanVectorDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorInitAlignedEx(ZyanVector* vector, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold, ZyanUSize alignment);
+
 /**
  * Initializes the given `ZyanVector` instance and configures it to use a custom user
  * defined buffer with a fixed size.
@@ -274,6 +702,89 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorInitEx(ZyanVector* vector, ZyanUSize element_
 ZYCORE_EXPORT ZyanStatus ZyanVectorInitCustomBuffer(ZyanVector* vector, ZyanUSize element_size,
     void* buffer, ZyanUSize capacity, ZyanMemberProcedure destructor);
 
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanVector` instance and configures it to use a small buffer for the
+ * first elements.
+ *
+ * @param   vector          A pointer to the `ZyanVector` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   buffer          A pointer to the small buffer that is used as initial storage for the
+ *                          elements.
+ * @param   capacity        The capacity (number of elements) of the small buffer.
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * As soon as the small buffer overflows, the elements are moved to a buffer that is dynamically
+ * allocated by the default allocator using the default growth factor and the default shrink
+ * threshold.
+ *
+ * Finalization with `ZyanVectorDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorInitSmallBuffer(ZyanVector* vector,
+    ZyanUSize element_size, void* buffer, ZyanUSize capacity, ZyanMemberProcedure destructor);
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanVector` instance, configures it to use a small buffer for the first
+ * elements and sets a custom `allocator` and memory allocation/deallocation parameters.
+ *
+ * @param   vector              A pointer to the `ZyanVector` instance.
+ * @param   element_size        The size of a single element in bytes.
+ * @param   buffer              A pointer to the small buffer that is used as initial storage for
+ *                              the elements.
+ * @param   capacity            The capacity (number of elements) of the small buffer.
+ * @param   destructor          A destructor callback that is invoked every time an item is deleted,
+ *                              or `ZYAN_NULL` if not needed.
+ * @param   allocator           A pointer to a `ZyanAllocator` instance.
+ * @param   growth_factor       The growth factor.
+ * @param   shrink_threshold    The shrink threshold.
+ *
+ * @return  A zyan status code.
+ *
+ * As soon as the small buffer overflows, the elements are moved to a buffer that is dynamically
+ * allocated by the given `allocator`. The vector never moves back to the small buffer.
+ *
+ * Finalization with `ZyanVectorDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorInitSmallBufferEx(ZyanVector* vector, ZyanUSize element_size,
+    void* buffer, ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold);
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Initializes the given `ZyanVector` instance and configures it to use a reserved range of the
+ * virtual address space as storage for the elements.
+ *
+ * @param   vector          A pointer to the `ZyanVector` instance.
+ * @param   element_size    The size of a single element in bytes.
+ * @param   capacity        The initial capacity (number of elements).
+ * @param   max_capacity    The maximum capacity (number of elements) of the vector.
+ * @param   destructor      A destructor callback that is invoked every time an item is deleted, or
+ *                          `ZYAN_NULL` if not needed.
+ *
+ * @return  A zyan status code.
+ *
+ * Address space for `max_capacity` elements is reserved up front, but physical memory is only
+ * committed as the vector grows. The data buffer never moves, which means growing the vector does
+ * not copy any elements and pointers to the elements stay valid until they are removed.
+ *
+ * Operations that exceed `max_capacity` fail with `ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE`. Memory
+ * is not decommitted automatically, but `ZyanVectorShrinkToFit` releases all unused pages.
+ *
+ * Finalization with `ZyanVectorDestroy` is required for all instances created by this function.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorInitVirtual(ZyanVector* vector,
+    ZyanUSize element_size, ZyanUSize capacity, ZyanUSize max_capacity,
+    ZyanMemberProcedure destructor);
+
+#endif // ZYAN_NO_LIBC
+
 /**
  * Destroys the given `ZyanVector` instance.
  *
@@ -327,6 +838,8 @@ ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorDuplicate(ZyanVector* dest
  *
  * @return  A zyan status code.
  *
+ * The alignment of the `source` vector data buffer is preserved.
+ *
  * A growth factor of `1` disables overallocation and a shrink threshold of `0` disables
  * dynamic shrinking.
  *
@@ -448,6 +961,49 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorSet(ZyanVector* vector, ZyanUSize index,
  */
 ZYCORE_EXPORT ZyanStatus ZyanVectorPushBack(ZyanVector* vector, const void* element);
 
+/**
+ * Adds multiple `elements` to the end of the vector.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   elements    A pointer to the first element.
+ * @param   count       The number of elements to add.
+ *
+ * @return  A zyan status code.
+ *
+ * The vector grows at most once, no matter how many elements are added.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorPushBackRange(ZyanVector* vector, const void* elements,
+    ZyanUSize count);
+
+/**
+ * Grows the vector by `count` elements without initializing them.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   count       The number of elements to append.
+ * @param   elements    Receives a pointer to the first new element.
+ *
+ * @return  A zyan status code.
+ *
+ * The new elements are in undefined state and have to be initialized by the caller. The returned
+ * pointer is only valid until the next operation that changes the capacity of the vector.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorAppendUninitialized(ZyanVector* vector, ZyanUSize count,
+    void** elements);
+
+/**
+ * Adds all elements of the `source` vector to the end of the `destination` vector.
+ *
+ * @param   destination A pointer to the destination `ZyanVector` instance.
+ * @param   source      A pointer to the source `ZyanVector` instance.
+ *
+ * @return  A zyan status code.
+ *
+ * Both vectors must have the same element size. The elements are copied bitwise and it's valid to
+ * append a vector to itself.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorAppendVector(ZyanVector* destination,
+    const ZyanVector* source);
+
 /**
  * Inserts an `element` at the given `index` of the vector.
  *
@@ -545,6 +1101,36 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorDelete(ZyanVector* vector, ZyanUSize index);
 ZYCORE_EXPORT ZyanStatus ZyanVectorDeleteRange(ZyanVector* vector, ZyanUSize index,
     ZyanUSize count);
 
+/**
+ * Deletes the element at the given `index` by replacing it with the last element of the vector.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   index   The index of the element to delete.
+ *
+ * @return  A zyan status code.
+ *
+ * This function runs in constant time, but does not preserve the order of the elements.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorDeleteSwapBack(ZyanVector* vector, ZyanUSize index);
+
+/**
+ * Deletes all elements that match the given predicate.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   predicate   The predicate function.
+ * @param   user_data   A pointer to user-defined data that is passed to the predicate.
+ * @param   count       Receives the number of deleted elements. This parameter is optional and
+ *                      might be `ZYAN_NULL`.
+ *
+ * @return  A zyan status code.
+ *
+ * The predicate is invoked exactly once for every element, in order. The remaining elements keep
+ * their order and are compacted in a single pass, so the function runs in linear time regardless
+ * of the number of deleted elements. The destructor callback is invoked for all deleted elements.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorRemoveIf(ZyanVector* vector, ZyanVectorPredicate predicate,
+    void* user_data, ZyanUSize* count);
+
 /**
  * Removes the last element of the vector.
  *
@@ -601,6 +1187,60 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorFind(const ZyanVector* vector, const void* el
 ZYCORE_EXPORT ZyanStatus ZyanVectorFindEx(const ZyanVector* vector, const void* element,
     ZyanISize* found_index, ZyanEqualityComparison comparison, ZyanUSize index, ZyanUSize count);
 
+/**
+ * Sequentially searches for the first element in the given vector that is byte-wise equal to
+ * `element`.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   element     A pointer to the element to search for.
+ * @param   found_index A pointer to a variable that receives the index of the found element.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was found, `ZYAN_STATUS_FALSE` if not or a generic
+ *          zyan status code if an error occurred.
+ *
+ * The `found_index` is set to `-1`, if the element was not found.
+ *
+ * For element sizes of 1, 2, 4 and 8 bytes, the elements are compared using SSE2 or AVX2
+ * instructions, depending on the capabilities of the processor. This is much faster than
+ * `ZyanVectorFind`, but must only be used for element types that do not contain padding bytes.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorFindBytes(const ZyanVector* vector, const void* element,
+    ZyanISize* found_index);
+
+/**
+ * Sequentially searches for the first element in the given vector that is byte-wise equal to
+ * `element`.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   element     A pointer to the element to search for.
+ * @param   found_index A pointer to a variable that receives the index of the found element.
+ * @param   index       The start index.
+ * @param   count       The maximum number of elements to iterate, beginning from the start `index`.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the element was found, `ZYAN_STATUS_FALSE` if not or a generic
+ *          zyan status code if an error occurred.
+ *
+ * The `found_index` is set to `-1`, if the element was not found.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorFindBytesEx(const ZyanVector* vector, const void* element,
+    ZyanISize* found_index, ZyanUSize index, ZyanUSize count);
+
+/**
+ * Finds all elements in the given vector that are byte-wise equal to `element`.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   element A pointer to the element to search for.
+ * @param   matches A pointer to a `ZyanBitset` instance with at least `vector->size` bits. Bit `n`
+ *                  is set, if the `n`-th element matches. All other bits are reset.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if at least one element was found, `ZYAN_STATUS_FALSE` if not or a
+ *          generic zyan status code if an error occurred.
+ *
+ * The elements are compared like in `ZyanVectorFindBytes`.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorFindAllBytes(const ZyanVector* vector, const void* element,
+    struct ZyanBitset_* matches);
+
 /**
  * Searches for the first occurrence of `element` in the given vector using a binary-
  * search algorithm.
@@ -639,10 +1279,121 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorBinarySearch(const ZyanVector* vector, const
  * contains the index of the first entry larger than `element`.
  *
  * This function requires all elements in the vector to be strictly ordered (sorted).
+ *
+ * The comparison function is called through a pointer for every probe. Use the search functions
+ * generated by `ZYAN_DECLARE_VECTOR_BINARY_SEARCH` for hot lookups, or build a
+ * `ZyanEytzingerIndex` for repeated lookups in large vectors.
  */
 ZYCORE_EXPORT ZyanStatus ZyanVectorBinarySearchEx(const ZyanVector* vector, const void* element,
     ZyanUSize* found_index, ZyanComparison comparison, ZyanUSize index, ZyanUSize count);
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Sorting                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Sorts all elements of the given vector.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   comparison  The comparison function to use.
+ *
+ * @return  A zyan status code.
+ *
+ * The elements are sorted in ascending order using an introsort algorithm. The sort is not stable.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorSort(ZyanVector* vector, ZyanComparison comparison);
+
+/**
+ * Sorts a range of elements of the given vector.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   comparison  The comparison function to use.
+ * @param   index       The start index.
+ * @param   count       The number of elements to sort, beginning from the start `index`.
+ *
+ * @return  A zyan status code.
+ *
+ * The elements are sorted in ascending order using an introsort algorithm. The sort is not stable.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorSortEx(ZyanVector* vector, ZyanComparison comparison,
+    ZyanUSize index, ZyanUSize count);
+
+/**
+ * Sorts all elements of the given vector by an integral key field.
+ *
+ * @param   vector          A pointer to the `ZyanVector` instance.
+ * @param   key_offset      The offset of the key field inside of an element.
+ * @param   key_size        The size of the key field in bytes (`1`, `2`, `4` or `8`).
+ * @param   key_is_signed   `ZYAN_TRUE`, if the key is a signed integer or `ZYAN_FALSE`, if not.
+ *
+ * @return  A zyan status code.
+ *
+ * The elements are sorted in ascending order of their keys using a stable LSD radix sort, which
+ * does not call a comparison function at all. Key bytes that are equal for all elements are
+ * skipped.
+ *
+ * The function temporarily allocates a buffer of the size of the vector. The allocator of the
+ * vector is used for this, or the default allocator, if the vector uses a custom buffer.
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorSortByKey(ZyanVector* vector, ZyanUSize key_offset,
+    ZyanUSize key_size, ZyanBool key_is_signed);
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Parallel algorithms                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Sorts all elements of the given vector using the worker threads of the given thread pool.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   pool        A pointer to the `ZyanThreadPool` instance.
+ * @param   comparison  The comparison function to use.
+ *
+ * @return  A zyan status code.
+ *
+ * The vector is split into one run per thread, which are sorted concurrently. The runs are then
+ * merged pairwise. Each merge is split into independent parts of equal size, so all threads are
+ * busy during every merge pass. The sort is not stable.
+ *
+ * Vectors with less than `ZYAN_VECTOR_PARALLEL_SORT_THRESHOLD` elements and pools without worker
+ * threads fall back to `ZyanVectorSort`.
+ *
+ * The function temporarily allocates a buffer of the size of the vector. The allocator of the
+ * vector is used for this, or the default allocator, if the vector uses a custom buffer.
+ *
+ * The comparison function is invoked concurrently from multiple threads.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorParallelSort(ZyanVector* vector,
+    struct ZyanThreadPool_* pool, ZyanComparison comparison);
+
+/**
+ * Invokes the given function for consecutive ranges of elements of the given vector, using the
+ * worker threads of the given thread pool.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   pool        A pointer to the `ZyanThreadPool` instance.
+ * @param   grain_size  The minimum number of elements per range or `0` to use
+ *                      `ZYAN_VECTOR_DEFAULT_PARALLEL_GRAIN_SIZE`.
+ * @param   function    The function to invoke for each range.
+ * @param   user_data   A pointer to user-defined data that is passed to the function.
+ *
+ * @return  `ZYAN_STATUS_SUCCESS` if all invocations succeeded, the status code of the first
+ *          failed invocation or a generic zyan status code if an error occurred.
+ *
+ * The ranges do not overlap and together cover all elements of the vector. The vector is
+ * processed as a single range on the calling thread, if it has less than `2 * grain_size`
+ * elements or if the pool has no worker threads.
+ *
+ * The function must not add or remove elements of the vector.
+ */
+ZYCORE_EXPORT ZYAN_REQUIRES_LIBC ZyanStatus ZyanVectorParallelForEach(ZyanVector* vector,
+    struct ZyanThreadPool_* pool, ZyanUSize grain_size, ZyanVectorRangeFunction function,
+    void* user_data);
+
+#endif // ZYAN_NO_LIBC
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Memory management                                                                              */
 /* ---------------------------------------------------------------------------------------------- */
@@ -688,6 +1439,24 @@ ZYCORE_EXPORT ZyanStatus ZyanVectorReserve(ZyanVector* vector, ZyanUSize capacit
  */
 ZYCORE_EXPORT ZyanStatus ZyanVectorShrinkToFit(ZyanVector* vector);
 
+/**
+ * Sets the growth policy of the given `ZyanVector` instance.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   policy  A pointer to the `ZyanGrowthPolicy` instance or `ZYAN_NULL` to use the growth
+ *                  factor passed at initialization.
+ *
+ * @return  A zyan status code.
+ *
+ * The policy calculates the new capacity every time the vector grows beyond its capacity or
+ * shrinks below its shrink threshold. The policy instance must stay valid while it is in use.
+ *
+ * This function fails with `ZYAN_STATUS_INVALID_OPERATION` for vectors that do not use a dynamic
+ * allocator (custom buffer and virtual memory vectors).
+ */
+ZYCORE_EXPORT ZyanStatus ZyanVectorSetGrowthPolicy(ZyanVector* vector,
+    const ZyanGrowthPolicy* policy);
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Information                                                                                    */
 /* ---------------------------------------------------------------------------------------------- */
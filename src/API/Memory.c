@@ -32,10 +32,34 @@
 
 #elif defined(ZYAN_POSIX)
 #   include <unistd.h>
+#   if defined(ZYAN_LINUX)
+#       include <stdio.h>
+#   endif
 #else
 #   error "Unsupported platform detected"
 #endif
 
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+#if defined(ZYAN_POSIX)
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#   define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/**
+ * The `mmap` flags used to reserve address space without committing physical memory.
+ */
+#ifdef MAP_NORESERVE
+#   define ZYCORE_MEMORY_RESERVE_FLAGS (MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE)
+#else
+#   define ZYCORE_MEMORY_RESERVE_FLAGS (MAP_PRIVATE | MAP_ANONYMOUS)
+#endif
+
+#endif
+
 /* ============================================================================================== */
 /* Exported functions                                                                             */
 /* ============================================================================================== */
@@ -76,10 +100,250 @@ ZyanU32 ZyanMemoryGetSystemAllocationGranularity()
 #endif
 }
 
+ZyanU32 ZyanMemoryGetSystemHugePageSize()
+{
+#if defined(ZYAN_WINDOWS)
+
+    return (ZyanU32)GetLargePageMinimum();
+
+#elif defined(ZYAN_LINUX)
+
+    // The value is parsed only once. Concurrent first calls might both parse it, which is harmless
+    // as they store the same value
+    static volatile ZyanU32 huge_page_size = ZYAN_UINT32_MAX;
+
+    ZyanU32 result = huge_page_size;
+    if (result != ZYAN_UINT32_MAX)
+    {
+        return result;
+    }
+
+    result = 0;
+    FILE* const file = fopen("/proc/meminfo", "r");
+    if (file)
+    {
+        char line[128];
+        while (fgets(line, sizeof(line), file))
+        {
+            unsigned long size;
+            if (sscanf(line, "Hugepagesize: %lu kB", &size) == 1)
+            {
+                result = (ZyanU32)(size * 1024);
+                break;
+            }
+        }
+        fclose(file);
+    }
+    huge_page_size = result;
+
+    return result;
+
+#elif defined(ZYAN_POSIX)
+
+    return 0;
+
+#endif
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Memory management                                                                              */
 /* ---------------------------------------------------------------------------------------------- */
 
+ZyanStatus ZyanMemoryVirtualAlloc(void** address, ZyanUSize size,
+    ZyanMemoryPageProtection protection)
+{
+    if (!address || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+#if defined(ZYAN_WINDOWS)
+
+    void* const result = VirtualAlloc(ZYAN_NULL, size, MEM_RESERVE | MEM_COMMIT, protection);
+    if (!result)
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+#elif defined(ZYAN_POSIX)
+
+    void* const result = mmap(ZYAN_NULL, size, protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (result == MAP_FAILED)
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+#endif
+
+    *address = result;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanMemoryVirtualAllocHuge(void** address, ZyanUSize size,
+    ZyanMemoryPageProtection protection, ZyanU32* page_size)
+{
+    if (!address || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU32 huge_page_size = ZyanMemoryGetSystemHugePageSize();
+    if (huge_page_size && (size % huge_page_size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    void* result = ZYAN_NULL;
+    ZyanU32 result_page_size = huge_page_size;
+
+#if defined(ZYAN_WINDOWS)
+
+    if (huge_page_size)
+    {
+        result = VirtualAlloc(ZYAN_NULL, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+            protection);
+    }
+
+#elif defined(ZYAN_LINUX)
+
+#   ifdef MAP_HUGETLB
+    if (huge_page_size)
+    {
+        // Explicit huge pages have to be reserved by the system administrator
+        result = mmap(ZYAN_NULL, size, protection, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1,
+            0);
+        if (result == MAP_FAILED)
+        {
+            result = ZYAN_NULL;
+        }
+    }
+#   endif
+
+#   ifdef MADV_HUGEPAGE
+    if (huge_page_size && !result)
+    {
+        // Transparent huge pages are only used for huge page aligned regions. The region is
+        // over-allocated to align the start address and the excess is released afterwards
+        ZyanU8* const base = (ZyanU8*)mmap(ZYAN_NULL, size + huge_page_size, protection,
+            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if ((void*)base == MAP_FAILED)
+        {
+            return ZYAN_STATUS_BAD_SYSTEMCALL;
+        }
+
+        ZyanU8* const aligned = (ZyanU8*)ZYAN_ALIGN_UP((ZyanUPointer)base,
+            (ZyanUPointer)huge_page_size);
+        const ZyanUSize head = (ZyanUSize)(aligned - base);
+        if (head)
+        {
+            munmap(base, head);
+        }
+        if (head != huge_page_size)
+        {
+            munmap(aligned + size, huge_page_size - head);
+        }
+
+        if (madvise(aligned, size, MADV_HUGEPAGE))
+        {
+            result_page_size = ZyanMemoryGetSystemPageSize();
+        }
+        result = aligned;
+    }
+#   endif
+
+#endif
+
+    if (!result)
+    {
+        ZYAN_CHECK(ZyanMemoryVirtualAlloc(&result, size, protection));
+        result_page_size = ZyanMemoryGetSystemPageSize();
+    }
+
+    *address = result;
+    if (page_size)
+    {
+        *page_size = result_page_size;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanMemoryVirtualReserve(void** address, ZyanUSize size)
+{
+    if (!address || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+#if defined(ZYAN_WINDOWS)
+
+    void* const result = VirtualAlloc(ZYAN_NULL, size, MEM_RESERVE, PAGE_NOACCESS);
+    if (!result)
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+#elif defined(ZYAN_POSIX)
+
+    void* const result = mmap(ZYAN_NULL, size, PROT_NONE, ZYCORE_MEMORY_RESERVE_FLAGS, -1, 0);
+    if (result == MAP_FAILED)
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+#endif
+
+    *address = result;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanMemoryVirtualCommit(void* address, ZyanUSize size,
+    ZyanMemoryPageProtection protection)
+{
+#if defined(ZYAN_WINDOWS)
+
+    if (!VirtualAlloc(address, size, MEM_COMMIT, protection))
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+#elif defined(ZYAN_POSIX)
+
+    // Pages of an anonymous mapping are backed lazily, so making them accessible is sufficient
+    if (mprotect(address, size, protection))
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+#endif
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanMemoryVirtualDecommit(void* address, ZyanUSize size)
+{
+#if defined(ZYAN_WINDOWS)
+
+    if (!VirtualFree(address, size, MEM_DECOMMIT))
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+#elif defined(ZYAN_POSIX)
+
+    // Replacing the pages with a fresh inaccessible mapping releases the physical memory and the
+    // commit charge in a single step
+    if (mmap(address, size, PROT_NONE, ZYCORE_MEMORY_RESERVE_FLAGS | MAP_FIXED, -1, 0) ==
+        MAP_FAILED)
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+#endif
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 ZyanStatus ZyanMemoryVirtualProtect(void* address, ZyanUSize size, 
     ZyanMemoryPageProtection protection)
 {
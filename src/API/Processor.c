@@ -0,0 +1,184 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/API/Processor.h>
+
+#if defined(ZYAN_X86) || defined(ZYAN_X64)
+#   if defined(ZYAN_MSVC)
+#       include <intrin.h>
+#       define ZYCORE_PROCESSOR_HAS_CPUID
+#   elif defined(ZYAN_GNUC)
+#       include <cpuid.h>
+#       define ZYCORE_PROCESSOR_HAS_CPUID
+#   endif
+#endif
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Marks the cached feature mask as initialized.
+ */
+#define ZYCORE_PROCESSOR_FEATURES_INITIALIZED \
+    0x80000000
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifdef ZYCORE_PROCESSOR_HAS_CPUID
+
+/**
+ * Executes the `cpuid` instruction.
+ *
+ * @param   leaf        The value of the `eax` register.
+ * @param   subleaf     The value of the `ecx` register.
+ * @param   registers   Receives the values of the `eax`, `ebx`, `ecx` and `edx` registers.
+ */
+static void ZyanProcessorCpuid(ZyanU32 leaf, ZyanU32 subleaf, ZyanU32 registers[4])
+{
+#if defined(ZYAN_MSVC)
+    int values[4];
+    __cpuidex(values, (int)leaf, (int)subleaf);
+    registers[0] = (ZyanU32)values[0];
+    registers[1] = (ZyanU32)values[1];
+    registers[2] = (ZyanU32)values[2];
+    registers[3] = (ZyanU32)values[3];
+#else
+    unsigned int a, b, c, d;
+    __cpuid_count(leaf, subleaf, a, b, c, d);
+    registers[0] = a;
+    registers[1] = b;
+    registers[2] = c;
+    registers[3] = d;
+#endif
+}
+
+/**
+ * Reads the `XCR0` extended control register.
+ *
+ * @return  The value of the `XCR0` register.
+ *
+ * Must only be called, if the `OSXSAVE` feature flag is set.
+ */
+static ZyanU64 ZyanProcessorReadXCR0(void)
+{
+#if defined(ZYAN_MSVC)
+    return _xgetbv(0);
+#else
+    ZyanU32 eax, edx;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((ZyanU64)edx << 32) | eax;
+#endif
+}
+
+/**
+ * Detects the features supported by the processor.
+ *
+ * @return  A mask with one bit set for each supported `ZyanProcessorFeature`.
+ */
+static ZyanU32 ZyanProcessorDetectFeatures(void)
+{
+    ZyanU32 registers[4];
+    ZyanProcessorCpuid(0, 0, registers);
+    const ZyanU32 max_leaf = registers[0];
+    if (max_leaf < 1)
+    {
+        return 0;
+    }
+
+    ZyanU32 features = 0;
+
+    ZyanProcessorCpuid(1, 0, registers);
+    const ZyanU32 ecx = registers[2];
+    const ZyanU32 edx = registers[3];
+    features |= ((edx >> 26) & 1) << ZYAN_PROCESSOR_FEATURE_SSE2;
+    features |= ((ecx >>  0) & 1) << ZYAN_PROCESSOR_FEATURE_SSE3;
+    features |= ((ecx >>  9) & 1) << ZYAN_PROCESSOR_FEATURE_SSSE3;
+    features |= ((ecx >> 19) & 1) << ZYAN_PROCESSOR_FEATURE_SSE41;
+    features |= ((ecx >> 20) & 1) << ZYAN_PROCESSOR_FEATURE_SSE42;
+    features |= ((ecx >> 23) & 1) << ZYAN_PROCESSOR_FEATURE_POPCNT;
+
+    // AVX requires the operating system to save the `XMM` and `YMM` register state
+    const ZyanBool has_osxsave = (ecx >> 27) & 1;
+    const ZyanBool has_avx = ((ecx >> 28) & 1) && has_osxsave &&
+        ((ZyanProcessorReadXCR0() & 0x06) == 0x06);
+    features |= (ZyanU32)has_avx << ZYAN_PROCESSOR_FEATURE_AVX;
+
+    if (max_leaf >= 7)
+    {
+        ZyanProcessorCpuid(7, 0, registers);
+        const ZyanU32 ebx = registers[1];
+        features |= (((ebx >> 5) & 1) & has_avx) << ZYAN_PROCESSOR_FEATURE_AVX2;
+        features |= ((ebx >> 3) & 1) << ZYAN_PROCESSOR_FEATURE_BMI1;
+        features |= ((ebx >> 8) & 1) << ZYAN_PROCESSOR_FEATURE_BMI2;
+    }
+
+    return features;
+}
+
+#endif // ZYCORE_PROCESSOR_HAS_CPUID
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* General                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanBool ZyanProcessorHasFeature(ZyanProcessorFeature feature)
+{
+#ifdef ZYCORE_PROCESSOR_HAS_CPUID
+    // Concurrent first calls might both run the detection, which is harmless as they store the
+    // same value
+    static volatile ZyanU32 features = 0;
+
+    ZyanU32 value = features;
+    if (!(value & ZYCORE_PROCESSOR_FEATURES_INITIALIZED))
+    {
+        value = ZyanProcessorDetectFeatures() | ZYCORE_PROCESSOR_FEATURES_INITIALIZED;
+        features = value;
+    }
+
+    return (value >> feature) & 1;
+#else
+    ZYAN_UNUSED(feature);
+
+    return ZYAN_FALSE;
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -152,6 +152,166 @@ ZyanStatus ZyanCriticalSectionDelete(ZyanCriticalSection* critical_section)
     return ZYAN_STATUS_SUCCESS;
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Condition Variable                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConditionVariableInitialize(ZyanConditionVariable* condition_variable)
+{
+    const int error = pthread_cond_init(condition_variable, ZYAN_NULL);
+    if (error != 0)
+    {
+        if (error == EAGAIN)
+        {
+            return ZYAN_STATUS_OUT_OF_RESOURCES;
+        }
+        if (error == ENOMEM)
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+        if ((error == EBUSY) || (error == EINVAL))
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanConditionVariableWait(ZyanConditionVariable* condition_variable,
+    ZyanCriticalSection* critical_section)
+{
+    const int error = pthread_cond_wait(condition_variable, critical_section);
+    if (error != 0)
+    {
+        if (error == EINVAL)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        if (error == EPERM)
+        {
+            return ZYAN_STATUS_INVALID_OPERATION;
+        }
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanConditionVariableWakeOne(ZyanConditionVariable* condition_variable)
+{
+    return !pthread_cond_signal(condition_variable) ?
+        ZYAN_STATUS_SUCCESS : ZYAN_STATUS_INVALID_ARGUMENT;
+}
+
+ZyanStatus ZyanConditionVariableWakeAll(ZyanConditionVariable* condition_variable)
+{
+    return !pthread_cond_broadcast(condition_variable) ?
+        ZYAN_STATUS_SUCCESS : ZYAN_STATUS_INVALID_ARGUMENT;
+}
+
+ZyanStatus ZyanConditionVariableDelete(ZyanConditionVariable* condition_variable)
+{
+    const int error = pthread_cond_destroy(condition_variable);
+    if (error != 0)
+    {
+        if ((error == EBUSY) || (error == EINVAL))
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Read-Write Lock                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanReadWriteLockInitialize(ZyanReadWriteLock* lock)
+{
+    const int error = pthread_rwlock_init(lock, ZYAN_NULL);
+    if (error != 0)
+    {
+        if (error == EAGAIN)
+        {
+            return ZYAN_STATUS_OUT_OF_RESOURCES;
+        }
+        if (error == ENOMEM)
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+        if ((error == EBUSY) || (error == EINVAL))
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockEnterShared(ZyanReadWriteLock* lock)
+{
+    const int error = pthread_rwlock_rdlock(lock);
+    if (error != 0)
+    {
+        if (error == EAGAIN)
+        {
+            return ZYAN_STATUS_OUT_OF_RESOURCES;
+        }
+        if (error == EDEADLK)
+        {
+            return ZYAN_STATUS_INVALID_OPERATION;
+        }
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockLeaveShared(ZyanReadWriteLock* lock)
+{
+    return !pthread_rwlock_unlock(lock) ? ZYAN_STATUS_SUCCESS : ZYAN_STATUS_INVALID_OPERATION;
+}
+
+ZyanStatus ZyanReadWriteLockEnterExclusive(ZyanReadWriteLock* lock)
+{
+    const int error = pthread_rwlock_wrlock(lock);
+    if (error != 0)
+    {
+        if (error == EDEADLK)
+        {
+            return ZYAN_STATUS_INVALID_OPERATION;
+        }
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockLeaveExclusive(ZyanReadWriteLock* lock)
+{
+    return !pthread_rwlock_unlock(lock) ? ZYAN_STATUS_SUCCESS : ZYAN_STATUS_INVALID_OPERATION;
+}
+
+ZyanStatus ZyanReadWriteLockDelete(ZyanReadWriteLock* lock)
+{
+    const int error = pthread_rwlock_destroy(lock);
+    if (error != 0)
+    {
+        if ((error == EBUSY) || (error == EINVAL))
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 #elif defined(ZYAN_WINDOWS)
@@ -193,6 +353,93 @@ ZyanStatus ZyanCriticalSectionDelete(ZyanCriticalSection* critical_section)
     return ZYAN_STATUS_SUCCESS;
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Condition Variable                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanConditionVariableInitialize(ZyanConditionVariable* condition_variable)
+{
+    InitializeConditionVariable(condition_variable);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanConditionVariableWait(ZyanConditionVariable* condition_variable,
+    ZyanCriticalSection* critical_section)
+{
+    return SleepConditionVariableCS(condition_variable, critical_section, INFINITE) ?
+        ZYAN_STATUS_SUCCESS : ZYAN_STATUS_BAD_SYSTEMCALL;
+}
+
+ZyanStatus ZyanConditionVariableWakeOne(ZyanConditionVariable* condition_variable)
+{
+    WakeConditionVariable(condition_variable);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanConditionVariableWakeAll(ZyanConditionVariable* condition_variable)
+{
+    WakeAllConditionVariable(condition_variable);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanConditionVariableDelete(ZyanConditionVariable* condition_variable)
+{
+    // Windows condition variables do not need to be deleted
+    ZYAN_UNUSED(condition_variable);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Read-Write Lock                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanReadWriteLockInitialize(ZyanReadWriteLock* lock)
+{
+    InitializeSRWLock(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockEnterShared(ZyanReadWriteLock* lock)
+{
+    AcquireSRWLockShared(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockLeaveShared(ZyanReadWriteLock* lock)
+{
+    ReleaseSRWLockShared(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockEnterExclusive(ZyanReadWriteLock* lock)
+{
+    AcquireSRWLockExclusive(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockLeaveExclusive(ZyanReadWriteLock* lock)
+{
+    ReleaseSRWLockExclusive(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanReadWriteLockDelete(ZyanReadWriteLock* lock)
+{
+    // Slim reader/writer locks do not need to be deleted
+    ZYAN_UNUSED(lock);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 
 #else
@@ -25,6 +25,7 @@
 ***************************************************************************************************/
 
 #include <Zycore/API/Thread.h>
+#include <Zycore/LibC.h>
 
 #ifndef ZYAN_NO_LIBC
 
@@ -82,7 +83,60 @@ FlsFree(
 
 #endif /* (_WIN32_WINNT >= 0x0501) && (_WIN32_WINNT < 0x0600)*/
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Thread creation                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Holds the procedure and argument of a thread that is about to be started.
+ */
+typedef struct ZyanThreadStartContext_
+{
+    /**
+     * The thread procedure.
+     */
+    ZyanThreadProcedure procedure;
+    /**
+     * The argument to pass to the thread procedure.
+     */
+    void* argument;
+} ZyanThreadStartContext;
+
+/**
+ * Allocates the start context for a new thread.
+ *
+ * @param   procedure   The thread procedure.
+ * @param   argument    The argument to pass to the thread procedure.
+ *
+ * @return  A pointer to the start context or `ZYAN_NULL`, if the allocation failed.
+ */
+static ZyanThreadStartContext* ZyanThreadCreateStartContext(ZyanThreadProcedure procedure,
+    void* argument)
+{
+    ZyanThreadStartContext* const context =
+        (ZyanThreadStartContext*)ZYAN_MALLOC(sizeof(ZyanThreadStartContext));
+    if (context)
+    {
+        context->procedure = procedure;
+        context->argument  = argument;
+    }
+
+    return context;
+}
+
+/**
+ * Invokes the thread procedure stored in the given start context and releases the context.
+ *
+ * @param   context A pointer to the start context.
+ */
+static void ZyanThreadInvoke(ZyanThreadStartContext* context)
+{
+    const ZyanThreadProcedure procedure = context->procedure;
+    void* const argument = context->argument;
+    ZYAN_FREE(context);
 
+    procedure(argument);
+}
 
 /* ---------------------------------------------------------------------------------------------- */
 
@@ -93,6 +147,21 @@ FlsFree(
 #if   defined(ZYAN_POSIX)
 
 #include <errno.h>
+#include <unistd.h>
+
+/**
+ * The native thread procedure that invokes the `ZyanThreadProcedure`.
+ *
+ * @param   context A pointer to the `ZyanThreadStartContext`.
+ *
+ * @return  Always `ZYAN_NULL`.
+ */
+static void* ZyanThreadStart(void* context)
+{
+    ZyanThreadInvoke((ZyanThreadStartContext*)context);
+
+    return ZYAN_NULL;
+}
 
 /* ---------------------------------------------------------------------------------------------- */
 /* General                                                                                        */
@@ -116,6 +185,77 @@ ZyanStatus ZyanThreadGetCurrentThreadId(ZyanThreadId* thread_id)
     return ZYAN_STATUS_SUCCESS;
 }
 
+ZyanStatus ZyanThreadGetProcessorCount(ZyanUSize* count)
+{
+    if (!count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const long value = sysconf(_SC_NPROCESSORS_ONLN);
+    *count = (value > 0) ? (ZyanUSize)value : 1;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Thread creation                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanThreadCreate(ZyanThread* thread, ZyanThreadProcedure procedure, void* argument)
+{
+    if (!thread || !procedure)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanThreadStartContext* const context = ZyanThreadCreateStartContext(procedure, argument);
+    if (!context)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    const int error = pthread_create(thread, ZYAN_NULL, &ZyanThreadStart, context);
+    if (error != 0)
+    {
+        ZYAN_FREE(context);
+        if (error == EAGAIN)
+        {
+            return ZYAN_STATUS_OUT_OF_RESOURCES;
+        }
+        if (error == EPERM)
+        {
+            return ZYAN_STATUS_ACCESS_DENIED;
+        }
+        if (error == EINVAL)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanThreadJoin(ZyanThread thread)
+{
+    const int error = pthread_join(thread, ZYAN_NULL);
+    if (error != 0)
+    {
+        if ((error == EINVAL) || (error == ESRCH))
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        if (error == EDEADLK)
+        {
+            return ZYAN_STATUS_INVALID_OPERATION;
+        }
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Thread Local Storage                                                                           */
 /* ---------------------------------------------------------------------------------------------- */
@@ -172,6 +312,20 @@ ZyanStatus ZyanThreadTlsSetValue(ZyanThreadTlsIndex index, void* data)
 
 #elif defined(ZYAN_WINDOWS)
 
+/**
+ * The native thread procedure that invokes the `ZyanThreadProcedure`.
+ *
+ * @param   context A pointer to the `ZyanThreadStartContext`.
+ *
+ * @return  Always `0`.
+ */
+static DWORD WINAPI ZyanThreadStart(LPVOID context)
+{
+    ZyanThreadInvoke((ZyanThreadStartContext*)context);
+
+    return 0;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* General                                                                                        */
 /* ---------------------------------------------------------------------------------------------- */
@@ -190,6 +344,58 @@ ZyanStatus ZyanThreadGetCurrentThreadId(ZyanThreadId* thread_id)
     return ZYAN_STATUS_SUCCESS;
 }
 
+ZyanStatus ZyanThreadGetProcessorCount(ZyanUSize* count)
+{
+    if (!count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    *count = info.dwNumberOfProcessors ? (ZyanUSize)info.dwNumberOfProcessors : 1;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Thread creation                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanThreadCreate(ZyanThread* thread, ZyanThreadProcedure procedure, void* argument)
+{
+    if (!thread || !procedure)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanThreadStartContext* const context = ZyanThreadCreateStartContext(procedure, argument);
+    if (!context)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    const HANDLE handle = CreateThread(ZYAN_NULL, 0, &ZyanThreadStart, context, 0, ZYAN_NULL);
+    if (!handle)
+    {
+        ZYAN_FREE(context);
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    *thread = handle;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanThreadJoin(ZyanThread thread)
+{
+    if (WaitForSingleObject(thread, INFINITE) != WAIT_OBJECT_0)
+    {
+        return ZYAN_STATUS_BAD_SYSTEMCALL;
+    }
+
+    return CloseHandle(thread) ? ZYAN_STATUS_SUCCESS : ZYAN_STATUS_BAD_SYSTEMCALL;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Thread Local Storage (TLS)                                                                     */
 /* ---------------------------------------------------------------------------------------------- */
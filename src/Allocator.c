@@ -27,6 +27,34 @@
 #include <Zycore/Allocator.h>
 #include <Zycore/LibC.h>
 
+#if !defined(ZYAN_NO_LIBC) && defined(ZYAN_WINDOWS)
+#   include <malloc.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns the number of additional bytes required to emulate an aligned allocation.
+ *
+ * @param   alignment   The required alignment.
+ *
+ * @return  The number of additional bytes required to emulate an aligned allocation.
+ *
+ * The emulation stores the original pointer right in front of the aligned memory block.
+ */
+#define ZYCORE_ALLOCATOR_ALIGNED_OVERHEAD(alignment) \
+    ((alignment) - 1 + sizeof(void*))
+
+/**
+ * The alignment that `malloc` and `realloc` guarantee for every memory block.
+ *
+ * This is a conservative value that holds for all supported C libraries.
+ */
+#define ZYCORE_ALLOCATOR_MALLOC_ALIGNMENT \
+    (2 * sizeof(void*))
+
 /* ============================================================================================== */
 /* Internal functions                                                                             */
 /* ============================================================================================== */
@@ -93,6 +121,107 @@ static ZyanStatus ZyanAllocatorDefaultDeallocate(ZyanAllocator* allocator, void*
     return ZYAN_STATUS_SUCCESS;
 }
 
+#if defined(ZYAN_WINDOWS) || defined(ZYAN_POSIX)
+
+static ZyanStatus ZyanAllocatorDefaultAlignedAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize alignment, ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(alignment && ZYAN_IS_POWER_OF_2(alignment));
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(allocator);
+
+#if defined(ZYAN_WINDOWS)
+    *p = _aligned_malloc(element_size * n, alignment);
+    if (!*p)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+#else
+    // `posix_memalign` requires the alignment to be a multiple of `sizeof(void*)`
+    if (posix_memalign(p, ZYAN_MAX(alignment, sizeof(void*)), element_size * n))
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+#endif
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanAllocatorDefaultAlignedReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize alignment, ZyanUSize element_size, ZyanUSize old_n, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(alignment && ZYAN_IS_POWER_OF_2(alignment));
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(old_n);
+    ZYAN_ASSERT(n);
+
+#if defined(ZYAN_WINDOWS)
+    ZYAN_UNUSED(allocator);
+    ZYAN_UNUSED(old_n);
+
+    void* const x = _aligned_realloc(*p, element_size * n, alignment);
+    if (!x)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    *p = x;
+#else
+    // There is no aligned counterpart of `realloc`. The regular one is used for alignments it
+    // guarantees anyway, as it is able to resize the memory block in place most of the time.
+    // Stricter alignments always require a new block: `realloc` might move the data to an
+    // unsuitable address and release the original block, after which a failure could not be
+    // reported without losing the data
+    void* x;
+    if (alignment <= ZYCORE_ALLOCATOR_MALLOC_ALIGNMENT)
+    {
+        x = ZYAN_REALLOC(*p, element_size * n);
+        if (!x)
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+        ZYAN_ASSERT(!((ZyanUPointer)x & (alignment - 1)));
+    } else
+    {
+        ZYAN_CHECK(ZyanAllocatorDefaultAlignedAllocate(allocator, &x, alignment, element_size, n));
+        ZYAN_MEMCPY(x, *p, element_size * ZYAN_MIN(old_n, n));
+        ZYAN_FREE(*p);
+    }
+    *p = x;
+#endif
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanAllocatorDefaultAlignedDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize alignment, ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(allocator);
+    ZYAN_UNUSED(alignment);
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+#if defined(ZYAN_WINDOWS)
+    _aligned_free(p);
+#else
+    ZYAN_FREE(p);
+#endif
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#endif // ZYAN_WINDOWS || ZYAN_POSIX
+
 #endif // ZYAN_NO_LIBC
 
 /* ---------------------------------------------------------------------------------------------- */
@@ -101,6 +230,10 @@ static ZyanStatus ZyanAllocatorDefaultDeallocate(ZyanAllocator* allocator, void*
 /* Exported functions                                                                             */
 /* ============================================================================================== */
 
+/* ---------------------------------------------------------------------------------------------- */
+/* General                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
 ZyanStatus ZyanAllocatorInit(ZyanAllocator* allocator, ZyanAllocatorAllocate allocate,
     ZyanAllocatorAllocate reallocate, ZyanAllocatorDeallocate deallocate)
 {
@@ -109,9 +242,32 @@ ZyanStatus ZyanAllocatorInit(ZyanAllocator* allocator, ZyanAllocatorAllocate all
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    allocator->allocate   = allocate;
-    allocator->reallocate = reallocate;
-    allocator->deallocate = deallocate;
+    allocator->allocate           = allocate;
+    allocator->reallocate         = reallocate;
+    allocator->deallocate         = deallocate;
+    allocator->aligned_allocate   = ZYAN_NULL;
+    allocator->aligned_reallocate = ZYAN_NULL;
+    allocator->aligned_deallocate = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanAllocatorInitEx(ZyanAllocator* allocator, ZyanAllocatorAllocate allocate,
+    ZyanAllocatorAllocate reallocate, ZyanAllocatorDeallocate deallocate,
+    ZyanAllocatorAlignedAllocate aligned_allocate,
+    ZyanAllocatorAlignedReallocate aligned_reallocate,
+    ZyanAllocatorAlignedDeallocate aligned_deallocate)
+{
+    if (!aligned_allocate != !aligned_reallocate || !aligned_allocate != !aligned_deallocate)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInit(allocator, allocate, reallocate, deallocate));
+
+    allocator->aligned_allocate   = aligned_allocate;
+    allocator->aligned_reallocate = aligned_reallocate;
+    allocator->aligned_deallocate = aligned_deallocate;
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -124,11 +280,116 @@ ZyanAllocator* ZyanAllocatorDefault(void)
     {
         &ZyanAllocatorDefaultAllocate,
         &ZyanAllocatorDefaultReallocate,
-        &ZyanAllocatorDefaultDeallocate
+        &ZyanAllocatorDefaultDeallocate,
+#if defined(ZYAN_WINDOWS) || defined(ZYAN_POSIX)
+        &ZyanAllocatorDefaultAlignedAllocate,
+        &ZyanAllocatorDefaultAlignedReallocate,
+        &ZyanAllocatorDefaultAlignedDeallocate
+#else
+        ZYAN_NULL,
+        ZYAN_NULL,
+        ZYAN_NULL
+#endif
     };
     return &allocator;
 }
 
 #endif
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Aligned allocation                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanAllocatorAllocateAligned(ZyanAllocator* allocator, void** p, ZyanUSize alignment,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    if (!allocator || !p || !alignment || !ZYAN_IS_POWER_OF_2(alignment) || !element_size || !n)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (allocator->aligned_allocate)
+    {
+        return allocator->aligned_allocate(allocator, p, alignment, element_size, n);
+    }
+
+    const ZyanUSize overhead = ZYCORE_ALLOCATOR_ALIGNED_OVERHEAD(alignment);
+    if (n > ((ZyanUSize)-1 - overhead) / element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU8* raw;
+    ZYAN_ASSERT(allocator->allocate);
+    ZYAN_CHECK(allocator->allocate(allocator, (void**)&raw, 1, element_size * n + overhead));
+
+    void** const aligned =
+        (void**)ZYAN_ALIGN_UP((ZyanUPointer)(raw + sizeof(void*)), (ZyanUPointer)alignment);
+    aligned[-1] = raw;
+    *p = aligned;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanAllocatorReallocateAligned(ZyanAllocator* allocator, void** p, ZyanUSize alignment,
+    ZyanUSize element_size, ZyanUSize old_n, ZyanUSize n)
+{
+    if (!allocator || !p || !*p || !alignment || !ZYAN_IS_POWER_OF_2(alignment) ||
+        !element_size || !old_n || !n)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (allocator->aligned_reallocate)
+    {
+        return allocator->aligned_reallocate(allocator, p, alignment, element_size, old_n, n);
+    }
+
+    const ZyanUSize overhead = ZYCORE_ALLOCATOR_ALIGNED_OVERHEAD(alignment);
+    if (n > ((ZyanUSize)-1 - overhead) / element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanU8* raw = (ZyanU8*)((void**)*p)[-1];
+    const ZyanUSize old_offset = (ZyanU8*)*p - raw;
+
+    ZYAN_ASSERT(allocator->reallocate);
+    ZYAN_CHECK(allocator->reallocate(allocator, (void**)&raw, 1, element_size * n + overhead));
+
+    // The distance between the start of the memory block and the aligned address might have
+    // changed, if the block was moved
+    void** const aligned =
+        (void**)ZYAN_ALIGN_UP((ZyanUPointer)(raw + sizeof(void*)), (ZyanUPointer)alignment);
+    const ZyanUSize offset = (ZyanU8*)aligned - raw;
+    if (offset != old_offset)
+    {
+        ZYAN_MEMMOVE(aligned, raw + old_offset, element_size * ZYAN_MIN(old_n, n));
+    }
+    aligned[-1] = raw;
+    *p = aligned;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanAllocatorDeallocateAligned(ZyanAllocator* allocator, void* p, ZyanUSize alignment,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    if (!allocator || !p || !alignment || !ZYAN_IS_POWER_OF_2(alignment) || !element_size || !n)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (allocator->aligned_deallocate)
+    {
+        return allocator->aligned_deallocate(allocator, p, alignment, element_size, n);
+    }
+
+    ZYAN_ASSERT(allocator->deallocate);
+    return allocator->deallocate(allocator, ((void**)p)[-1], 1,
+        element_size * n + ZYCORE_ALLOCATOR_ALIGNED_OVERHEAD(alignment));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
 /* ============================================================================================== */
@@ -0,0 +1,406 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/ArenaAllocator.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The size of the header that precedes each chunk.
+ */
+#define ZYCORE_ARENA_CHUNK_HEADER_SIZE \
+    ZYAN_ALIGN_UP(sizeof(ZyanArenaChunk), ZYAN_ARENA_ALIGNMENT)
+
+/**
+ * The size of the header that precedes each memory block.
+ *
+ * The header stores the size of the block which is required to implement `reallocate()`.
+ */
+#define ZYCORE_ARENA_BLOCK_HEADER_SIZE \
+    ZYAN_ARENA_ALIGNMENT
+
+/**
+ * Returns a pointer to the first usable byte of the given `chunk`.
+ *
+ * @param   chunk   A pointer to the `ZyanArenaChunk` struct.
+ *
+ * @return  A pointer to the first usable byte of the given `chunk`.
+ */
+#define ZYCORE_ARENA_CHUNK_DATA(chunk) \
+    ((ZyanU8*)(chunk) + ZYCORE_ARENA_CHUNK_HEADER_SIZE)
+
+/**
+ * Returns a reference to the size field of the given memory `block`.
+ *
+ * @param   block   A pointer to a memory block obtained from the arena.
+ *
+ * @return  A reference to the size field of the given memory `block`.
+ */
+#define ZYCORE_ARENA_BLOCK_SIZE(block) \
+    (((ZyanUSize*)(block))[-1])
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Calculates the number of bytes required to store a block of `element_size * n` bytes,
+ * including the block header.
+ *
+ * @param   element_size    The size of a single element.
+ * @param   n               The number of elements.
+ * @param   size            Receives the size of the block (without the header).
+ * @param   total           Receives the total number of bytes required to store the block.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanArenaCalcBlockSize(ZyanUSize element_size, ZyanUSize n, ZyanUSize* size,
+    ZyanUSize* total)
+{
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(size);
+    ZYAN_ASSERT(total);
+
+    const ZyanUSize max = (ZyanUSize)-1 - ZYCORE_ARENA_CHUNK_HEADER_SIZE -
+        ZYCORE_ARENA_BLOCK_HEADER_SIZE - ZYAN_ARENA_ALIGNMENT;
+    if (n > max / element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size  = element_size * n;
+    *total = ZYCORE_ARENA_BLOCK_HEADER_SIZE + ZYAN_ALIGN_UP(*size, ZYAN_ARENA_ALIGNMENT);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Makes sure the current chunk has at least `total` bytes of free space.
+ *
+ * @param   arena   A pointer to the `ZyanArenaAllocator` instance.
+ * @param   total   The number of bytes required.
+ *
+ * @return  A zyan status code.
+ *
+ * Chunks retained by `ZyanArenaReset` are reused before a new chunk is requested from the backing
+ * allocator.
+ */
+static ZyanStatus ZyanArenaAcquire(ZyanArenaAllocator* arena, ZyanUSize total)
+{
+    ZYAN_ASSERT(arena);
+
+    if (arena->cursor && ((ZyanUSize)(arena->end - arena->cursor) >= total))
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanArenaChunk* next = arena->current ? arena->current->next : ZYAN_NULL;
+    while (next)
+    {
+        arena->current = next;
+        if (next->capacity >= total)
+        {
+            arena->cursor = ZYCORE_ARENA_CHUNK_DATA(next);
+            arena->end    = arena->cursor + next->capacity;
+            return ZYAN_STATUS_SUCCESS;
+        }
+        next = next->next;
+    }
+
+    if (!arena->backing)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    const ZyanUSize capacity = ZYAN_MAX(arena->chunk_size, total);
+    ZyanArenaChunk* chunk;
+    ZYAN_CHECK(arena->backing->allocate(arena->backing, (void**)&chunk, 1,
+        ZYCORE_ARENA_CHUNK_HEADER_SIZE + capacity));
+    chunk->next = ZYAN_NULL;
+    chunk->capacity = capacity;
+
+    if (arena->current)
+    {
+        ZYAN_ASSERT(!arena->current->next);
+        arena->current->next = chunk;
+    } else
+    {
+        arena->head = chunk;
+    }
+    arena->current = chunk;
+    arena->cursor  = ZYCORE_ARENA_CHUNK_DATA(chunk);
+    arena->end     = arena->cursor + capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator interface                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanArenaAllocatorAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanArenaAllocator* const arena = (ZyanArenaAllocator*)allocator;
+
+    ZyanUSize size;
+    ZyanUSize total;
+    ZYAN_CHECK(ZyanArenaCalcBlockSize(element_size, n, &size, &total));
+    ZYAN_CHECK(ZyanArenaAcquire(arena, total));
+
+    ZyanU8* const block = arena->cursor + ZYCORE_ARENA_BLOCK_HEADER_SIZE;
+    ZYCORE_ARENA_BLOCK_SIZE(block) = size;
+    arena->cursor += total;
+    arena->last = block;
+
+    *p = block;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanArenaAllocatorReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(*p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanArenaAllocator* const arena = (ZyanArenaAllocator*)allocator;
+
+    ZyanUSize size;
+    ZyanUSize total;
+    ZYAN_CHECK(ZyanArenaCalcBlockSize(element_size, n, &size, &total));
+
+    ZyanU8* const block = (ZyanU8*)*p;
+    const ZyanUSize old_size = ZYCORE_ARENA_BLOCK_SIZE(block);
+
+    if (block == arena->last)
+    {
+        // The block is located at the top of the current chunk and can be resized in place
+        ZyanU8* const block_end = block - ZYCORE_ARENA_BLOCK_HEADER_SIZE + total;
+        if (block_end <= arena->end)
+        {
+            ZYCORE_ARENA_BLOCK_SIZE(block) = size;
+            arena->cursor = block_end;
+            return ZYAN_STATUS_SUCCESS;
+        }
+    }
+    if ((block != arena->last) && (size <= old_size))
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    void* x;
+    ZYAN_CHECK(ZyanArenaAllocatorAllocate(allocator, &x, element_size, n));
+    ZYAN_MEMCPY(x, block, ZYAN_MIN(old_size, size));
+    *p = x;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanArenaAllocatorDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    ZyanArenaAllocator* const arena = (ZyanArenaAllocator*)allocator;
+
+    // Only the most recent allocation can be released. All other blocks are kept until the arena
+    // is reset or destroyed
+    if (p == arena->last)
+    {
+        arena->cursor = (ZyanU8*)p - ZYCORE_ARENA_BLOCK_HEADER_SIZE;
+        arena->last = ZYAN_NULL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZYAN_REQUIRES_LIBC ZyanStatus ZyanArenaInit(ZyanArenaAllocator* arena, ZyanUSize chunk_size)
+{
+    return ZyanArenaInitEx(arena, chunk_size, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanArenaInitEx(ZyanArenaAllocator* arena, ZyanUSize chunk_size,
+    ZyanAllocator* allocator)
+{
+    if (!arena || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInit(&arena->allocator, &ZyanArenaAllocatorAllocate,
+        &ZyanArenaAllocatorReallocate, &ZyanArenaAllocatorDeallocate));
+
+    arena->backing    = allocator;
+    arena->chunk_size = chunk_size ? chunk_size : ZYAN_ARENA_DEFAULT_CHUNK_SIZE;
+    arena->head       = ZYAN_NULL;
+    arena->current    = ZYAN_NULL;
+    arena->cursor     = ZYAN_NULL;
+    arena->end        = ZYAN_NULL;
+    arena->last       = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanArenaInitCustomBuffer(ZyanArenaAllocator* arena, void* buffer, ZyanUSize capacity)
+{
+    if (!arena || !buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // The custom buffer is treated as a single chunk that never gets released
+    const ZyanUPointer address = (ZyanUPointer)buffer;
+    const ZyanUSize padding = ZYAN_ALIGN_UP(address, ZYAN_ARENA_ALIGNMENT) - address;
+    if (capacity < padding + ZYCORE_ARENA_CHUNK_HEADER_SIZE)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInit(&arena->allocator, &ZyanArenaAllocatorAllocate,
+        &ZyanArenaAllocatorReallocate, &ZyanArenaAllocatorDeallocate));
+
+    ZyanArenaChunk* const chunk = (ZyanArenaChunk*)((ZyanU8*)buffer + padding);
+    chunk->next     = ZYAN_NULL;
+    chunk->capacity = (capacity - padding - ZYCORE_ARENA_CHUNK_HEADER_SIZE) &
+        ~(ZYAN_ARENA_ALIGNMENT - 1);
+
+    arena->backing    = ZYAN_NULL;
+    arena->chunk_size = chunk->capacity;
+    arena->head       = chunk;
+    arena->current    = chunk;
+    arena->cursor     = ZYCORE_ARENA_CHUNK_DATA(chunk);
+    arena->end        = arena->cursor + chunk->capacity;
+    arena->last       = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanArenaDestroy(ZyanArenaAllocator* arena)
+{
+    if (!arena)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (arena->backing)
+    {
+        ZyanArenaChunk* chunk = arena->head;
+        while (chunk)
+        {
+            ZyanArenaChunk* const next = chunk->next;
+            ZYAN_CHECK(arena->backing->deallocate(arena->backing, chunk, 1,
+                ZYCORE_ARENA_CHUNK_HEADER_SIZE + chunk->capacity));
+            chunk = next;
+        }
+    }
+
+    arena->head    = ZYAN_NULL;
+    arena->current = ZYAN_NULL;
+    arena->cursor  = ZYAN_NULL;
+    arena->end     = ZYAN_NULL;
+    arena->last    = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanArenaReset(ZyanArenaAllocator* arena)
+{
+    if (!arena)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    arena->current = arena->head;
+    arena->cursor  = arena->head ? ZYCORE_ARENA_CHUNK_DATA(arena->head) : ZYAN_NULL;
+    arena->end     = arena->head ? arena->cursor + arena->head->capacity : ZYAN_NULL;
+    arena->last    = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanArenaGetCapacity(const ZyanArenaAllocator* arena, ZyanUSize* size)
+{
+    if (!arena || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = 0;
+    for (const ZyanArenaChunk* chunk = arena->head; chunk; chunk = chunk->next)
+    {
+        *size += chunk->capacity;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,661 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/CachingAllocator.h>
+#include <Zycore/LibC.h>
+
+#ifndef ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The size of the header that precedes each memory block and each slab.
+ */
+#define ZYCORE_CACHING_HEADER_SIZE \
+    ZYAN_CACHING_ALIGNMENT
+
+/**
+ * The size-class value used to mark blocks that are directly obtained from the default memory
+ * manager.
+ */
+#define ZYCORE_CACHING_CLASS_LARGE \
+    ((ZyanUSize)-1)
+
+/**
+ * Returns a pointer to the header of the given memory `block`.
+ *
+ * @param   block   A pointer to a memory block obtained from the caching allocator.
+ *
+ * @return  A pointer to the `ZyanCachingBlockHeader` struct of the given memory `block`.
+ */
+#define ZYCORE_CACHING_HEADER(block) \
+    ((ZyanCachingBlockHeader*)((ZyanU8*)(block) - ZYCORE_CACHING_HEADER_SIZE))
+
+/**
+ * Returns a reference to the pointer that links a free `block` to the next free block.
+ *
+ * @param   block   A pointer to a free memory block.
+ *
+ * @return  A reference to the pointer that links the `block` to the next free block.
+ */
+#define ZYCORE_CACHING_NEXT(block) \
+    (((void**)(block))[0])
+
+/**
+ * Returns a reference to the pointer that links the first block of a batch to the first block of
+ * the next batch inside of a depot.
+ *
+ * @param   block   A pointer to the first block of a batch.
+ *
+ * @return  A reference to the pointer that links the batch to the next batch.
+ */
+#define ZYCORE_CACHING_NEXT_BATCH(block) \
+    (((void**)(block))[1])
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanCachingBlockHeader` struct.
+ */
+typedef struct ZyanCachingBlockHeader_
+{
+    /**
+     * The size-class of the block or `ZYCORE_CACHING_CLASS_LARGE`.
+     */
+    ZyanUSize size_class;
+    /**
+     * The size of the block, if it's a large block, or the number of blocks in the batch, if the
+     * block is the first block of a batch inside of a depot.
+     */
+    ZyanUSize value;
+} ZyanCachingBlockHeader;
+
+ZYAN_STATIC_ASSERT(sizeof(ZyanCachingBlockHeader) <= ZYCORE_CACHING_HEADER_SIZE);
+
+/**
+ * Defines the `ZyanCachingBin` struct.
+ */
+typedef struct ZyanCachingBin_
+{
+    /**
+     * The first free block.
+     */
+    void* head;
+    /**
+     * The number of free blocks.
+     */
+    ZyanUSize count;
+} ZyanCachingBin;
+
+/**
+ * Defines the `ZyanCachingThreadCache` struct.
+ */
+typedef struct ZyanCachingThreadCache_
+{
+    /**
+     * The allocator that owns this cache.
+     */
+    ZyanCachingAllocator* owner;
+    /**
+     * The previous cache in the list of all caches.
+     */
+    struct ZyanCachingThreadCache_* prev;
+    /**
+     * The next cache in the list of all caches.
+     */
+    struct ZyanCachingThreadCache_* next;
+    /**
+     * The free blocks (one bin for each size-class).
+     */
+    ZyanCachingBin bins[ZYAN_CACHING_CLASS_COUNT];
+} ZyanCachingThreadCache;
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Size-classes                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Contains the block size of each size-class.
+ *
+ * Sizes up to 128 bytes are multiples of 16. Larger sizes use four classes for each power of two.
+ */
+static const ZyanU16 ZYCORE_CACHING_CLASS_SIZES[ZYAN_CACHING_CLASS_COUNT] =
+{
+       16,    32,    48,    64,    80,    96,   112,   128,
+      160,   192,   224,   256,   320,   384,   448,   512,
+      640,   768,   896,  1024,  1280,  1536,  1792,  2048,
+     2560,  3072,  3584,  4096,  5120,  6144,  7168,  8192,
+    10240, 12288, 14336, 16384, 20480, 24576, 28672, 32768
+};
+
+/**
+ * Contains the number of blocks that are transferred between a thread cache and the depot at once
+ * for each size-class.
+ *
+ * A thread cache holds at most two batches of free blocks per size-class.
+ */
+static const ZyanU8 ZYCORE_CACHING_BATCH_SIZES[ZYAN_CACHING_CLASS_COUNT] =
+{
+    64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 51, 42, 36, 32, 25, 21, 18, 16,
+    12, 10,  9,  8,  6,  5,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4
+};
+
+/**
+ * Maps `(size + 15) / 16` to the size-class for all sizes up to 1024 bytes.
+ */
+static const ZyanU8 ZYCORE_CACHING_SMALL_CLASSES[65] =
+{
+     0,  0,  1,  2,  3,  4,  5,  6,  7,  8,  8,  9,  9, 10, 10, 11, 11, 12, 12, 12, 12, 13,
+    13, 13, 13, 14, 14, 14, 14, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17,
+    17, 17, 17, 17, 17, 18, 18, 18, 18, 18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19
+};
+
+/**
+ * Returns the size-class for the given block `size`.
+ *
+ * @param   size    The size of the block. Must be in range `[1, ZYAN_CACHING_MAX_BLOCK_SIZE]`.
+ *
+ * @return  The size-class for the given block `size`.
+ */
+static ZyanUSize ZyanCachingGetSizeClass(ZyanUSize size)
+{
+    ZYAN_ASSERT(size && (size <= ZYAN_CACHING_MAX_BLOCK_SIZE));
+
+    if (size <= 1024)
+    {
+        return ZYCORE_CACHING_SMALL_CLASSES[(size + 15) / 16];
+    }
+
+    ZyanUSize shift = 10;
+    while (((ZyanUSize)1 << (shift + 1)) < size)
+    {
+        ++shift;
+    }
+    const ZyanUSize step = (ZyanUSize)1 << (shift - 2);
+    return 8 + (shift - 7) * 4 + (size - ((ZyanUSize)1 << shift) + step - 1) / step - 1;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Thread caches                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Moves the first `count` blocks of the given `bin` to the depot as a single batch.
+ *
+ * @param   allocator   A pointer to the `ZyanCachingAllocator` instance.
+ * @param   bin         A pointer to the `ZyanCachingBin` struct.
+ * @param   size_class  The size-class of the `bin`.
+ * @param   count       The number of blocks to move.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanCachingReleaseBatch(ZyanCachingAllocator* allocator, ZyanCachingBin* bin,
+    ZyanUSize size_class, ZyanUSize count)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(bin);
+    ZYAN_ASSERT(count && (count <= bin->count));
+
+    void* const first = bin->head;
+    void* last = first;
+    for (ZyanUSize i = 1; i < count; ++i)
+    {
+        last = ZYCORE_CACHING_NEXT(last);
+    }
+    bin->head = ZYCORE_CACHING_NEXT(last);
+    bin->count -= count;
+    ZYCORE_CACHING_NEXT(last) = ZYAN_NULL;
+    ZYCORE_CACHING_HEADER(first)->value = count;
+
+    ZyanCachingDepot* const depot = &allocator->depots[size_class];
+    ZYAN_CHECK(ZyanCriticalSectionEnter(&depot->lock));
+    ZYCORE_CACHING_NEXT_BATCH(first) = depot->batches;
+    depot->batches = first;
+    return ZyanCriticalSectionLeave(&depot->lock);
+}
+
+/**
+ * Refills the given (empty) `bin` with a batch from the depot or from a newly allocated slab.
+ *
+ * @param   allocator   A pointer to the `ZyanCachingAllocator` instance.
+ * @param   bin         A pointer to the `ZyanCachingBin` struct.
+ * @param   size_class  The size-class of the `bin`.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanCachingRefill(ZyanCachingAllocator* allocator, ZyanCachingBin* bin,
+    ZyanUSize size_class)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(bin);
+    ZYAN_ASSERT(!bin->count);
+
+    ZyanCachingDepot* const depot = &allocator->depots[size_class];
+    ZYAN_CHECK(ZyanCriticalSectionEnter(&depot->lock));
+    void* const batch = depot->batches;
+    if (batch)
+    {
+        depot->batches = ZYCORE_CACHING_NEXT_BATCH(batch);
+    }
+    ZYAN_CHECK(ZyanCriticalSectionLeave(&depot->lock));
+
+    if (batch)
+    {
+        bin->head  = batch;
+        bin->count = ZYCORE_CACHING_HEADER(batch)->value;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // The depot is empty, carve a new batch from a fresh slab
+    const ZyanUSize count  = ZYCORE_CACHING_BATCH_SIZES[size_class];
+    const ZyanUSize stride = ZYCORE_CACHING_HEADER_SIZE + ZYCORE_CACHING_CLASS_SIZES[size_class];
+    ZyanU8* const slab = (ZyanU8*)ZYAN_MALLOC(ZYCORE_CACHING_HEADER_SIZE + count * stride);
+    if (!slab)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    ZYAN_CHECK(ZyanCriticalSectionEnter(&allocator->lock));
+    *(void**)slab = allocator->slabs;
+    allocator->slabs = slab;
+    ZYAN_CHECK(ZyanCriticalSectionLeave(&allocator->lock));
+
+    void* head = ZYAN_NULL;
+    for (ZyanUSize i = count; i > 0; --i)
+    {
+        void* const block = slab + ZYCORE_CACHING_HEADER_SIZE + (i - 1) * stride +
+            ZYCORE_CACHING_HEADER_SIZE;
+        ZYCORE_CACHING_HEADER(block)->size_class = size_class;
+        ZYCORE_CACHING_NEXT(block) = head;
+        head = block;
+    }
+    bin->head  = head;
+    bin->count = count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Returns all blocks of the given `cache` to the depot.
+ *
+ * @param   cache   A pointer to the `ZyanCachingThreadCache` struct.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanCachingFlushCache(ZyanCachingThreadCache* cache)
+{
+    ZYAN_ASSERT(cache);
+
+    for (ZyanUSize i = 0; i < ZYAN_CACHING_CLASS_COUNT; ++i)
+    {
+        ZyanCachingBin* const bin = &cache->bins[i];
+        if (bin->count)
+        {
+            ZYAN_CHECK(ZyanCachingReleaseBatch(cache->owner, bin, i, bin->count));
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Flushes and releases the cache of an exiting thread.
+ *
+ * @param   data    A pointer to the `ZyanCachingThreadCache` struct.
+ */
+static ZYAN_THREAD_DECLARE_TLS_CALLBACK(ZyanCachingThreadCacheDestructor, void, data)
+{
+    ZyanCachingThreadCache* const cache = (ZyanCachingThreadCache*)data;
+    if (!cache)
+    {
+        return;
+    }
+    ZyanCachingAllocator* const allocator = cache->owner;
+
+    ZyanCachingFlushCache(cache);
+
+    ZyanCriticalSectionEnter(&allocator->lock);
+    if (cache->prev)
+    {
+        cache->prev->next = cache->next;
+    } else
+    {
+        allocator->caches = cache->next;
+    }
+    if (cache->next)
+    {
+        cache->next->prev = cache->prev;
+    }
+    ZyanCriticalSectionLeave(&allocator->lock);
+
+    ZYAN_FREE(cache);
+}
+
+/**
+ * Returns the cache of the calling thread and creates it, if needed.
+ *
+ * @param   allocator   A pointer to the `ZyanCachingAllocator` instance.
+ * @param   cache       Receives a pointer to the `ZyanCachingThreadCache` struct.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanCachingGetCache(ZyanCachingAllocator* allocator,
+    ZyanCachingThreadCache** cache)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(cache);
+
+    ZYAN_CHECK(ZyanThreadTlsGetValue(allocator->tls_index, (void**)cache));
+    if (*cache)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanCachingThreadCache* const value =
+        (ZyanCachingThreadCache*)ZYAN_MALLOC(sizeof(ZyanCachingThreadCache));
+    if (!value)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    ZYAN_MEMSET(value, 0, sizeof(ZyanCachingThreadCache));
+    value->owner = allocator;
+
+    const ZyanStatus status = ZyanThreadTlsSetValue(allocator->tls_index, value);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZYAN_FREE(value);
+        return status;
+    }
+
+    ZYAN_CHECK(ZyanCriticalSectionEnter(&allocator->lock));
+    value->next = allocator->caches;
+    if (allocator->caches)
+    {
+        allocator->caches->prev = value;
+    }
+    allocator->caches = value;
+    ZYAN_CHECK(ZyanCriticalSectionLeave(&allocator->lock));
+
+    *cache = value;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator interface                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanCachingAllocatorAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanCachingAllocator* const caching = (ZyanCachingAllocator*)allocator;
+
+    if (n > ((ZyanUSize)-1 - ZYCORE_CACHING_HEADER_SIZE) / element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    const ZyanUSize size = element_size * n;
+
+    if (size > ZYAN_CACHING_MAX_BLOCK_SIZE)
+    {
+        ZyanU8* const memory = (ZyanU8*)ZYAN_MALLOC(ZYCORE_CACHING_HEADER_SIZE + size);
+        if (!memory)
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+        *p = memory + ZYCORE_CACHING_HEADER_SIZE;
+        ZYCORE_CACHING_HEADER(*p)->size_class = ZYCORE_CACHING_CLASS_LARGE;
+        ZYCORE_CACHING_HEADER(*p)->value = size;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanCachingThreadCache* cache;
+    ZYAN_CHECK(ZyanCachingGetCache(caching, &cache));
+
+    const ZyanUSize size_class = ZyanCachingGetSizeClass(size);
+    ZyanCachingBin* const bin = &cache->bins[size_class];
+    if (!bin->count)
+    {
+        ZYAN_CHECK(ZyanCachingRefill(caching, bin, size_class));
+    }
+
+    *p = bin->head;
+    bin->head = ZYCORE_CACHING_NEXT(*p);
+    --bin->count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanCachingAllocatorDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    ZyanCachingAllocator* const caching = (ZyanCachingAllocator*)allocator;
+
+    const ZyanUSize size_class = ZYCORE_CACHING_HEADER(p)->size_class;
+    if (size_class == ZYCORE_CACHING_CLASS_LARGE)
+    {
+        ZYAN_FREE(ZYCORE_CACHING_HEADER(p));
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // The block might have been allocated by a different thread. This is fine, as all blocks of
+    // the same size-class are interchangeable
+    ZyanCachingThreadCache* cache;
+    ZYAN_CHECK(ZyanCachingGetCache(caching, &cache));
+
+    ZyanCachingBin* const bin = &cache->bins[size_class];
+    ZYCORE_CACHING_NEXT(p) = bin->head;
+    bin->head = p;
+    ++bin->count;
+
+    const ZyanUSize batch_size = ZYCORE_CACHING_BATCH_SIZES[size_class];
+    if (bin->count > 2 * batch_size)
+    {
+        return ZyanCachingReleaseBatch(caching, bin, size_class, batch_size);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanCachingAllocatorReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(*p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    if (n > ((ZyanUSize)-1 - ZYCORE_CACHING_HEADER_SIZE) / element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    const ZyanUSize size = element_size * n;
+
+    const ZyanCachingBlockHeader* const header = ZYCORE_CACHING_HEADER(*p);
+    const ZyanBool is_large = (header->size_class == ZYCORE_CACHING_CLASS_LARGE);
+    const ZyanUSize old_size =
+        is_large ? header->value : ZYCORE_CACHING_CLASS_SIZES[header->size_class];
+
+    if (is_large && (size > ZYAN_CACHING_MAX_BLOCK_SIZE))
+    {
+        ZyanU8* const memory =
+            (ZyanU8*)ZYAN_REALLOC(ZYCORE_CACHING_HEADER(*p), ZYCORE_CACHING_HEADER_SIZE + size);
+        if (!memory)
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+        *p = memory + ZYCORE_CACHING_HEADER_SIZE;
+        ZYCORE_CACHING_HEADER(*p)->value = size;
+        return ZYAN_STATUS_SUCCESS;
+    }
+    if (!is_large && (size <= old_size))
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    void* x;
+    ZYAN_CHECK(ZyanCachingAllocatorAllocate(allocator, &x, 1, size));
+    ZYAN_MEMCPY(x, *p, ZYAN_MIN(old_size, size));
+    ZYAN_CHECK(ZyanCachingAllocatorDeallocate(allocator, *p, 1, old_size));
+    *p = x;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCachingInit(ZyanCachingAllocator* allocator)
+{
+    if (!allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInit(&allocator->allocator, &ZyanCachingAllocatorAllocate,
+        &ZyanCachingAllocatorReallocate, &ZyanCachingAllocatorDeallocate));
+    ZYAN_CHECK(ZyanThreadTlsAlloc(&allocator->tls_index, &ZyanCachingThreadCacheDestructor));
+
+    ZyanStatus status = ZyanCriticalSectionInitialize(&allocator->lock);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanThreadTlsFree(allocator->tls_index);
+        return status;
+    }
+    for (ZyanUSize i = 0; i < ZYAN_CACHING_CLASS_COUNT; ++i)
+    {
+        status = ZyanCriticalSectionInitialize(&allocator->depots[i].lock);
+        if (!ZYAN_SUCCESS(status))
+        {
+            while (i--)
+            {
+                ZyanCriticalSectionDelete(&allocator->depots[i].lock);
+            }
+            ZyanCriticalSectionDelete(&allocator->lock);
+            ZyanThreadTlsFree(allocator->tls_index);
+            return status;
+        }
+        allocator->depots[i].batches = ZYAN_NULL;
+    }
+
+    allocator->caches = ZYAN_NULL;
+    allocator->slabs  = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanCachingDestroy(ZyanCachingAllocator* allocator)
+{
+    if (!allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // Releasing the TLS slot might invoke the destructor callback for some threads, which is why
+    // we have to do this first
+    ZYAN_CHECK(ZyanThreadTlsFree(allocator->tls_index));
+
+    ZyanCachingThreadCache* cache = allocator->caches;
+    while (cache)
+    {
+        ZyanCachingThreadCache* const next = cache->next;
+        ZYAN_FREE(cache);
+        cache = next;
+    }
+    allocator->caches = ZYAN_NULL;
+
+    void* slab = allocator->slabs;
+    while (slab)
+    {
+        void* const next = *(void**)slab;
+        ZYAN_FREE(slab);
+        slab = next;
+    }
+    allocator->slabs = ZYAN_NULL;
+
+    for (ZyanUSize i = 0; i < ZYAN_CACHING_CLASS_COUNT; ++i)
+    {
+        ZYAN_CHECK(ZyanCriticalSectionDelete(&allocator->depots[i].lock));
+    }
+
+    return ZyanCriticalSectionDelete(&allocator->lock);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Cache management                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanCachingFlush(ZyanCachingAllocator* allocator)
+{
+    if (!allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanCachingThreadCache* cache;
+    ZYAN_CHECK(ZyanThreadTlsGetValue(allocator->tls_index, (void**)&cache));
+    if (!cache)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    return ZyanCachingFlushCache(cache);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYAN_NO_LIBC */
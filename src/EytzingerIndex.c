@@ -0,0 +1,209 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/EytzingerIndex.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Copies the elements of the sorted `vector` into the subtree starting at position `k` of the
+ * given index.
+ *
+ * @param   eytzinger   A pointer to the `ZyanEytzingerIndex` instance.
+ * @param   vector      A pointer to the sorted `ZyanVector` instance.
+ * @param   i           The index of the next element of the vector to place.
+ * @param   k           The position of the subtree root.
+ *
+ * @return  The index of the next element of the vector to place after filling the subtree.
+ */
+static ZyanUSize ZyanEytzingerIndexBuild(ZyanEytzingerIndex* eytzinger, const ZyanVector* vector,
+    ZyanUSize i, ZyanUSize k)
+{
+    ZYAN_ASSERT(eytzinger);
+    ZYAN_ASSERT(vector);
+
+    if (k <= eytzinger->size)
+    {
+        const ZyanUSize element_size = eytzinger->element_size;
+
+        i = ZyanEytzingerIndexBuild(eytzinger, vector, i, 2 * k);
+        ZYAN_MEMCPY((ZyanU8*)eytzinger->data + k * element_size,
+            (const ZyanU8*)vector->data + i * element_size, element_size);
+        eytzinger->ranks[k] = i++;
+        i = ZyanEytzingerIndexBuild(eytzinger, vector, i, 2 * k + 1);
+    }
+
+    return i;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanEytzingerIndexInit(ZyanEytzingerIndex* eytzinger, const ZyanVector* vector)
+{
+    return ZyanEytzingerIndexInitEx(eytzinger, vector, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanEytzingerIndexInitEx(ZyanEytzingerIndex* eytzinger, const ZyanVector* vector,
+    ZyanAllocator* allocator)
+{
+    if (!eytzinger || !vector || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+
+    eytzinger->allocator    = allocator;
+    eytzinger->element_size = vector->element_size;
+    eytzinger->size         = vector->size;
+    eytzinger->data         = ZYAN_NULL;
+    eytzinger->ranks        = ZYAN_NULL;
+
+    ZYAN_CHECK(ZyanAllocatorAllocateAligned(allocator, &eytzinger->data, ZYAN_EYTZINGER_ALIGNMENT,
+        eytzinger->element_size, eytzinger->size + 1));
+
+    const ZyanStatus status = allocator->allocate(allocator, (void**)&eytzinger->ranks,
+        sizeof(ZyanUSize), eytzinger->size + 1);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanAllocatorDeallocateAligned(allocator, eytzinger->data, ZYAN_EYTZINGER_ALIGNMENT,
+            eytzinger->element_size, eytzinger->size + 1);
+        eytzinger->data = ZYAN_NULL;
+        return status;
+    }
+
+    // Position `0` is a sentinel for "no element"
+    eytzinger->ranks[0] = eytzinger->size;
+    if (eytzinger->size)
+    {
+        ZyanEytzingerIndexBuild(eytzinger, vector, 0, 1);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanEytzingerIndexDestroy(ZyanEytzingerIndex* eytzinger)
+{
+    if (!eytzinger)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(eytzinger->allocator);
+
+    if (eytzinger->data)
+    {
+        ZYAN_CHECK(ZyanAllocatorDeallocateAligned(eytzinger->allocator, eytzinger->data,
+            ZYAN_EYTZINGER_ALIGNMENT, eytzinger->element_size, eytzinger->size + 1));
+        eytzinger->data = ZYAN_NULL;
+    }
+    if (eytzinger->ranks)
+    {
+        ZYAN_CHECK(eytzinger->allocator->deallocate(eytzinger->allocator, eytzinger->ranks,
+            sizeof(ZyanUSize), eytzinger->size + 1));
+        eytzinger->ranks = ZYAN_NULL;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Searching                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanEytzingerIndexSearch(const ZyanEytzingerIndex* eytzinger, const void* element,
+    ZyanUSize* found_index, ZyanComparison comparison)
+{
+    if (!eytzinger || !element || !found_index || !comparison)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(eytzinger->data);
+    ZYAN_ASSERT(eytzinger->ranks);
+
+    const ZyanU8* const data = (const ZyanU8*)eytzinger->data;
+    const ZyanUSize element_size = eytzinger->element_size;
+    const ZyanUSize size = eytzinger->size;
+
+    ZyanUSize k = 1;
+    while (k <= size)
+    {
+        ZYAN_PREFETCH((const void*)((ZyanUPointer)data +
+            (k << ZYAN_EYTZINGER_PREFETCH_LEVELS) * element_size));
+        k = 2 * k + ((comparison(data + k * element_size, element) < 0) ? 1 : 0);
+    }
+
+    k = ZyanEytzingerIndexResolvePosition(k);
+
+    *found_index = eytzinger->ranks[k];
+    if (!k)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    return (comparison(data + k * element_size, element) == 0) ?
+        ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanEytzingerIndexGetSize(const ZyanEytzingerIndex* eytzinger, ZyanUSize* size)
+{
+    if (!eytzinger || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = eytzinger->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
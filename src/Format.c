@@ -73,7 +73,7 @@ static const ZyanStringView STR_SUB = ZYAN_DEFINE_STRING_VIEW("-");
  * Writes a terminating '\0' character at the end of the string data.
  */
 #define ZYCORE_STRING_NULLTERMINATE(string) \
-      *(char*)((ZyanU8*)(string)->vector.data + (string)->vector.size - 1) = '\0';
+      *(ZYAN_STRING_DATA(string) + (string)->vector.size - 1) = '\0';
 
 /* ============================================================================================== */
 /* Internal functions                                                                             */
@@ -109,7 +109,7 @@ ZyanStatus ZyanStringAppendDecU32(ZyanString* string, ZyanU32 value, ZyanU8 padd
     const ZyanUSize length_total  = ZYAN_MAX(length_number, padding_length);
     const ZyanUSize length_target = string->vector.size;
 
-    if (string->vector.size + length_total > string->vector.capacity)
+    if (string->vector.size + length_total > ZYAN_STRING_BUFFER_SIZE(string))
     {
         ZYAN_CHECK(ZyanStringResize(string, string->vector.size + length_total - 1));
     }
@@ -118,10 +118,10 @@ ZyanStatus ZyanStringAppendDecU32(ZyanString* string, ZyanU32 value, ZyanU8 padd
     if (padding_length > length_number)
     {
         offset_write = padding_length - length_number;
-        ZYAN_MEMSET((char*)string->vector.data + length_target - 1, '0', offset_write);
+        ZYAN_MEMSET(ZYAN_STRING_DATA(string) + length_target - 1, '0', offset_write);
     }
 
-    ZYAN_MEMCPY((char*)string->vector.data + length_target + offset_write - 1,
+    ZYAN_MEMCPY(ZYAN_STRING_DATA(string) + length_target + offset_write - 1,
         buffer_write_pointer + offset_odd, length_number);
     string->vector.size = length_target + length_total;
     ZYCORE_STRING_NULLTERMINATE(string);
@@ -155,7 +155,7 @@ ZyanStatus ZyanStringAppendDecU64(ZyanString* string, ZyanU64 value, ZyanU8 padd
     const ZyanUSize length_total  = ZYAN_MAX(length_number, padding_length);
     const ZyanUSize length_target = string->vector.size;
 
-    if (string->vector.size + length_total > string->vector.capacity)
+    if (string->vector.size + length_total > ZYAN_STRING_BUFFER_SIZE(string))
     {
         ZYAN_CHECK(ZyanStringResize(string, string->vector.size + length_total - 1));
     }
@@ -164,10 +164,10 @@ ZyanStatus ZyanStringAppendDecU64(ZyanString* string, ZyanU64 value, ZyanU8 padd
     if (padding_length > length_number)
     {
         offset_write = padding_length - length_number;
-        ZYAN_MEMSET((char*)string->vector.data + length_target - 1, '0', offset_write);
+        ZYAN_MEMSET(ZYAN_STRING_DATA(string) + length_target - 1, '0', offset_write);
     }
 
-    ZYAN_MEMCPY((char*)string->vector.data + length_target + offset_write - 1,
+    ZYAN_MEMCPY(ZYAN_STRING_DATA(string) + length_target + offset_write - 1,
         buffer_write_pointer + offset_odd, length_number);
     string->vector.size = length_target + length_total;
     ZYCORE_STRING_NULLTERMINATE(string);
@@ -189,7 +189,7 @@ ZyanStatus ZyanStringAppendHexU32(ZyanString* string, ZyanU32 value, ZyanU8 padd
     }
 
     const ZyanUSize len = string->vector.size;
-    ZyanUSize remaining = string->vector.capacity - string->vector.size;
+    ZyanUSize remaining = ZYAN_STRING_BUFFER_SIZE(string) - string->vector.size;
 
     if (remaining < (ZyanUSize)padding_length)
     {
@@ -206,7 +206,7 @@ ZyanStatus ZyanStringAppendHexU32(ZyanString* string, ZyanU32 value, ZyanU8 padd
             ZYAN_CHECK(ZyanStringResize(string, string->vector.size + n - 1));
         }
 
-        ZYAN_MEMSET((char*)string->vector.data + len - 1, '0', n);
+        ZYAN_MEMSET(ZYAN_STRING_DATA(string) + len - 1, '0', n);
         string->vector.size = len + n;
         ZYCORE_STRING_NULLTERMINATE(string);
 
@@ -228,7 +228,7 @@ ZyanStatus ZyanStringAppendHexU32(ZyanString* string, ZyanU32 value, ZyanU8 padd
             {
                 ZYAN_CHECK(ZyanStringResize(string, string->vector.size + i));
             }
-            buffer = (char*)string->vector.data + len - 1;
+            buffer = ZYAN_STRING_DATA(string) + len - 1;
             if (padding_length > i)
             {
                 n = padding_length - i - 1;
@@ -260,7 +260,7 @@ ZyanStatus ZyanStringAppendHexU64(ZyanString* string, ZyanU64 value, ZyanU8 padd
     }
 
     const ZyanUSize len = string->vector.size;
-    ZyanUSize remaining = string->vector.capacity - string->vector.size;
+    ZyanUSize remaining = ZYAN_STRING_BUFFER_SIZE(string) - string->vector.size;
 
     if (remaining < (ZyanUSize)padding_length)
     {
@@ -277,7 +277,7 @@ ZyanStatus ZyanStringAppendHexU64(ZyanString* string, ZyanU64 value, ZyanU8 padd
             ZYAN_CHECK(ZyanStringResize(string, string->vector.size + n - 1));
         }
 
-        ZYAN_MEMSET((char*)string->vector.data + len - 1, '0', n);
+        ZYAN_MEMSET(ZYAN_STRING_DATA(string) + len - 1, '0', n);
         string->vector.size = len + n;
         ZYCORE_STRING_NULLTERMINATE(string);
 
@@ -300,7 +300,7 @@ ZyanStatus ZyanStringAppendHexU64(ZyanString* string, ZyanU64 value, ZyanU8 padd
             {
                 ZYAN_CHECK(ZyanStringResize(string, string->vector.size + i));
             }
-            buffer = (char*)string->vector.data + len - 1;
+            buffer = ZYAN_STRING_DATA(string) + len - 1;
             if (padding_length > i)
             {
                 n = padding_length - i - 1;
@@ -381,14 +381,14 @@ ZyanStatus ZyanStringAppendFormat(ZyanString* string, const char* format, ...)
 
     const ZyanUSize len = string->vector.size;
 
-    ZyanI32 w = ZYAN_VSNPRINTF((char*)string->vector.data + len - 1,
-        string->vector.capacity - len + 1, format, arglist);
+    ZyanI32 w = ZYAN_VSNPRINTF(ZYAN_STRING_DATA(string) + len - 1,
+        ZYAN_STRING_BUFFER_SIZE(string) - len + 1, format, arglist);
     if (w < 0)
     {
         ZYAN_VA_END(arglist);
         return ZYAN_STATUS_FAILED;
     }
-    if (w <= (ZyanI32)(string->vector.capacity - len))
+    if (w <= (ZyanI32)(ZYAN_STRING_BUFFER_SIZE(string) - len))
     {
         string->vector.size = len + w;
 
@@ -404,14 +404,14 @@ ZyanStatus ZyanStringAppendFormat(ZyanString* string, const char* format, ...)
         return status;
     }
 
-    w = ZYAN_VSNPRINTF((char*)string->vector.data + len - 1,
-        string->vector.capacity - string->vector.size + 1, format, arglist);
+    w = ZYAN_VSNPRINTF(ZYAN_STRING_DATA(string) + len - 1,
+        ZYAN_STRING_BUFFER_SIZE(string) - string->vector.size + 1, format, arglist);
     if (w < 0)
     {
         ZYAN_VA_END(arglist);
         return ZYAN_STATUS_FAILED;
     }
-    ZYAN_ASSERT(w <= (ZyanI32)(string->vector.capacity - string->vector.size));
+    ZYAN_ASSERT(w <= (ZyanI32)(ZYAN_STRING_BUFFER_SIZE(string) - string->vector.size));
 
     ZYAN_VA_END(arglist);
     return ZYAN_STATUS_SUCCESS;
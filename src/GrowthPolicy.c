@@ -0,0 +1,247 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Defines.h>
+#include <Zycore/GrowthPolicy.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The maximum value of a `ZyanUSize`.
+ */
+#define ZYCORE_GROWTH_POLICY_USIZE_MAX \
+    ((ZyanUSize)-1)
+
+/**
+ * The granularity (number of bytes) of size-classes beyond the small size-classes.
+ */
+#define ZYCORE_GROWTH_POLICY_PAGE_SIZE \
+    4096
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Multiplies the given `size` by `1.5`.
+ *
+ * @param   size    The size.
+ *
+ * @return  The grown size or `size`, if the result would overflow.
+ */
+static ZyanUSize ZyanGrowthPolicyGrow(ZyanUSize size)
+{
+    if (size > ZYCORE_GROWTH_POLICY_USIZE_MAX - size / 2)
+    {
+        return size;
+    }
+
+    return size + size / 2;
+}
+
+/**
+ * Rounds the given number of `bytes` up to the next size-class.
+ *
+ * @param   bytes   The number of bytes.
+ *
+ * @return  The size of the size-class or `bytes`, if the result would overflow.
+ */
+static ZyanUSize ZyanGrowthPolicyRoundToSizeClass(ZyanUSize bytes)
+{
+    if (bytes <= 128)
+    {
+        return ZYAN_ALIGN_UP(bytes, 16);
+    }
+    if (bytes <= ZYCORE_GROWTH_POLICY_PAGE_SIZE)
+    {
+        // Four size-classes for each power of two
+        ZyanUSize power = 128;
+        while (power * 2 < bytes)
+        {
+            power *= 2;
+        }
+        return ZYAN_ALIGN_UP(bytes, power / 4);
+    }
+    if (bytes > ZYCORE_GROWTH_POLICY_USIZE_MAX - ZYCORE_GROWTH_POLICY_PAGE_SIZE)
+    {
+        return bytes;
+    }
+
+    return ZYAN_ALIGN_UP(bytes, (ZyanUSize)ZYCORE_GROWTH_POLICY_PAGE_SIZE);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Policies                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanUSize ZyanGrowthPolicyGeometricCalculate(const ZyanGrowthPolicy* policy,
+    ZyanUSize element_size, ZyanUSize size)
+{
+    ZYAN_ASSERT(policy);
+    ZYAN_ASSERT(element_size);
+
+    ZYAN_UNUSED(policy);
+    ZYAN_UNUSED(element_size);
+
+    return ZyanGrowthPolicyGrow(size);
+}
+
+static ZyanUSize ZyanGrowthPolicyPowerOfTwoCalculate(const ZyanGrowthPolicy* policy,
+    ZyanUSize element_size, ZyanUSize size)
+{
+    ZYAN_ASSERT(policy);
+    ZYAN_ASSERT(element_size);
+
+    ZYAN_UNUSED(policy);
+    ZYAN_UNUSED(element_size);
+
+    ZyanUSize capacity = 1;
+    while (capacity < size)
+    {
+        if (capacity > ZYCORE_GROWTH_POLICY_USIZE_MAX / 2)
+        {
+            return size;
+        }
+        capacity *= 2;
+    }
+
+    return capacity;
+}
+
+static ZyanUSize ZyanGrowthPolicySizeClassCalculate(const ZyanGrowthPolicy* policy,
+    ZyanUSize element_size, ZyanUSize size)
+{
+    ZYAN_ASSERT(policy);
+    ZYAN_ASSERT(element_size);
+
+    ZYAN_UNUSED(policy);
+
+    const ZyanUSize capacity = ZyanGrowthPolicyGrow(size);
+    if (capacity > ZYCORE_GROWTH_POLICY_USIZE_MAX / element_size)
+    {
+        return size;
+    }
+
+    return ZyanGrowthPolicyRoundToSizeClass(capacity * element_size) / element_size;
+}
+
+static ZyanUSize ZyanGrowthPolicyLinearCalculate(const ZyanGrowthPolicy* policy,
+    ZyanUSize element_size, ZyanUSize size)
+{
+    ZYAN_ASSERT(policy);
+    ZYAN_ASSERT(element_size);
+
+    if (size > ZYCORE_GROWTH_POLICY_USIZE_MAX / element_size)
+    {
+        return size;
+    }
+    if (size * element_size < policy->parameter)
+    {
+        return ZyanGrowthPolicyGrow(size);
+    }
+
+    const ZyanUSize step = ZYAN_MAX(1, policy->parameter / element_size);
+    if (size > ZYCORE_GROWTH_POLICY_USIZE_MAX - step)
+    {
+        return size;
+    }
+
+    return size + step;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Initialization                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanGrowthPolicyInit(ZyanGrowthPolicy* policy, ZyanGrowthPolicyCalculate calculate,
+    ZyanUSize parameter)
+{
+    if (!policy || !calculate)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    policy->calculate = calculate;
+    policy->parameter = parameter;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanGrowthPolicyInitLinear(ZyanGrowthPolicy* policy, ZyanUSize threshold)
+{
+    return ZyanGrowthPolicyInit(policy, &ZyanGrowthPolicyLinearCalculate,
+        threshold ? threshold : ZYAN_GROWTH_POLICY_DEFAULT_LINEAR_THRESHOLD);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Built-in policies                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+const ZyanGrowthPolicy* ZyanGrowthPolicyGeometric(void)
+{
+    static const ZyanGrowthPolicy policy =
+    {
+        &ZyanGrowthPolicyGeometricCalculate,
+        0
+    };
+    return &policy;
+}
+
+const ZyanGrowthPolicy* ZyanGrowthPolicyPowerOfTwo(void)
+{
+    static const ZyanGrowthPolicy policy =
+    {
+        &ZyanGrowthPolicyPowerOfTwoCalculate,
+        0
+    };
+    return &policy;
+}
+
+const ZyanGrowthPolicy* ZyanGrowthPolicySizeClass(void)
+{
+    static const ZyanGrowthPolicy policy =
+    {
+        &ZyanGrowthPolicySizeClassCalculate,
+        0
+    };
+    return &policy;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
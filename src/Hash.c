@@ -0,0 +1,505 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Hash.h>
+#include <Zycore/LibC.h>
+
+#if defined(ZYAN_GNUC) && defined(__SIZEOF_INT128__)
+#   define ZYCORE_HASH_HAS_INT128
+#endif
+#if defined(ZYAN_MSVC) && defined(ZYAN_X64)
+#   include <intrin.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The secret constants of the hash function.
+ */
+#define ZYCORE_HASH_SECRET0     0xA0761D6478BD642F
+#define ZYCORE_HASH_SECRET1     0xE7037ED1A0B428DB
+#define ZYCORE_HASH_SECRET2     0x8EBC6AF09C88C6E3
+#define ZYCORE_HASH_SECRET3     0x589965CC75374CC3
+
+/**
+ * The size of a block that is processed by the three lanes of the hash function.
+ */
+#define ZYCORE_HASH_BLOCK_SIZE  48
+
+/**
+ * The mask that is or-ed to the input bytes by the case-insensitive functions.
+ */
+#define ZYCORE_HASH_FOLD_MASK   0x2020202020202020
+
+/* ============================================================================================== */
+/* Enums and types                                                                                */
+/* ============================================================================================== */
+
+#ifdef ZYCORE_HASH_HAS_INT128
+
+/**
+ * Defines the `ZyanHashU128` data-type.
+ */
+__extension__ typedef unsigned __int128 ZyanHashU128;
+
+#endif
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Calculates the full 128-bit product of the given values.
+ *
+ * @param   a   A pointer to the first factor. Receives the lower 64 bits of the product.
+ * @param   b   A pointer to the second factor. Receives the upper 64 bits of the product.
+ */
+static void ZyanHashMultiply(ZyanU64* a, ZyanU64* b)
+{
+#if defined(ZYCORE_HASH_HAS_INT128)
+    const ZyanHashU128 product = (ZyanHashU128)*a * *b;
+    *a = (ZyanU64)product;
+    *b = (ZyanU64)(product >> 64);
+#elif defined(ZYAN_MSVC) && defined(ZYAN_X64)
+    *a = _umul128(*a, *b, b);
+#else
+    const ZyanU64 ha = *a >> 32;
+    const ZyanU64 hb = *b >> 32;
+    const ZyanU64 la = (ZyanU32)*a;
+    const ZyanU64 lb = (ZyanU32)*b;
+    const ZyanU64 rh  = ha * hb;
+    const ZyanU64 rm0 = ha * lb;
+    const ZyanU64 rm1 = hb * la;
+    const ZyanU64 rl  = la * lb;
+    const ZyanU64 t   = rl + (rm0 << 32);
+    const ZyanU64 lo  = t + (rm1 << 32);
+    const ZyanU64 c   = (ZyanU64)(t < rl) + (ZyanU64)(lo < t);
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+/**
+ * Multiplies the given values and folds the 128-bit product to 64 bits.
+ *
+ * @param   a   The first factor.
+ * @param   b   The second factor.
+ *
+ * @return  The lower 64 bits of the product xor-ed with the upper 64 bits.
+ */
+static ZyanU64 ZyanHashMix(ZyanU64 a, ZyanU64 b)
+{
+    ZyanHashMultiply(&a, &b);
+    return a ^ b;
+}
+
+/**
+ * Reads 8 bytes from the given address.
+ *
+ * @param   data    A pointer to the data.
+ * @param   fold    The mask that is or-ed to the value.
+ *
+ * @return  The value.
+ */
+static ZyanU64 ZyanHashRead64(const ZyanU8* data, ZyanU64 fold)
+{
+    ZyanU64 value;
+    ZYAN_MEMCPY(&value, data, sizeof(value));
+    return value | fold;
+}
+
+/**
+ * Reads 4 bytes from the given address.
+ *
+ * @param   data    A pointer to the data.
+ * @param   fold    The mask that is or-ed to the value.
+ *
+ * @return  The value.
+ */
+static ZyanU64 ZyanHashRead32(const ZyanU8* data, ZyanU64 fold)
+{
+    ZyanU32 value;
+    ZYAN_MEMCPY(&value, data, sizeof(value));
+    return (ZyanU32)(value | fold);
+}
+
+/**
+ * Processes the given number of blocks.
+ *
+ * @param   lanes   The lanes of the hash function.
+ * @param   data    A pointer to the data.
+ * @param   count   The number of blocks.
+ * @param   fold    The mask that is or-ed to the data.
+ */
+static void ZyanHashProcessBlocks(ZyanU64 lanes[3], const ZyanU8* data, ZyanUSize count,
+    ZyanU64 fold)
+{
+    ZyanU64 l0 = lanes[0];
+    ZyanU64 l1 = lanes[1];
+    ZyanU64 l2 = lanes[2];
+    for (ZyanUSize i = 0; i < count; ++i, data += ZYCORE_HASH_BLOCK_SIZE)
+    {
+        l0 = ZyanHashMix(ZyanHashRead64(data +  0, fold) ^ ZYCORE_HASH_SECRET1,
+            ZyanHashRead64(data +  8, fold) ^ l0);
+        l1 = ZyanHashMix(ZyanHashRead64(data + 16, fold) ^ ZYCORE_HASH_SECRET2,
+            ZyanHashRead64(data + 24, fold) ^ l1);
+        l2 = ZyanHashMix(ZyanHashRead64(data + 32, fold) ^ ZYCORE_HASH_SECRET3,
+            ZyanHashRead64(data + 40, fold) ^ l2);
+    }
+    lanes[0] = l0;
+    lanes[1] = l1;
+    lanes[2] = l2;
+}
+
+/**
+ * Calculates the final hash value.
+ *
+ * @param   a       The first value.
+ * @param   b       The second value.
+ * @param   seed    The current seed.
+ * @param   length  The total length of the data.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 ZyanHashFinish(ZyanU64 a, ZyanU64 b, ZyanU64 seed, ZyanU64 length)
+{
+    a ^= ZYCORE_HASH_SECRET1;
+    b ^= seed;
+    ZyanHashMultiply(&a, &b);
+    return ZyanHashMix(a ^ ZYCORE_HASH_SECRET0 ^ length, b ^ ZYCORE_HASH_SECRET1);
+}
+
+/**
+ * Calculates the hash value of data that is not longer than 16 bytes.
+ *
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ * @param   seed    The current seed.
+ * @param   fold    The mask that is or-ed to the data.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 ZyanHashSmall(const ZyanU8* data, ZyanUSize size, ZyanU64 seed, ZyanU64 fold)
+{
+    ZYAN_ASSERT(size <= 16);
+
+    ZyanU64 a = 0;
+    ZyanU64 b = 0;
+    if (size >= 4)
+    {
+        // Two overlapping reads from each end cover all bytes
+        const ZyanUSize offset = (size >> 3) << 2;
+        a = (ZyanHashRead32(data, fold) << 32) | ZyanHashRead32(data + offset, fold);
+        b = (ZyanHashRead32(data + size - 4, fold) << 32) |
+            ZyanHashRead32(data + size - 4 - offset, fold);
+    } else
+    {
+        if (size)
+        {
+            const ZyanU8 f = (ZyanU8)fold;
+            a = ((ZyanU64)(data[0] | f) << 16) | ((ZyanU64)(data[size >> 1] | f) << 8) |
+                (ZyanU64)(data[size - 1] | f);
+        }
+    }
+
+    return ZyanHashFinish(a, b, seed, size);
+}
+
+/**
+ * Calculates the hash value of the remaining bytes after all blocks have been processed.
+ *
+ * @param   data    A pointer to the remaining bytes. The 16 bytes in front of the remaining bytes
+ *                  must be readable, if less than 16 bytes remain.
+ * @param   size    The number of remaining bytes. Must be between `1` and `48`.
+ * @param   seed    The current seed.
+ * @param   length  The total length of the data. Must be greater than `16`.
+ * @param   fold    The mask that is or-ed to the data.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 ZyanHashTail(const ZyanU8* data, ZyanUSize size, ZyanU64 seed, ZyanU64 length,
+    ZyanU64 fold)
+{
+    ZYAN_ASSERT(size >= 1);
+    ZYAN_ASSERT(size <= ZYCORE_HASH_BLOCK_SIZE);
+    ZYAN_ASSERT(length > 16);
+
+    while (size > 16)
+    {
+        seed = ZyanHashMix(ZyanHashRead64(data, fold) ^ ZYCORE_HASH_SECRET1,
+            ZyanHashRead64(data + 8, fold) ^ seed);
+        data += 16;
+        size -= 16;
+    }
+
+    return ZyanHashFinish(ZyanHashRead64(data + size - 16, fold),
+        ZyanHashRead64(data + size - 8, fold), seed, length);
+}
+
+/**
+ * Applies the seed transformation to the given seed.
+ *
+ * @param   seed    The seed value.
+ *
+ * @return  The transformed seed.
+ */
+static ZyanU64 ZyanHashInitSeed(ZyanU64 seed)
+{
+    return seed ^ ZyanHashMix(seed ^ ZYCORE_HASH_SECRET0, ZYCORE_HASH_SECRET1);
+}
+
+/**
+ * Calculates the hash value of the given data.
+ *
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ * @param   seed    The seed value.
+ * @param   fold    The mask that is or-ed to the data.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 ZyanHashCompute(const ZyanU8* data, ZyanUSize size, ZyanU64 seed, ZyanU64 fold)
+{
+    seed = ZyanHashInitSeed(seed);
+    if (size <= 16)
+    {
+        return ZyanHashSmall(data, size, seed, fold);
+    }
+
+    ZyanUSize remaining = size;
+    if (remaining > ZYCORE_HASH_BLOCK_SIZE)
+    {
+        // The last (possibly incomplete) block is always handled by the tail function
+        ZyanU64 lanes[3] = { seed, seed, seed };
+        const ZyanUSize count = (remaining - 1) / ZYCORE_HASH_BLOCK_SIZE;
+        ZyanHashProcessBlocks(lanes, data, count, fold);
+        data += count * ZYCORE_HASH_BLOCK_SIZE;
+        remaining -= count * ZYCORE_HASH_BLOCK_SIZE;
+        seed = lanes[0] ^ lanes[1] ^ lanes[2];
+    }
+
+    return ZyanHashTail(data, remaining, seed, size, fold);
+}
+
+/**
+ * Copies data to the given buffer.
+ *
+ * @param   destination A pointer to the destination buffer.
+ * @param   source      A pointer to the source buffer.
+ * @param   size        The number of bytes to copy.
+ * @param   fold        The mask that is or-ed to the data.
+ */
+static void ZyanHashCopy(ZyanU8* destination, const ZyanU8* source, ZyanUSize size,
+    ZyanU64 fold)
+{
+    ZYAN_MEMCPY(destination, source, size);
+    if (fold)
+    {
+        for (ZyanUSize i = 0; i < size; ++i)
+        {
+            destination[i] |= (ZyanU8)fold;
+        }
+    }
+}
+
+/**
+ * Feeds the given data to the hash function.
+ *
+ * @param   state   A pointer to the `ZyanHashState` instance.
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ * @param   fold    The mask that is or-ed to the data.
+ */
+static void ZyanHashFeed(ZyanHashState* state, const ZyanU8* data, ZyanUSize size, ZyanU64 fold)
+{
+    ZYAN_ASSERT(state);
+    ZYAN_ASSERT(state->pending <= ZYCORE_HASH_BLOCK_SIZE);
+
+    // A block is only processed, once it is known that it is not the last one
+    state->length += size;
+    while (size)
+    {
+        if (state->pending == ZYCORE_HASH_BLOCK_SIZE)
+        {
+            ZyanHashProcessBlocks(state->lanes, state->buffer + 16, 1, 0);
+            ZYAN_MEMCPY(state->buffer, state->buffer + ZYCORE_HASH_BLOCK_SIZE, 16);
+            state->pending = 0;
+        }
+        if (!state->pending && (size > ZYCORE_HASH_BLOCK_SIZE))
+        {
+            // Process complete blocks directly from the input
+            const ZyanUSize blocks = (size - 1) / ZYCORE_HASH_BLOCK_SIZE;
+            ZyanHashProcessBlocks(state->lanes, data, blocks, fold);
+            data += blocks * ZYCORE_HASH_BLOCK_SIZE;
+            size -= blocks * ZYCORE_HASH_BLOCK_SIZE;
+            ZyanHashCopy(state->buffer, data - 16, 16, fold);
+        }
+
+        const ZyanUSize count = ZYAN_MIN(size, ZYCORE_HASH_BLOCK_SIZE - state->pending);
+        ZyanHashCopy(state->buffer + 16 + state->pending, data, count, fold);
+        state->pending += count;
+        data += count;
+        size -= count;
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* One-shot hashing                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanU64 ZyanHash(const void* data, ZyanUSize size, ZyanU64 seed)
+{
+    ZYAN_ASSERT(data || !size);
+
+    return ZyanHashCompute((const ZyanU8*)data, size, seed, 0);
+}
+
+ZyanU64 ZyanHashI(const void* data, ZyanUSize size, ZyanU64 seed)
+{
+    ZYAN_ASSERT(data || !size);
+
+    return ZyanHashCompute((const ZyanU8*)data, size, seed, ZYCORE_HASH_FOLD_MASK);
+}
+
+ZyanStatus ZyanHashString(const ZyanStringView* string, ZyanU64 seed, ZyanU64* hash)
+{
+    if (!string || !hash)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const char* data;
+    ZyanUSize size;
+    ZYAN_CHECK(ZyanStringGetData(&string->string, &data));
+    ZYAN_CHECK(ZyanStringGetSize(&string->string, &size));
+
+    *hash = ZyanHashCompute((const ZyanU8*)data, size, seed, 0);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHashStringI(const ZyanStringView* string, ZyanU64 seed, ZyanU64* hash)
+{
+    if (!string || !hash)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const char* data;
+    ZyanUSize size;
+    ZYAN_CHECK(ZyanStringGetData(&string->string, &data));
+    ZYAN_CHECK(ZyanStringGetSize(&string->string, &size));
+
+    *hash = ZyanHashCompute((const ZyanU8*)data, size, seed, ZYCORE_HASH_FOLD_MASK);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Incremental hashing                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashInit(ZyanHashState* state, ZyanU64 seed)
+{
+    if (!state)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    seed = ZyanHashInitSeed(seed);
+
+    state->lanes[0] = seed;
+    state->lanes[1] = seed;
+    state->lanes[2] = seed;
+    state->length   = 0;
+    state->pending  = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHashUpdate(ZyanHashState* state, const void* data, ZyanUSize size)
+{
+    if (!state || (!data && size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanHashFeed(state, (const ZyanU8*)data, size, 0);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHashUpdateI(ZyanHashState* state, const void* data, ZyanUSize size)
+{
+    if (!state || (!data && size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanHashFeed(state, (const ZyanU8*)data, size, ZYCORE_HASH_FOLD_MASK);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHashFinalize(const ZyanHashState* state, ZyanU64* hash)
+{
+    if (!state || !hash)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanU8* const pending = state->buffer + 16;
+    if (state->length <= 16)
+    {
+        *hash = ZyanHashSmall(pending, state->pending, state->lanes[0], 0);
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZyanU64 seed = state->lanes[0];
+    if (state->length > ZYCORE_HASH_BLOCK_SIZE)
+    {
+        seed ^= state->lanes[1] ^ state->lanes[2];
+    }
+    *hash = ZyanHashTail(pending, state->pending, seed, state->length, 0);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,848 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Hash.h>
+#include <Zycore/HashMap.h>
+#include <Zycore/LibC.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The maximum probe distance of an entry (plus one).
+ */
+#define ZYCORE_HASH_MAP_MAX_DISTANCE    255
+
+/**
+ * The minimum number of slots of a dynamically allocated hash map.
+ */
+#define ZYCORE_HASH_MAP_MIN_SLOT_COUNT  8
+
+/**
+ * The maximum natural alignment of keys and values.
+ */
+#define ZYCORE_HASH_MAP_MAX_ALIGNMENT   16
+
+/**
+ * Returns the address of the entry in the given slot.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   position    The slot index.
+ *
+ * @return  The address of the entry in the given slot.
+ */
+#define ZYCORE_HASH_MAP_ENTRY(map, position) \
+    ((void*)((ZyanU8*)(map)->data + ((position) * (map)->entry_size)))
+
+/**
+ * Returns the address of the value of the given entry.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   entry   A pointer to the entry.
+ *
+ * @return  The address of the value of the given entry.
+ */
+#define ZYCORE_HASH_MAP_VALUE(map, entry) \
+    ((void*)((ZyanU8*)(entry) + (map)->value_offset))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Hashing                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the preferred slot of the given `key`.
+ *
+ * @param   map A pointer to the `ZyanHashMap` instance.
+ * @param   key A pointer to the key.
+ *
+ * @return  The index of the preferred slot.
+ */
+static ZyanUSize ZyanHashMapGetHomeSlot(const ZyanHashMap* map, const void* key)
+{
+    ZYAN_ASSERT(map);
+    ZYAN_ASSERT(key);
+
+    ZyanU64 hash;
+    if (map->hash)
+    {
+        hash = map->hash(key);
+    } else
+    {
+        if (map->key_size == sizeof(ZyanU64))
+        {
+            ZyanU64 value;
+            ZYAN_MEMCPY(&value, key, sizeof(value));
+            hash = ZyanHashU64(value);
+        } else
+        {
+            hash = ZyanHash(key, map->key_size, 0);
+        }
+    }
+
+    // Fibonacci hashing scrambles weak hash values and selects the upper bits
+    return (ZyanUSize)((hash * 0x9E3779B97F4A7C15) >> map->shift);
+}
+
+/**
+ * Checks, if the given keys are equal.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   left    A pointer to the first key.
+ * @param   right   A pointer to the second key.
+ *
+ * @return  `ZYAN_TRUE`, if the keys are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanHashMapKeyEquals(const ZyanHashMap* map, const void* left,
+    const void* right)
+{
+    ZYAN_ASSERT(map);
+
+    if (map->equals)
+    {
+        return map->equals(left, right);
+    }
+    if (map->key_size == sizeof(ZyanU64))
+    {
+        // Avoid the `memcmp` call for the most common key size
+        ZyanU64 a;
+        ZyanU64 b;
+        ZYAN_MEMCPY(&a, left, sizeof(a));
+        ZYAN_MEMCPY(&b, right, sizeof(b));
+        return (a == b) ? ZYAN_TRUE : ZYAN_FALSE;
+    }
+    return ZYAN_MEMCMP(left, right, map->key_size) ? ZYAN_FALSE : ZYAN_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the natural alignment of an object with the given size.
+ *
+ * @param   size    The size of the object in bytes.
+ *
+ * @return  The largest power of two that divides `size`, limited to the maximum alignment.
+ */
+static ZyanUSize ZyanHashMapGetAlignment(ZyanUSize size)
+{
+    if (!size)
+    {
+        return 1;
+    }
+    return ZYAN_MIN(size & (~size + 1), (ZyanUSize)ZYCORE_HASH_MAP_MAX_ALIGNMENT);
+}
+
+/**
+ * Returns the number of entries that fit into the given number of slots.
+ *
+ * @param   slot_count  The number of slots.
+ *
+ * @return  The number of entries that fit into the given number of slots without exceeding the
+ *          maximum load factor of `7/8`.
+ */
+static ZyanUSize ZyanHashMapGetMaxLoad(ZyanUSize slot_count)
+{
+    return slot_count - ZYAN_MAX(1, slot_count / 8);
+}
+
+/**
+ * Calculates the number of slots required to hold the given number of entries.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   capacity    The desired capacity.
+ * @param   slot_count  Receives the number of slots.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanHashMapCalcSlotCount(const ZyanHashMap* map, ZyanUSize capacity,
+    ZyanUSize* slot_count)
+{
+    ZYAN_ASSERT(map);
+    ZYAN_ASSERT(slot_count);
+
+    const ZyanUSize limit = (ZyanUSize)-1 / (map->entry_size + 1) / 2;
+
+    ZyanUSize count = ZYCORE_HASH_MAP_MIN_SLOT_COUNT;
+    while (ZyanHashMapGetMaxLoad(count) < capacity)
+    {
+        if (count > limit)
+        {
+            return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+        }
+        count *= 2;
+    }
+
+    *slot_count = count;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Initializes the key, value and callback related fields of the given hash map.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   key_size    The size of a single key in bytes.
+ * @param   value_size  The size of a single value in bytes.
+ * @param   hash        The hash callback.
+ * @param   equals      The equality callback.
+ * @param   destructor  The entry destructor callback.
+ */
+static void ZyanHashMapInitLayout(ZyanHashMap* map, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanHashMapHashFunction hash, ZyanEqualityComparison equals, ZyanHashMapDestructor destructor)
+{
+    ZYAN_ASSERT(map);
+    ZYAN_ASSERT(key_size);
+
+    // Lay out the entries like a `struct { key; value; }` would be
+    const ZyanUSize key_alignment   = ZyanHashMapGetAlignment(key_size);
+    const ZyanUSize value_alignment = ZyanHashMapGetAlignment(value_size);
+
+    map->allocator    = ZYAN_NULL;
+    map->hash         = hash;
+    map->equals       = equals;
+    map->destructor   = destructor;
+    map->size         = 0;
+    map->capacity     = 0;
+    map->slot_count   = 0;
+    map->shift        = 0;
+    map->key_size     = key_size;
+    map->value_size   = value_size;
+    map->value_offset = ZYAN_ALIGN_UP(key_size, value_alignment);
+    map->entry_size   = ZYAN_ALIGN_UP(map->value_offset + value_size,
+        ZYAN_MAX(key_alignment, value_alignment));
+    map->distances    = ZYAN_NULL;
+    map->data         = ZYAN_NULL;
+}
+
+/**
+ * Assigns a new (empty) storage buffer to the given hash map.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   data        A pointer to the storage buffer.
+ * @param   slot_count  The number of slots. Must be a power of two.
+ */
+static void ZyanHashMapAssignStorage(ZyanHashMap* map, void* data, ZyanUSize slot_count)
+{
+    ZYAN_ASSERT(map);
+    ZYAN_ASSERT(data);
+    ZYAN_ASSERT(slot_count >= 2);
+    ZYAN_ASSERT(ZYAN_IS_POWER_OF_2(slot_count));
+
+    ZyanU8 shift = 64;
+    for (ZyanUSize count = slot_count; count > 1; count >>= 1)
+    {
+        --shift;
+    }
+
+    map->data       = data;
+    map->distances  = (ZyanU8*)data + slot_count * map->entry_size;
+    map->slot_count = slot_count;
+    map->shift      = shift;
+    map->capacity   = ZyanHashMapGetMaxLoad(slot_count);
+
+    ZYAN_MEMSET(map->distances, 0, slot_count);
+}
+
+/**
+ * Searches for the slot of the given `key`.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   key         A pointer to the key.
+ * @param   position    Receives the slot of the key, if found, or the slot where the key has to
+ *                      be inserted, if not.
+ * @param   distance    Receives the probe distance (plus one) for the insertion of the key, if
+ *                      not found.
+ *
+ * @return  `ZYAN_TRUE`, if the key was found or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanHashMapLocate(const ZyanHashMap* map, const void* key, ZyanUSize* position,
+    ZyanUSize* distance)
+{
+    ZYAN_ASSERT(map);
+    ZYAN_ASSERT(position);
+    ZYAN_ASSERT(distance);
+
+    const ZyanUSize mask = map->slot_count - 1;
+    ZyanUSize i = ZyanHashMapGetHomeSlot(map, key);
+    ZyanUSize d = 1;
+
+    // Entries with a shorter probe distance than ours can not be followed by our key
+    while (map->distances[i] >= d)
+    {
+        if ((map->distances[i] == d) &&
+            ZyanHashMapKeyEquals(map, key, ZYCORE_HASH_MAP_ENTRY(map, i)))
+        {
+            *position = i;
+            return ZYAN_TRUE;
+        }
+        i = (i + 1) & mask;
+        ++d;
+    }
+
+    *position = i;
+    *distance = d;
+    return ZYAN_FALSE;
+}
+
+/**
+ * Frees the given slot by moving the following entries back by one slot.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   position    The slot index.
+ * @param   distance    The probe distance (plus one) of the entry that is going to be stored in
+ *                      the slot.
+ *
+ * @return  `ZYAN_TRUE`, if the slot was freed or `ZYAN_FALSE`, if the maximum probe distance would
+ *          be exceeded.
+ */
+static ZyanBool ZyanHashMapMakeRoom(ZyanHashMap* map, ZyanUSize position, ZyanUSize distance)
+{
+    ZYAN_ASSERT(map);
+    ZYAN_ASSERT(map->size < map->slot_count);
+
+    if (distance > ZYCORE_HASH_MAP_MAX_DISTANCE)
+    {
+        return ZYAN_FALSE;
+    }
+
+    const ZyanUSize mask = map->slot_count - 1;
+    ZyanUSize i = position;
+    while (map->distances[i])
+    {
+        if (map->distances[i] == ZYCORE_HASH_MAP_MAX_DISTANCE)
+        {
+            return ZYAN_FALSE;
+        }
+        i = (i + 1) & mask;
+    }
+
+    while (i != position)
+    {
+        const ZyanUSize previous = (i - 1) & mask;
+        ZYAN_MEMCPY(ZYCORE_HASH_MAP_ENTRY(map, i), ZYCORE_HASH_MAP_ENTRY(map, previous),
+            map->entry_size);
+        map->distances[i] = map->distances[previous] + 1;
+        i = previous;
+    }
+    map->distances[position] = (ZyanU8)distance;
+
+    return ZYAN_TRUE;
+}
+
+/**
+ * Invokes the destructor callback for all entries.
+ *
+ * @param   map A pointer to the `ZyanHashMap` instance.
+ */
+static void ZyanHashMapDestroyEntries(ZyanHashMap* map)
+{
+    ZYAN_ASSERT(map);
+
+    if (!map->destructor)
+    {
+        return;
+    }
+
+    for (ZyanUSize i = 0; i < map->slot_count; ++i)
+    {
+        if (map->distances[i])
+        {
+            void* const entry = ZYCORE_HASH_MAP_ENTRY(map, i);
+            map->destructor(entry, ZYCORE_HASH_MAP_VALUE(map, entry));
+        }
+    }
+}
+
+/**
+ * Moves all entries to a newly allocated buffer with the given number of slots.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   slot_count  The new number of slots.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanHashMapRehash(ZyanHashMap* map, ZyanUSize slot_count)
+{
+    ZYAN_ASSERT(map);
+    ZYAN_ASSERT(map->allocator);
+    ZYAN_ASSERT(ZyanHashMapGetMaxLoad(slot_count) >= map->size);
+
+    void* data;
+    ZYAN_CHECK(map->allocator->allocate(map->allocator, &data, map->entry_size + 1,
+        slot_count));
+
+    const ZyanHashMap old = *map;
+    ZyanHashMapAssignStorage(map, data, slot_count);
+
+    const ZyanUSize mask = slot_count - 1;
+    for (ZyanUSize i = 0; i < old.slot_count; ++i)
+    {
+        if (!old.distances[i])
+        {
+            continue;
+        }
+
+        // The keys are known to be unique, so the equality check can be skipped
+        const void* const entry = ZYCORE_HASH_MAP_ENTRY(&old, i);
+        ZyanUSize position = ZyanHashMapGetHomeSlot(map, entry);
+        ZyanUSize distance = 1;
+        while (map->distances[position] >= distance)
+        {
+            position = (position + 1) & mask;
+            ++distance;
+        }
+        if (!ZyanHashMapMakeRoom(map, position, distance))
+        {
+            ZYAN_CHECK(map->allocator->deallocate(map->allocator, data, map->entry_size + 1,
+                slot_count));
+            *map = old;
+            return ZYAN_STATUS_INVALID_OPERATION;
+        }
+        ZYAN_MEMCPY(ZYCORE_HASH_MAP_ENTRY(map, position), entry, map->entry_size);
+    }
+
+    return map->allocator->deallocate(map->allocator, old.data, old.entry_size + 1,
+        old.slot_count);
+}
+
+/**
+ * Makes room for another entry after an insertion failed.
+ *
+ * @param   map A pointer to the `ZyanHashMap` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanHashMapGrow(ZyanHashMap* map)
+{
+    ZYAN_ASSERT(map);
+
+    if (!map->allocator)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    // Growing a sparsely populated hash map does not help, if the probe distance exceeded its
+    // maximum because of too many colliding hash values
+    if ((map->size < map->capacity) && (map->size < map->slot_count / 4))
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    if (map->slot_count > (ZyanUSize)-1 / (map->entry_size + 1) / 2)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    return ZyanHashMapRehash(map, map->slot_count * 2);
+}
+
+/**
+ * Returns the entry for the given `key` and inserts a new entry, if the key does not exist yet.
+ *
+ * @param   map     A pointer to the `ZyanHashMap` instance.
+ * @param   key     A pointer to the key.
+ * @param   entry   Receives a pointer to the entry.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if a new entry was inserted, `ZYAN_STATUS_FALSE` if the key already
+ *          existed, or another zyan status code, if an error occurred.
+ *
+ * Only the key of a newly inserted entry is initialized.
+ */
+static ZyanStatus ZyanHashMapInsertKey(ZyanHashMap* map, const void* key, void** entry)
+{
+    ZYAN_ASSERT(map);
+    ZYAN_ASSERT(key);
+    ZYAN_ASSERT(entry);
+
+    ZyanUSize position;
+    ZyanUSize distance;
+    if (ZyanHashMapLocate(map, key, &position, &distance))
+    {
+        *entry = ZYCORE_HASH_MAP_ENTRY(map, position);
+        return ZYAN_STATUS_FALSE;
+    }
+
+    while ((map->size >= map->capacity) || !ZyanHashMapMakeRoom(map, position, distance))
+    {
+        ZYAN_CHECK(ZyanHashMapGrow(map));
+        ZyanHashMapLocate(map, key, &position, &distance);
+    }
+
+    *entry = ZYCORE_HASH_MAP_ENTRY(map, position);
+    ZYAN_MEMCPY(*entry, key, map->key_size);
+    ++map->size;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanHashMapInit(ZyanHashMap* map, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanUSize capacity, ZyanHashMapHashFunction hash, ZyanEqualityComparison equals,
+    ZyanHashMapDestructor destructor)
+{
+    return ZyanHashMapInitEx(map, key_size, value_size, capacity, hash, equals, destructor,
+        ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanHashMapInitEx(ZyanHashMap* map, ZyanUSize key_size, ZyanUSize value_size,
+    ZyanUSize capacity, ZyanHashMapHashFunction hash, ZyanEqualityComparison equals,
+    ZyanHashMapDestructor destructor, ZyanAllocator* allocator)
+{
+    if (!map || !key_size || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+
+    ZyanHashMapInitLayout(map, key_size, value_size, hash, equals, destructor);
+
+    ZyanUSize slot_count;
+    ZYAN_CHECK(ZyanHashMapCalcSlotCount(map, ZYAN_MAX(ZYAN_HASH_MAP_MIN_CAPACITY, capacity),
+        &slot_count));
+
+    void* data;
+    ZYAN_CHECK(allocator->allocate(allocator, &data, map->entry_size + 1, slot_count));
+
+    map->allocator = allocator;
+    ZyanHashMapAssignStorage(map, data, slot_count);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHashMapInitCustomBuffer(ZyanHashMap* map, ZyanUSize key_size,
+    ZyanUSize value_size, ZyanHashMapHashFunction hash, ZyanEqualityComparison equals,
+    void* buffer, ZyanUSize buffer_size, ZyanHashMapDestructor destructor)
+{
+    if (!map || !key_size || !buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanHashMapInitLayout(map, key_size, value_size, hash, equals, destructor);
+
+    const ZyanUSize max_slot_count = buffer_size / (map->entry_size + 1);
+    if (max_slot_count < 2)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize slot_count = 2;
+    while (slot_count <= max_slot_count / 2)
+    {
+        slot_count *= 2;
+    }
+
+    ZyanHashMapAssignStorage(map, buffer, slot_count);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHashMapDestroy(ZyanHashMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(map->data);
+
+    ZyanHashMapDestroyEntries(map);
+
+    if (map->allocator)
+    {
+        ZYAN_ASSERT(map->allocator->deallocate);
+        ZYAN_CHECK(map->allocator->deallocate(map->allocator, map->data, map->entry_size + 1,
+            map->slot_count));
+    }
+
+    map->data = ZYAN_NULL;
+    map->distances = ZYAN_NULL;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapFind(const ZyanHashMap* map, const void* key, const void** value)
+{
+    return ZyanHashMapFindMutable(map, key, (void**)value);
+}
+
+ZyanStatus ZyanHashMapFindMutable(const ZyanHashMap* map, const void* key, void** value)
+{
+    if (!map || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(map->data);
+
+    ZyanUSize position;
+    ZyanUSize distance;
+    if (!ZyanHashMapLocate(map, key, &position, &distance))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    if (value)
+    {
+        *value = ZYCORE_HASH_MAP_VALUE(map, ZYCORE_HASH_MAP_ENTRY(map, position));
+    }
+
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapInsert(ZyanHashMap* map, const void* key, const void* value)
+{
+    if (!map || !key || (!value && map->value_size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(map->data);
+
+    void* entry;
+    const ZyanStatus status = ZyanHashMapInsertKey(map, key, &entry);
+    if (status == ZYAN_STATUS_FALSE)
+    {
+        if (map->destructor)
+        {
+            map->destructor(entry, ZYCORE_HASH_MAP_VALUE(map, entry));
+        }
+        ZYAN_MEMCPY(entry, key, map->key_size);
+    } else
+    {
+        ZYAN_CHECK(status);
+    }
+
+    if (map->value_size)
+    {
+        ZYAN_MEMCPY(ZYCORE_HASH_MAP_VALUE(map, entry), value, map->value_size);
+    }
+
+    return status;
+}
+
+ZyanStatus ZyanHashMapEmplace(ZyanHashMap* map, const void* key, void** value)
+{
+    if (!map || !key || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(map->data);
+
+    void* entry;
+    const ZyanStatus status = ZyanHashMapInsertKey(map, key, &entry);
+    ZYAN_CHECK(status);
+
+    *value = ZYCORE_HASH_MAP_VALUE(map, entry);
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapErase(ZyanHashMap* map, const void* key)
+{
+    if (!map || !key)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(map->data);
+
+    ZyanUSize position;
+    ZyanUSize distance;
+    if (!ZyanHashMapLocate(map, key, &position, &distance))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    if (map->destructor)
+    {
+        void* const entry = ZYCORE_HASH_MAP_ENTRY(map, position);
+        map->destructor(entry, ZYCORE_HASH_MAP_VALUE(map, entry));
+    }
+
+    // Move the following entries one slot closer to their preferred slot, which removes the need
+    // for tombstones
+    const ZyanUSize mask = map->slot_count - 1;
+    ZyanUSize next = (position + 1) & mask;
+    while (map->distances[next] > 1)
+    {
+        ZYAN_MEMCPY(ZYCORE_HASH_MAP_ENTRY(map, position), ZYCORE_HASH_MAP_ENTRY(map, next),
+            map->entry_size);
+        map->distances[position] = map->distances[next] - 1;
+        position = next;
+        next = (next + 1) & mask;
+    }
+    map->distances[position] = 0;
+    --map->size;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanHashMapClear(ZyanHashMap* map)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(map->data);
+
+    ZyanHashMapDestroyEntries(map);
+    ZYAN_MEMSET(map->distances, 0, map->slot_count);
+    map->size = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Iteration                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapIterate(const ZyanHashMap* map, ZyanUSize* iterator, const void** key,
+    void** value)
+{
+    if (!map || !iterator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(map->data);
+
+    for (ZyanUSize i = *iterator; i < map->slot_count; ++i)
+    {
+        if (!map->distances[i])
+        {
+            continue;
+        }
+
+        void* const entry = ZYCORE_HASH_MAP_ENTRY(map, i);
+        if (key)
+        {
+            *key = entry;
+        }
+        if (value)
+        {
+            *value = ZYCORE_HASH_MAP_VALUE(map, entry);
+        }
+        *iterator = i + 1;
+
+        return ZYAN_STATUS_TRUE;
+    }
+
+    *iterator = map->slot_count;
+    return ZYAN_STATUS_FALSE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapReserve(ZyanHashMap* map, ZyanUSize capacity)
+{
+    if (!map)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(map->data);
+
+    if (capacity <= map->capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+    if (!map->allocator)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZyanUSize slot_count;
+    ZYAN_CHECK(ZyanHashMapCalcSlotCount(map, capacity, &slot_count));
+
+    return ZyanHashMapRehash(map, slot_count);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHashMapGetCapacity(const ZyanHashMap* map, ZyanUSize* capacity)
+{
+    if (!map || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = map->capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanHashMapGetSize(const ZyanHashMap* map, ZyanUSize* size)
+{
+    if (!map || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = map->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
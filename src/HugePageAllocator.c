@@ -0,0 +1,309 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/HugePageAllocator.h>
+#include <Zycore/LibC.h>
+#include <Zycore/API/Memory.h>
+
+#ifndef ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The size of the header that precedes each memory block.
+ *
+ * The header stores the size of the block and the size of its huge page backed region.
+ */
+#define ZYCORE_HUGE_PAGE_HEADER_SIZE \
+    ZYAN_HUGE_PAGE_ALIGNMENT
+
+/**
+ * Returns a reference to the size field of the memory block with the given `header`.
+ *
+ * @param   header  A pointer to the header of a memory block.
+ *
+ * @return  A reference to the size field of the memory block.
+ */
+#define ZYCORE_HUGE_PAGE_BLOCK_SIZE(header) \
+    (((ZyanUSize*)(header))[0])
+
+/**
+ * Returns a reference to the region size field of the memory block with the given `header`.
+ *
+ * @param   header  A pointer to the header of a memory block.
+ *
+ * @return  A reference to the size of the huge page backed region or `0`, if the block was
+ *          obtained from the backing allocator.
+ */
+#define ZYCORE_HUGE_PAGE_BLOCK_REGION(header) \
+    (((ZyanUSize*)(header))[1])
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Checks, if a memory block of the given `size` should be backed by huge pages.
+ *
+ * @param   allocator   A pointer to the `ZyanHugePageAllocator` instance.
+ * @param   size        The size of the memory block in bytes.
+ *
+ * @return  `ZYAN_TRUE`, if the block should be backed by huge pages or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanHugePageIsHugeBlock(const ZyanHugePageAllocator* allocator, ZyanUSize size)
+{
+    ZYAN_ASSERT(allocator);
+
+    return (allocator->page_size && (size >= allocator->threshold)) ? ZYAN_TRUE : ZYAN_FALSE;
+}
+
+/**
+ * Calculates the size of a memory block of `element_size * n` bytes.
+ *
+ * @param   allocator       A pointer to the `ZyanHugePageAllocator` instance.
+ * @param   element_size    The size of a single element.
+ * @param   n               The number of elements.
+ * @param   size            Receives the size of the block (without the header).
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanHugePageCalcBlockSize(const ZyanHugePageAllocator* allocator,
+    ZyanUSize element_size, ZyanUSize n, ZyanUSize* size)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(size);
+
+    const ZyanUSize max = (ZyanUSize)-1 - ZYCORE_HUGE_PAGE_HEADER_SIZE - allocator->page_size;
+    if (n > max / element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = element_size * n;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Acquires a new memory block.
+ *
+ * @param   allocator   A pointer to the `ZyanHugePageAllocator` instance.
+ * @param   size        The size of the memory block in bytes.
+ * @param   header      Receives a pointer to the header of the new memory block.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanHugePageAcquire(ZyanHugePageAllocator* allocator, ZyanUSize size,
+    void** header)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(header);
+
+    const ZyanUSize total = ZYCORE_HUGE_PAGE_HEADER_SIZE + size;
+
+    ZyanUSize region = 0;
+    if (ZyanHugePageIsHugeBlock(allocator, size))
+    {
+        region = ZYAN_ALIGN_UP(total, (ZyanUSize)allocator->page_size);
+        ZYAN_CHECK(ZyanMemoryVirtualAllocHuge(header, region, ZYAN_PAGE_READWRITE, ZYAN_NULL));
+    } else
+    {
+        ZYAN_CHECK(allocator->backing->allocate(allocator->backing, header, 1, total));
+    }
+
+    ZYCORE_HUGE_PAGE_BLOCK_SIZE(*header) = size;
+    ZYCORE_HUGE_PAGE_BLOCK_REGION(*header) = region;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Releases the given memory block.
+ *
+ * @param   allocator   A pointer to the `ZyanHugePageAllocator` instance.
+ * @param   header      A pointer to the header of the memory block.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanHugePageRelease(ZyanHugePageAllocator* allocator, void* header)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(header);
+
+    const ZyanUSize region = ZYCORE_HUGE_PAGE_BLOCK_REGION(header);
+    if (region)
+    {
+        return ZyanMemoryVirtualFree(header, region);
+    }
+
+    return allocator->backing->deallocate(allocator->backing, header, 1,
+        ZYCORE_HUGE_PAGE_HEADER_SIZE + ZYCORE_HUGE_PAGE_BLOCK_SIZE(header));
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator interface                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanHugePageAllocatorAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanHugePageAllocator* const huge = (ZyanHugePageAllocator*)allocator;
+
+    ZyanUSize size;
+    ZYAN_CHECK(ZyanHugePageCalcBlockSize(huge, element_size, n, &size));
+
+    void* header;
+    ZYAN_CHECK(ZyanHugePageAcquire(huge, size, &header));
+    *p = (ZyanU8*)header + ZYCORE_HUGE_PAGE_HEADER_SIZE;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanHugePageAllocatorReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(*p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanHugePageAllocator* const huge = (ZyanHugePageAllocator*)allocator;
+
+    ZyanUSize size;
+    ZYAN_CHECK(ZyanHugePageCalcBlockSize(huge, element_size, n, &size));
+
+    void* header = (ZyanU8*)*p - ZYCORE_HUGE_PAGE_HEADER_SIZE;
+    const ZyanUSize old_size = ZYCORE_HUGE_PAGE_BLOCK_SIZE(header);
+    const ZyanUSize region = ZYCORE_HUGE_PAGE_BLOCK_REGION(header);
+    const ZyanBool is_huge = ZyanHugePageIsHugeBlock(huge, size);
+
+    if (region && is_huge && (ZYCORE_HUGE_PAGE_HEADER_SIZE + size <= region))
+    {
+        // The block still fits into its region
+        ZYCORE_HUGE_PAGE_BLOCK_SIZE(header) = size;
+        return ZYAN_STATUS_SUCCESS;
+    }
+    if (!region && !is_huge)
+    {
+        ZYAN_CHECK(huge->backing->reallocate(huge->backing, &header, 1,
+            ZYCORE_HUGE_PAGE_HEADER_SIZE + size));
+        ZYCORE_HUGE_PAGE_BLOCK_SIZE(header) = size;
+        *p = (ZyanU8*)header + ZYCORE_HUGE_PAGE_HEADER_SIZE;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // The block grows beyond its region or crosses the threshold
+    void* x;
+    ZYAN_CHECK(ZyanHugePageAcquire(huge, size, &x));
+    ZYAN_MEMCPY((ZyanU8*)x + ZYCORE_HUGE_PAGE_HEADER_SIZE, *p, ZYAN_MIN(old_size, size));
+    ZYAN_CHECK(ZyanHugePageRelease(huge, header));
+    *p = (ZyanU8*)x + ZYCORE_HUGE_PAGE_HEADER_SIZE;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanHugePageAllocatorDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    return ZyanHugePageRelease((ZyanHugePageAllocator*)allocator,
+        (ZyanU8*)p - ZYCORE_HUGE_PAGE_HEADER_SIZE);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHugePageInit(ZyanHugePageAllocator* allocator, ZyanUSize threshold)
+{
+    return ZyanHugePageInitEx(allocator, threshold, ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanHugePageInitEx(ZyanHugePageAllocator* allocator, ZyanUSize threshold,
+    ZyanAllocator* backing)
+{
+    if (!allocator || !backing)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInit(&allocator->allocator, &ZyanHugePageAllocatorAllocate,
+        &ZyanHugePageAllocatorReallocate, &ZyanHugePageAllocatorDeallocate));
+
+    allocator->backing   = backing;
+    allocator->page_size = ZyanMemoryGetSystemHugePageSize();
+    allocator->threshold = threshold ? threshold : allocator->page_size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanHugePageGetPageSize(const ZyanHugePageAllocator* allocator, ZyanU32* page_size)
+{
+    if (!allocator || !page_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *page_size = allocator->page_size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYAN_NO_LIBC */
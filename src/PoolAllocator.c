@@ -0,0 +1,238 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/PoolAllocator.h>
+#include <Zycore/LibC.h>
+#ifndef ZYAN_NO_LIBC
+#   include <Zycore/API/Memory.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * The size of the header that precedes the blocks of each slab.
+ */
+#define ZYCORE_POOL_SLAB_HEADER_SIZE \
+    ZYAN_ALIGN_UP(sizeof(ZyanPoolSlab), 2 * sizeof(void*))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Allocates a new slab and makes it the current one.
+ *
+ * @param   pool    A pointer to the `ZyanPoolAllocator` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanPoolAllocateSlab(ZyanPoolAllocator* pool)
+{
+    ZYAN_ASSERT(pool);
+    ZYAN_ASSERT(pool->backing);
+
+    ZyanPoolSlab* slab;
+    ZYAN_CHECK(pool->backing->allocate(pool->backing, (void**)&slab, 1, pool->slab_size));
+    slab->next = pool->slabs;
+    slab->size = pool->slab_size;
+
+    pool->slabs  = slab;
+    pool->cursor = (ZyanU8*)slab + ZYCORE_POOL_SLAB_HEADER_SIZE;
+    pool->end    = (ZyanU8*)slab + pool->slab_size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator interface                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanPoolAllocatorAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanPoolAllocator* const pool = (ZyanPoolAllocator*)allocator;
+
+    if (n > pool->block_size / element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (pool->free_list)
+    {
+        *p = pool->free_list;
+        pool->free_list = *(void**)pool->free_list;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    if ((ZyanUSize)(pool->end - pool->cursor) < pool->block_size)
+    {
+        ZYAN_CHECK(ZyanPoolAllocateSlab(pool));
+    }
+
+    *p = pool->cursor;
+    pool->cursor += pool->block_size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanPoolAllocatorReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(p);
+
+    const ZyanPoolAllocator* const pool = (ZyanPoolAllocator*)allocator;
+
+    // Every block already has the maximum size
+    if (n > pool->block_size / element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanPoolAllocatorDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    ZyanPoolAllocator* const pool = (ZyanPoolAllocator*)allocator;
+
+    *(void**)p = pool->free_list;
+    pool->free_list = p;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZYAN_REQUIRES_LIBC ZyanStatus ZyanPoolInit(ZyanPoolAllocator* pool, ZyanUSize block_size)
+{
+    return ZyanPoolInitEx(pool, block_size, ZyanMemoryGetSystemPageSize(),
+        ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanPoolInitEx(ZyanPoolAllocator* pool, ZyanUSize block_size, ZyanUSize slab_size,
+    ZyanAllocator* allocator)
+{
+    if (!pool || !block_size || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInit(&pool->allocator, &ZyanPoolAllocatorAllocate,
+        &ZyanPoolAllocatorReallocate, &ZyanPoolAllocatorDeallocate));
+
+    block_size = ZYAN_ALIGN_UP(ZYAN_MAX(block_size, sizeof(void*)), ZYAN_POOL_ALIGNMENT);
+    slab_size  = slab_size ? slab_size : ZYAN_POOL_DEFAULT_SLAB_SIZE;
+
+    pool->backing    = allocator;
+    pool->block_size = block_size;
+    pool->slab_size  = ZYAN_MAX(slab_size, ZYCORE_POOL_SLAB_HEADER_SIZE + block_size);
+    pool->slabs      = ZYAN_NULL;
+    pool->cursor     = ZYAN_NULL;
+    pool->end        = ZYAN_NULL;
+    pool->free_list  = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanPoolDestroy(ZyanPoolAllocator* pool)
+{
+    if (!pool)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanPoolSlab* slab = pool->slabs;
+    while (slab)
+    {
+        ZyanPoolSlab* const next = slab->next;
+        ZYAN_CHECK(pool->backing->deallocate(pool->backing, slab, 1, slab->size));
+        slab = next;
+    }
+
+    pool->slabs     = ZYAN_NULL;
+    pool->cursor    = ZYAN_NULL;
+    pool->end       = ZYAN_NULL;
+    pool->free_list = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanPoolGetBlockSize(const ZyanPoolAllocator* pool, ZyanUSize* size)
+{
+    if (!pool || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = pool->block_size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
@@ -0,0 +1,629 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/RingBuffer.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Checks, if the passed ring buffer should shrink.
+ *
+ * @param   size        The desired size of the ring buffer.
+ * @param   capacity    The current capacity of the ring buffer.
+ * @param   threshold   The shrink threshold.
+ *
+ * @return  `ZYAN_TRUE`, if the ring buffer should shrink or `ZYAN_FALSE`, if not.
+ */
+#define ZYCORE_RING_BUFFER_SHOULD_SHRINK(size, capacity, threshold) \
+    (((threshold) != 0) && ((size) * (threshold) < (capacity)))
+
+/**
+ * Returns the address of the element at the given position in the underlying buffer.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   position    The position in the underlying buffer (not relative to the front).
+ *
+ * @return  The address of the element at the given `position`.
+ */
+#define ZYCORE_RING_BUFFER_OFFSET(buffer, position) \
+    ((void*)((ZyanU8*)(buffer)->data + ((position) * (buffer)->element_size)))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Translates an index relative to the front of the ring buffer to a position in the underlying
+ * buffer.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ * @param   index   The element index. May be equal to the capacity.
+ *
+ * @return  The position in the underlying buffer.
+ */
+static ZyanUSize ZyanRingBufferGetPosition(const ZyanRingBuffer* buffer, ZyanUSize index)
+{
+    ZYAN_ASSERT(buffer);
+    ZYAN_ASSERT(buffer->head < buffer->capacity);
+    ZYAN_ASSERT(index <= buffer->capacity);
+
+    const ZyanUSize position = buffer->head + index;
+    return (position >= buffer->capacity) ? position - buffer->capacity : position;
+}
+
+/**
+ * Copies elements into the underlying buffer, wrapping around at its end.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   position    The position in the underlying buffer of the first element to write.
+ * @param   elements    A pointer to the source elements.
+ * @param   count       The number of elements.
+ */
+static void ZyanRingBufferWrite(ZyanRingBuffer* buffer, ZyanUSize position, const void* elements,
+    ZyanUSize count)
+{
+    ZYAN_ASSERT(buffer);
+    ZYAN_ASSERT(count <= buffer->capacity);
+
+    const ZyanUSize first = ZYAN_MIN(count, buffer->capacity - position);
+    ZYAN_MEMCPY(ZYCORE_RING_BUFFER_OFFSET(buffer, position), elements,
+        first * buffer->element_size);
+    ZYAN_MEMCPY(buffer->data, (const ZyanU8*)elements + first * buffer->element_size,
+        (count - first) * buffer->element_size);
+}
+
+/**
+ * Copies elements out of the underlying buffer, wrapping around at its end.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   position    The position in the underlying buffer of the first element to read.
+ * @param   elements    A pointer to the destination buffer.
+ * @param   count       The number of elements.
+ */
+static void ZyanRingBufferRead(const ZyanRingBuffer* buffer, ZyanUSize position, void* elements,
+    ZyanUSize count)
+{
+    ZYAN_ASSERT(buffer);
+    ZYAN_ASSERT(count <= buffer->capacity);
+
+    const ZyanUSize first = ZYAN_MIN(count, buffer->capacity - position);
+    ZYAN_MEMCPY(elements, ZYCORE_RING_BUFFER_OFFSET(buffer, position),
+        first * buffer->element_size);
+    ZYAN_MEMCPY((ZyanU8*)elements + first * buffer->element_size, buffer->data,
+        (count - first) * buffer->element_size);
+}
+
+/**
+ * Invokes the destructor callback for a range of elements.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ * @param   index   The index of the first element, relative to the front of the ring buffer.
+ * @param   count   The number of elements.
+ */
+static void ZyanRingBufferDestroyElements(ZyanRingBuffer* buffer, ZyanUSize index,
+    ZyanUSize count)
+{
+    ZYAN_ASSERT(buffer);
+
+    if (!buffer->destructor)
+    {
+        return;
+    }
+
+    ZyanUSize position = ZyanRingBufferGetPosition(buffer, index);
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        buffer->destructor(ZYCORE_RING_BUFFER_OFFSET(buffer, position));
+        if (++position == buffer->capacity)
+        {
+            position = 0;
+        }
+    }
+}
+
+/**
+ * Reallocates the underlying buffer of the ring buffer.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   capacity    The new capacity.
+ *
+ * @return  A zyan status code.
+ *
+ * The elements are moved to the start of the new buffer.
+ */
+static ZyanStatus ZyanRingBufferReallocate(ZyanRingBuffer* buffer, ZyanUSize capacity)
+{
+    ZYAN_ASSERT(buffer);
+    ZYAN_ASSERT(buffer->element_size);
+    ZYAN_ASSERT(buffer->data);
+
+    if (!buffer->allocator)
+    {
+        if (buffer->capacity < capacity)
+        {
+            return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_ASSERT(buffer->allocator->allocate);
+    ZYAN_ASSERT(buffer->allocator->deallocate);
+
+    capacity = ZYAN_MAX(capacity, ZYAN_MAX(buffer->size, ZYAN_RING_BUFFER_MIN_CAPACITY));
+    if (capacity == buffer->capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    void* data;
+    ZYAN_CHECK(buffer->allocator->allocate(buffer->allocator, &data, buffer->element_size,
+        capacity));
+    ZyanRingBufferRead(buffer, buffer->head, data, buffer->size);
+    ZYAN_CHECK(buffer->allocator->deallocate(buffer->allocator, buffer->data,
+        buffer->element_size, buffer->capacity));
+
+    buffer->data = data;
+    buffer->capacity = capacity;
+    buffer->head = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Makes sure the ring buffer is able to hold `count` additional elements.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ * @param   count   The number of elements to add.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRingBufferGrow(ZyanRingBuffer* buffer, ZyanUSize count)
+{
+    ZYAN_ASSERT(buffer);
+
+    if (count > (ZyanUSize)-1 / buffer->element_size - buffer->size)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    const ZyanUSize size = buffer->size + count;
+    if (size <= buffer->capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_ASSERT(buffer->growth_factor >= 1);
+    const ZyanUSize capacity = (size > ((ZyanUSize)-1 / buffer->element_size) /
+        buffer->growth_factor) ? size : size * buffer->growth_factor;
+
+    return ZyanRingBufferReallocate(buffer, capacity);
+}
+
+/**
+ * Shrinks the ring buffer after elements were removed, if the shrink threshold is reached.
+ *
+ * @param   buffer  A pointer to the `ZyanRingBuffer` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRingBufferShrink(ZyanRingBuffer* buffer)
+{
+    ZYAN_ASSERT(buffer);
+
+    if (!buffer->size)
+    {
+        buffer->head = 0;
+    }
+
+    if (buffer->allocator && ZYCORE_RING_BUFFER_SHOULD_SHRINK(buffer->size, buffer->capacity,
+        buffer->shrink_threshold))
+    {
+        const ZyanUSize capacity = buffer->size * buffer->growth_factor;
+        if (capacity < buffer->capacity)
+        {
+            return ZyanRingBufferReallocate(buffer, capacity);
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanRingBufferInit(ZyanRingBuffer* buffer, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanMemberProcedure destructor)
+{
+    return ZyanRingBufferInitEx(buffer, element_size, capacity, destructor,
+        ZyanAllocatorDefault(), ZYAN_RING_BUFFER_DEFAULT_GROWTH_FACTOR,
+        ZYAN_RING_BUFFER_DEFAULT_SHRINK_THRESHOLD);
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanRingBufferInitEx(ZyanRingBuffer* buffer, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold)
+{
+    if (!buffer || !element_size || !allocator || (growth_factor < 1))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+
+    buffer->allocator        = allocator;
+    buffer->growth_factor    = growth_factor;
+    buffer->shrink_threshold = shrink_threshold;
+    buffer->head             = 0;
+    buffer->size             = 0;
+    buffer->capacity         = ZYAN_MAX(ZYAN_RING_BUFFER_MIN_CAPACITY, capacity);
+    buffer->element_size     = element_size;
+    buffer->destructor       = destructor;
+    buffer->data             = ZYAN_NULL;
+
+    return allocator->allocate(allocator, &buffer->data, buffer->element_size,
+        buffer->capacity);
+}
+
+ZyanStatus ZyanRingBufferInitCustomBuffer(ZyanRingBuffer* buffer, ZyanUSize element_size,
+    void* storage, ZyanUSize capacity, ZyanMemberProcedure destructor)
+{
+    if (!buffer || !element_size || !storage || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    buffer->allocator        = ZYAN_NULL;
+    buffer->growth_factor    = 1;
+    buffer->shrink_threshold = 0;
+    buffer->head             = 0;
+    buffer->size             = 0;
+    buffer->capacity         = capacity;
+    buffer->element_size     = element_size;
+    buffer->destructor       = destructor;
+    buffer->data             = storage;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRingBufferDestroy(ZyanRingBuffer* buffer)
+{
+    if (!buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(buffer->element_size);
+    ZYAN_ASSERT(buffer->data);
+
+    ZyanRingBufferDestroyElements(buffer, 0, buffer->size);
+
+    if (buffer->allocator && buffer->capacity)
+    {
+        ZYAN_ASSERT(buffer->allocator->deallocate);
+        ZYAN_CHECK(buffer->allocator->deallocate(buffer->allocator, buffer->data,
+            buffer->element_size, buffer->capacity));
+    }
+
+    buffer->data = ZYAN_NULL;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Element access                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+const void* ZyanRingBufferGet(const ZyanRingBuffer* buffer, ZyanUSize index)
+{
+    return ZyanRingBufferGetMutable(buffer, index);
+}
+
+void* ZyanRingBufferGetMutable(const ZyanRingBuffer* buffer, ZyanUSize index)
+{
+    if (!buffer || (index >= buffer->size))
+    {
+        return ZYAN_NULL;
+    }
+
+    ZYAN_ASSERT(buffer->element_size);
+    ZYAN_ASSERT(buffer->data);
+
+    return ZYCORE_RING_BUFFER_OFFSET(buffer, ZyanRingBufferGetPosition(buffer, index));
+}
+
+ZyanStatus ZyanRingBufferGetSpans(const ZyanRingBuffer* buffer, const void** first,
+    ZyanUSize* first_count, const void** second, ZyanUSize* second_count)
+{
+    if (!buffer || !first || !first_count || !second || !second_count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize count = ZYAN_MIN(buffer->size, buffer->capacity - buffer->head);
+    *first        = count ? ZYCORE_RING_BUFFER_OFFSET(buffer, buffer->head) : ZYAN_NULL;
+    *first_count  = count;
+    *second       = (count < buffer->size) ? buffer->data : ZYAN_NULL;
+    *second_count = buffer->size - count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRingBufferPushBack(ZyanRingBuffer* buffer, const void* element)
+{
+    if (!buffer || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (buffer->size == buffer->capacity)
+    {
+        ZYAN_CHECK(ZyanRingBufferGrow(buffer, 1));
+    }
+
+    ZYAN_MEMCPY(ZYCORE_RING_BUFFER_OFFSET(buffer,
+        ZyanRingBufferGetPosition(buffer, buffer->size)), element, buffer->element_size);
+    ++buffer->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRingBufferPushBackRange(ZyanRingBuffer* buffer, const void* elements,
+    ZyanUSize count)
+{
+    if (!buffer || !elements || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanRingBufferGrow(buffer, count));
+
+    ZyanRingBufferWrite(buffer, ZyanRingBufferGetPosition(buffer, buffer->size), elements, count);
+    buffer->size += count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRingBufferPushFront(ZyanRingBuffer* buffer, const void* element)
+{
+    if (!buffer || !element)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (buffer->size == buffer->capacity)
+    {
+        ZYAN_CHECK(ZyanRingBufferGrow(buffer, 1));
+    }
+
+    buffer->head = (buffer->head ? buffer->head : buffer->capacity) - 1;
+    ZYAN_MEMCPY(ZYCORE_RING_BUFFER_OFFSET(buffer, buffer->head), element, buffer->element_size);
+    ++buffer->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRingBufferPushFrontRange(ZyanRingBuffer* buffer, const void* elements,
+    ZyanUSize count)
+{
+    if (!buffer || !elements || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanRingBufferGrow(buffer, count));
+
+    const ZyanUSize head = (buffer->head >= count) ?
+        buffer->head - count : buffer->head + buffer->capacity - count;
+    ZyanRingBufferWrite(buffer, head, elements, count);
+    buffer->head = head;
+    buffer->size += count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRingBufferPopFront(ZyanRingBuffer* buffer, void* element)
+{
+    if (!buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!buffer->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    void* const front = ZYCORE_RING_BUFFER_OFFSET(buffer, buffer->head);
+    if (element)
+    {
+        ZYAN_MEMCPY(element, front, buffer->element_size);
+    } else
+    if (buffer->destructor)
+    {
+        buffer->destructor(front);
+    }
+
+    if (++buffer->head == buffer->capacity)
+    {
+        buffer->head = 0;
+    }
+    --buffer->size;
+
+    return ZyanRingBufferShrink(buffer);
+}
+
+ZyanStatus ZyanRingBufferPopFrontRange(ZyanRingBuffer* buffer, void* elements, ZyanUSize count)
+{
+    if (!buffer || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (count > buffer->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (elements)
+    {
+        ZyanRingBufferRead(buffer, buffer->head, elements, count);
+    } else
+    {
+        ZyanRingBufferDestroyElements(buffer, 0, count);
+    }
+
+    buffer->head = ZyanRingBufferGetPosition(buffer, count);
+    buffer->size -= count;
+
+    return ZyanRingBufferShrink(buffer);
+}
+
+ZyanStatus ZyanRingBufferPopBack(ZyanRingBuffer* buffer, void* element)
+{
+    return ZyanRingBufferPopBackRange(buffer, element, 1);
+}
+
+ZyanStatus ZyanRingBufferPopBackRange(ZyanRingBuffer* buffer, void* elements, ZyanUSize count)
+{
+    if (!buffer || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (count > buffer->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const ZyanUSize index = buffer->size - count;
+    if (elements)
+    {
+        ZyanRingBufferRead(buffer, ZyanRingBufferGetPosition(buffer, index), elements, count);
+    } else
+    {
+        ZyanRingBufferDestroyElements(buffer, index, count);
+    }
+
+    buffer->size -= count;
+
+    return ZyanRingBufferShrink(buffer);
+}
+
+ZyanStatus ZyanRingBufferClear(ZyanRingBuffer* buffer)
+{
+    if (!buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanRingBufferDestroyElements(buffer, 0, buffer->size);
+    buffer->size = 0;
+
+    return ZyanRingBufferShrink(buffer);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRingBufferReserve(ZyanRingBuffer* buffer, ZyanUSize capacity)
+{
+    if (!buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (capacity > buffer->capacity)
+    {
+        ZYAN_CHECK(ZyanRingBufferReallocate(buffer, capacity));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRingBufferShrinkToFit(ZyanRingBuffer* buffer)
+{
+    if (!buffer)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanRingBufferReallocate(buffer, buffer->size);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRingBufferGetCapacity(const ZyanRingBuffer* buffer, ZyanUSize* capacity)
+{
+    if (!buffer || !capacity)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *capacity = buffer->capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRingBufferGetSize(const ZyanRingBuffer* buffer, ZyanUSize* size)
+{
+    if (!buffer || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = buffer->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
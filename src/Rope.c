@@ -0,0 +1,812 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/Rope.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns the weight of the given node or `0`, if the node is `ZYAN_NULL`.
+ */
+#define ZYCORE_ROPE_WEIGHT(node) \
+    ((node) ? (node)->weight : 0)
+
+/**
+ * The maximum number of unused nodes that are kept for later reuse.
+ */
+#define ZYCORE_ROPE_MAX_SPARE_COUNT \
+    16
+
+/**
+ * The initial state of the random number generator.
+ */
+#define ZYCORE_ROPE_DEFAULT_SEED \
+    0x9E3779B9
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Node management                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns a new pseudo-random node priority.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ *
+ * @return  The node priority.
+ */
+static ZyanU32 ZyanRopeNextPriority(ZyanRope* rope)
+{
+    ZYAN_ASSERT(rope);
+
+    // xorshift32
+    ZyanU32 x = rope->seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    rope->seed = x;
+
+    return x;
+}
+
+/**
+ * Makes sure that at least `count` unused nodes are available.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   count   The number of required nodes.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRopeReserveNodes(ZyanRope* rope, ZyanUSize count)
+{
+    ZYAN_ASSERT(rope);
+    ZYAN_ASSERT(rope->allocator);
+
+    while (rope->spare_count < count)
+    {
+        ZyanRopeNode* node;
+        ZYAN_CHECK(rope->allocator->allocate(rope->allocator, (void**)&node,
+            sizeof(ZyanRopeNode), 1));
+        node->right = rope->spare;
+        rope->spare = node;
+        ++rope->spare_count;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Frees unused nodes until at most `count` unused nodes are left.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   count   The maximum number of unused nodes to keep.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanRopeTrimNodes(ZyanRope* rope, ZyanUSize count)
+{
+    ZYAN_ASSERT(rope);
+    ZYAN_ASSERT(rope->allocator);
+
+    while (rope->spare_count > count)
+    {
+        ZyanRopeNode* const node = rope->spare;
+        rope->spare = node->right;
+        --rope->spare_count;
+        ZYAN_CHECK(rope->allocator->deallocate(rope->allocator, node, sizeof(ZyanRopeNode), 1));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Takes an empty node from the list of unused nodes.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ *
+ * @return  A pointer to the node.
+ *
+ * The caller has to reserve the node with `ZyanRopeReserveNodes` beforehand.
+ */
+static ZyanRopeNode* ZyanRopeAcquireNode(ZyanRope* rope)
+{
+    ZYAN_ASSERT(rope);
+    ZYAN_ASSERT(rope->spare_count);
+
+    ZyanRopeNode* const node = rope->spare;
+    rope->spare = node->right;
+    --rope->spare_count;
+
+    node->left     = ZYAN_NULL;
+    node->right    = ZYAN_NULL;
+    node->weight   = 0;
+    node->length   = 0;
+    node->priority = ZyanRopeNextPriority(rope);
+
+    return node;
+}
+
+/**
+ * Moves all nodes of the given subtree to the list of unused nodes.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   node    The root node of the subtree.
+ */
+static void ZyanRopeReleaseTree(ZyanRope* rope, ZyanRopeNode* node)
+{
+    ZYAN_ASSERT(rope);
+
+    while (node)
+    {
+        ZyanRopeReleaseTree(rope, node->left);
+        ZyanRopeNode* const next = node->right;
+        node->right = rope->spare;
+        rope->spare = node;
+        ++rope->spare_count;
+        node = next;
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Tree operations                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Recalculates the weight of the given node from its children.
+ *
+ * @param   node    A pointer to the `ZyanRopeNode` struct.
+ */
+static void ZyanRopeUpdateWeight(ZyanRopeNode* node)
+{
+    ZYAN_ASSERT(node);
+
+    node->weight = ZYCORE_ROPE_WEIGHT(node->left) + node->length + ZYCORE_ROPE_WEIGHT(node->right);
+}
+
+/**
+ * Locates the node that contains the character at the given `index`.
+ *
+ * @param   node        The root node of the tree.
+ * @param   index       The character index. Receives the offset of the character inside the
+ *                      returned node.
+ * @param   inclusive   Also accept a node, if the `index` points directly behind its last
+ *                      character.
+ *
+ * @return  A pointer to the node or `ZYAN_NULL`, if there is no such node.
+ */
+static ZyanRopeNode* ZyanRopeLocate(ZyanRopeNode* node, ZyanUSize* index, ZyanBool inclusive)
+{
+    ZYAN_ASSERT(index);
+
+    ZyanUSize i = *index;
+    while (node)
+    {
+        const ZyanUSize left = ZYCORE_ROPE_WEIGHT(node->left);
+        if (i < left)
+        {
+            node = node->left;
+            continue;
+        }
+        i -= left;
+        if ((i < node->length) || (inclusive && (i == node->length)))
+        {
+            *index = i;
+            return node;
+        }
+        i -= node->length;
+        node = node->right;
+    }
+
+    return ZYAN_NULL;
+}
+
+/**
+ * Changes the weights of all nodes on the path to the node returned by `ZyanRopeLocate`.
+ *
+ * @param   node        The root node of the tree.
+ * @param   index       The character index.
+ * @param   inclusive   The `inclusive` value that was passed to `ZyanRopeLocate`.
+ * @param   added       The number of characters added to the located node.
+ * @param   removed     The number of characters removed from the located node.
+ *
+ * This function has to be called before the length of the located node is changed.
+ */
+static void ZyanRopeAdjustWeights(ZyanRopeNode* node, ZyanUSize index, ZyanBool inclusive,
+    ZyanUSize added, ZyanUSize removed)
+{
+    while (node)
+    {
+        // Read the weight of the left child before it gets modified
+        const ZyanUSize left = ZYCORE_ROPE_WEIGHT(node->left);
+        node->weight = node->weight + added - removed;
+        if (index < left)
+        {
+            node = node->left;
+            continue;
+        }
+        index -= left;
+        if ((index < node->length) || (inclusive && (index == node->length)))
+        {
+            return;
+        }
+        index -= node->length;
+        node = node->right;
+    }
+}
+
+/**
+ * Concatenates two trees.
+ *
+ * @param   left    The root node of the first tree.
+ * @param   right   The root node of the second tree.
+ *
+ * @return  The root node of the resulting tree.
+ */
+static ZyanRopeNode* ZyanRopeMerge(ZyanRopeNode* left, ZyanRopeNode* right)
+{
+    if (!left)
+    {
+        return right;
+    }
+    if (!right)
+    {
+        return left;
+    }
+
+    if (left->priority >= right->priority)
+    {
+        left->right = ZyanRopeMerge(left->right, right);
+        ZyanRopeUpdateWeight(left);
+        return left;
+    }
+
+    right->left = ZyanRopeMerge(left, right->left);
+    ZyanRopeUpdateWeight(right);
+    return right;
+}
+
+/**
+ * Splits a tree into two trees at the given `index`.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   node    The root node of the tree.
+ * @param   index   The split index.
+ * @param   left    Receives the root node of the tree that contains the first `index` characters.
+ * @param   right   Receives the root node of the tree that contains the remaining characters.
+ *
+ * If the `index` points into the middle of a node, the node is split in two. The caller has to
+ * reserve one unused node for this case.
+ */
+static void ZyanRopeSplit(ZyanRope* rope, ZyanRopeNode* node, ZyanUSize index,
+    ZyanRopeNode** left, ZyanRopeNode** right)
+{
+    ZYAN_ASSERT(left);
+    ZYAN_ASSERT(right);
+
+    if (!node)
+    {
+        *left  = ZYAN_NULL;
+        *right = ZYAN_NULL;
+        return;
+    }
+
+    const ZyanUSize weight = ZYCORE_ROPE_WEIGHT(node->left);
+    if (index <= weight)
+    {
+        ZyanRopeSplit(rope, node->left, index, left, &node->left);
+        ZyanRopeUpdateWeight(node);
+        *right = node;
+        return;
+    }
+    if (index >= weight + node->length)
+    {
+        ZyanRopeSplit(rope, node->right, index - weight - node->length, &node->right, right);
+        ZyanRopeUpdateWeight(node);
+        *left = node;
+        return;
+    }
+
+    const ZyanUSize offset = index - weight;
+    ZyanRopeNode* const tail = ZyanRopeAcquireNode(rope);
+    tail->length = node->length - offset;
+    ZYAN_MEMCPY(tail->data, node->data + offset, tail->length);
+    ZyanRopeUpdateWeight(tail);
+    *right = ZyanRopeMerge(tail, node->right);
+
+    node->length = offset;
+    node->right = ZYAN_NULL;
+    ZyanRopeUpdateWeight(node);
+    *left = node;
+}
+
+/**
+ * Concatenates two trees and combines the adjacent nodes at the seam, if they fit into a single
+ * node.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ * @param   left    The root node of the first tree.
+ * @param   right   The root node of the second tree.
+ *
+ * @return  The root node of the resulting tree.
+ *
+ * Repeated edits at arbitrary positions would otherwise leave behind more and more partially
+ * filled nodes.
+ */
+static ZyanRopeNode* ZyanRopeJoin(ZyanRope* rope, ZyanRopeNode* left, ZyanRopeNode* right)
+{
+    ZYAN_ASSERT(rope);
+
+    if (!left || !right)
+    {
+        return ZyanRopeMerge(left, right);
+    }
+
+    ZyanRopeNode* last = left;
+    while (last->right)
+    {
+        last = last->right;
+    }
+    ZyanRopeNode* first = right;
+    while (first->left)
+    {
+        first = first->left;
+    }
+    if (last->length + first->length > ZYAN_ROPE_CHUNK_SIZE)
+    {
+        return ZyanRopeMerge(left, right);
+    }
+
+    const ZyanUSize length = first->length;
+    ZYAN_MEMCPY(last->data + last->length, first->data, length);
+    last->length += length;
+    for (ZyanRopeNode* node = left; node; node = node->right)
+    {
+        node->weight += length;
+    }
+
+    ZyanRopeNode** link = &right;
+    while ((*link)->left)
+    {
+        (*link)->weight -= length;
+        link = &(*link)->left;
+    }
+    *link = first->right;
+
+    first->right = rope->spare;
+    rope->spare = first;
+    ++rope->spare_count;
+
+    return ZyanRopeMerge(left, right);
+}
+
+/**
+ * Returns the number of nodes in the given subtree.
+ *
+ * @param   node    The root node of the subtree.
+ *
+ * @return  The number of nodes.
+ */
+static ZyanUSize ZyanRopeCountNodes(const ZyanRopeNode* node)
+{
+    ZyanUSize count = 0;
+    while (node)
+    {
+        count += 1 + ZyanRopeCountNodes(node->left);
+        node = node->right;
+    }
+
+    return count;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Cursor                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Locates the chunk at the current cursor position, if the cursor reached the end of the
+ * previous chunk.
+ *
+ * @param   cursor  A pointer to the `ZyanRopeCursor` instance.
+ *
+ * @return  `ZYAN_TRUE`, if there are characters left at the current cursor position or
+ *          `ZYAN_FALSE`, if the cursor is at the end of the rope.
+ */
+static ZyanBool ZyanRopeCursorFetch(ZyanRopeCursor* cursor)
+{
+    ZYAN_ASSERT(cursor);
+    ZYAN_ASSERT(cursor->rope);
+
+    if (cursor->remaining)
+    {
+        return ZYAN_TRUE;
+    }
+
+    ZyanUSize offset = cursor->position;
+    const ZyanRopeNode* const node = ZyanRopeLocate(cursor->rope->root, &offset, ZYAN_FALSE);
+    if (!node)
+    {
+        return ZYAN_FALSE;
+    }
+    cursor->data = node->data + offset;
+    cursor->remaining = node->length - offset;
+
+    return ZYAN_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanRopeInit(ZyanRope* rope)
+{
+    return ZyanRopeInitEx(rope, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanRopeInitEx(ZyanRope* rope, ZyanAllocator* allocator)
+{
+    if (!rope || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    rope->allocator   = allocator;
+    rope->root        = ZYAN_NULL;
+    rope->seed        = ZYCORE_ROPE_DEFAULT_SEED;
+    rope->spare       = ZYAN_NULL;
+    rope->spare_count = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRopeDestroy(ZyanRope* rope)
+{
+    if (!rope)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanRopeReleaseTree(rope, rope->root);
+    rope->root = ZYAN_NULL;
+
+    return ZyanRopeTrimNodes(rope, 0);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Insertion                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRopeInsert(ZyanRope* rope, ZyanUSize index, const ZyanStringView* source)
+{
+    if (!rope || !source || !source->string.vector.size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index > ZYCORE_ROPE_WEIGHT(rope->root))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const char* data = ZYAN_STRING_DATA(&source->string);
+    ZyanUSize length = source->string.vector.size - 1;
+    if (!length)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Insert in place, if the text fits into the node at the insert position
+    ZyanUSize offset = index;
+    ZyanRopeNode* node = ZyanRopeLocate(rope->root, &offset, ZYAN_TRUE);
+    if (node && (node->length + length <= ZYAN_ROPE_CHUNK_SIZE))
+    {
+        ZyanRopeAdjustWeights(rope->root, index, ZYAN_TRUE, length, 0);
+        ZYAN_MEMMOVE(node->data + offset + length, node->data + offset, node->length - offset);
+        ZYAN_MEMCPY(node->data + offset, data, length);
+        node->length += length;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Reserve one node per chunk of text and one additional node for the split
+    const ZyanUSize count = (length + ZYAN_ROPE_CHUNK_SIZE - 1) / ZYAN_ROPE_CHUNK_SIZE;
+    const ZyanStatus status = ZyanRopeReserveNodes(rope, count + 1);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZYAN_CHECK(ZyanRopeTrimNodes(rope, ZYCORE_ROPE_MAX_SPARE_COUNT));
+        return status;
+    }
+
+    ZyanRopeNode* middle = ZYAN_NULL;
+    while (length)
+    {
+        node = ZyanRopeAcquireNode(rope);
+        node->length = ZYAN_MIN(length, ZYAN_ROPE_CHUNK_SIZE);
+        ZYAN_MEMCPY(node->data, data, node->length);
+        ZyanRopeUpdateWeight(node);
+        middle = ZyanRopeMerge(middle, node);
+        data += node->length;
+        length -= node->length;
+    }
+
+    ZyanRopeNode* left;
+    ZyanRopeNode* right;
+    ZyanRopeSplit(rope, rope->root, index, &left, &right);
+    rope->root = ZyanRopeJoin(rope, ZyanRopeJoin(rope, left, middle), right);
+
+    return ZyanRopeTrimNodes(rope, ZYCORE_ROPE_MAX_SPARE_COUNT);
+}
+
+ZyanStatus ZyanRopeAppend(ZyanRope* rope, const ZyanStringView* source)
+{
+    if (!rope)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanRopeInsert(rope, ZYCORE_ROPE_WEIGHT(rope->root), source);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRopeDelete(ZyanRope* rope, ZyanUSize index, ZyanUSize count)
+{
+    if (!rope)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize size = ZYCORE_ROPE_WEIGHT(rope->root);
+    if ((index > size) || (count > size - index))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+    if (!count)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Delete in place, if the range is located inside a single node that does not become empty
+    ZyanUSize offset = index;
+    ZyanRopeNode* const node = ZyanRopeLocate(rope->root, &offset, ZYAN_FALSE);
+    ZYAN_ASSERT(node);
+    if ((offset + count <= node->length) && (count < node->length))
+    {
+        ZyanRopeAdjustWeights(rope->root, index, ZYAN_FALSE, 0, count);
+        ZYAN_MEMMOVE(node->data + offset, node->data + offset + count,
+            node->length - offset - count);
+        node->length -= count;
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    // Both ends of the range might split a node
+    ZYAN_CHECK(ZyanRopeReserveNodes(rope, 2));
+
+    ZyanRopeNode* left;
+    ZyanRopeNode* middle;
+    ZyanRopeNode* right;
+    ZyanRopeSplit(rope, rope->root, index, &left, &middle);
+    ZyanRopeSplit(rope, middle, count, &middle, &right);
+    ZyanRopeReleaseTree(rope, middle);
+    rope->root = ZyanRopeJoin(rope, left, right);
+
+    return ZyanRopeTrimNodes(rope, ZYCORE_ROPE_MAX_SPARE_COUNT);
+}
+
+ZyanStatus ZyanRopeClear(ZyanRope* rope)
+{
+    if (!rope)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanRopeReleaseTree(rope, rope->root);
+    rope->root = ZYAN_NULL;
+
+    return ZyanRopeTrimNodes(rope, ZYCORE_ROPE_MAX_SPARE_COUNT);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Access                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRopeGetChar(const ZyanRope* rope, ZyanUSize index, char* value)
+{
+    if (!rope || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanRopeNode* const node = ZyanRopeLocate(rope->root, &index, ZYAN_FALSE);
+    if (!node)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    *value = node->data[index];
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRopeCopy(const ZyanRope* rope, ZyanUSize index, ZyanUSize count,
+    ZyanString* destination)
+{
+    if (!rope || !destination || !destination->vector.size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanUSize size = ZYCORE_ROPE_WEIGHT(rope->root);
+    if ((index > size) || (count > size - index))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+    if (!count)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    const ZyanUSize length = destination->vector.size - 1;
+    ZYAN_CHECK(ZyanStringResize(destination, length + count));
+    char* buffer = ZYAN_STRING_DATA(destination) + length;
+
+    while (count)
+    {
+        ZyanUSize offset = index;
+        const ZyanRopeNode* const node = ZyanRopeLocate(rope->root, &offset, ZYAN_FALSE);
+        ZYAN_ASSERT(node);
+
+        const ZyanUSize n = ZYAN_MIN(node->length - offset, count);
+        ZYAN_MEMCPY(buffer, node->data + offset, n);
+        buffer += n;
+        index += n;
+        count -= n;
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Cursor                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRopeCursorInit(ZyanRopeCursor* cursor, const ZyanRope* rope, ZyanUSize index)
+{
+    if (!cursor || !rope)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index > ZYCORE_ROPE_WEIGHT(rope->root))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    cursor->rope      = rope;
+    cursor->position  = index;
+    cursor->data      = ZYAN_NULL;
+    cursor->remaining = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRopeCursorNext(ZyanRopeCursor* cursor, char* value)
+{
+    if (!cursor || !value)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!ZyanRopeCursorFetch(cursor))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    *value = *cursor->data++;
+    --cursor->remaining;
+    ++cursor->position;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanRopeCursorNextChunk(ZyanRopeCursor* cursor, const char** data, ZyanUSize* size)
+{
+    if (!cursor || !data || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!ZyanRopeCursorFetch(cursor))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    *data = cursor->data;
+    *size = cursor->remaining;
+    cursor->position += cursor->remaining;
+    cursor->data += cursor->remaining;
+    cursor->remaining = 0;
+
+    return ZYAN_STATUS_TRUE;
+}
+
+ZyanStatus ZyanRopeCursorGetPosition(const ZyanRopeCursor* cursor, ZyanUSize* position)
+{
+    if (!cursor || !position)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *position = cursor->position;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanRopeGetSize(const ZyanRope* rope, ZyanUSize* size)
+{
+    if (!rope || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *size = ZYCORE_ROPE_WEIGHT(rope->root);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanRopeGetNodeCount(const ZyanRope* rope, ZyanUSize* count)
+{
+    if (!rope || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *count = ZyanRopeCountNodes(rope->root);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
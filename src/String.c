@@ -27,21 +27,1166 @@
 #include <Zycore/String.h>
 #include <Zycore/LibC.h>
 
+// The SIMD code paths are disabled in `ZYAN_NO_LIBC` builds for the same reasons as in `Vector.c`
+#if !defined(ZYAN_NO_LIBC) && (defined(ZYAN_X86) || defined(ZYAN_X64)) && \
+    (defined(ZYAN_GNUC) || defined(ZYAN_MSVC))
+#   define ZYCORE_STRING_HAS_SIMD
+#   include <immintrin.h>
+#   include <Zycore/API/Processor.h>
+#endif
+
 /* ============================================================================================== */
 /* Internal macros                                                                                */
 /* ============================================================================================== */
 
 /**
- * Writes a terminating '\0' character at the end of the string data.
+ * Writes a terminating '\0' character at the end of the string data.
+ */
+#define ZYCORE_STRING_NULLTERMINATE(string) \
+      *(ZYAN_STRING_DATA(string) + (string)->vector.size - 1) = '\0';
+
+/**
+ * Checks for a terminating '\0' character at the end of the string data.
+ */
+#define ZYCORE_STRING_ASSERT_NULLTERMINATION(string) \
+      ZYAN_ASSERT(*(ZYAN_STRING_DATA(string) + (string)->vector.size - 1) == '\0');
+
+/**
+ * The value returned by the internal search functions, if the needle was not found.
+ */
+#define ZYCORE_STRING_SEARCH_NOT_FOUND \
+    ((ZyanUSize)-1)
+
+/**
+ * The maximum length of needles that are searched for using the first/last character filter.
+ *
+ * The filter degrades to `O(n * m)` for adversarial inputs. Longer needles are searched for
+ * using the Two-Way algorithm, which guarantees linear time.
+ */
+#define ZYCORE_STRING_SEARCH_FILTER_MAX_NEEDLE \
+    64
+
+/**
+ * Returns the (masked) character at position `i` of the given `ZyanStringSearchSequence`.
+ */
+#define ZYCORE_STRING_SEARCH_AT(sequence, i) \
+    ((ZyanU8)((sequence)->data[(ZyanISize)(i) * (sequence)->stride] | (sequence)->mask))
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanStringSearchFunction` function prototype.
+ *
+ * @param   haystack        A pointer to the characters to search in.
+ * @param   haystack_size   The number of characters to search in.
+ * @param   needle          A pointer to the characters to search for.
+ * @param   needle_size     The number of characters to search for (at least `1` and not more
+ *                          than `haystack_size`).
+ * @param   mask            `0x20` for case-insensitive searches or `0x00`, if not.
+ *
+ * @return  The index of the first (or last) occurrence of `needle` or
+ *          `ZYCORE_STRING_SEARCH_NOT_FOUND`, if the needle was not found.
+ *
+ * Two characters are considered equal in case-insensitive mode, if they are equal after setting
+ * bit `0x20` in both of them, which matches the behavior of `ZyanStringCompareI`.
+ */
+typedef ZyanUSize (*ZyanStringSearchFunction)(const ZyanU8* haystack, ZyanUSize haystack_size,
+    const ZyanU8* needle, ZyanUSize needle_size, ZyanU8 mask);
+
+/**
+ * Defines the `ZyanStringFlipCaseFunction` function prototype.
+ *
+ * @param   data    A pointer to the characters to convert.
+ * @param   size    The number of characters to convert.
+ * @param   first   The first character of the range of letters to convert (`'A'` to convert to
+ *                  lower case or `'a'` to convert to upper case).
+ *
+ * Toggles bit `0x20` of all characters in the range `first` to `first + 25`, which converts them
+ * to the other case.
+ */
+typedef void (*ZyanStringFlipCaseFunction)(ZyanU8* data, ZyanUSize size, ZyanU8 first);
+
+/**
+ * Defines the `ZyanStringMismatchIFunction` function prototype.
+ *
+ * @param   a       A pointer to the first sequence.
+ * @param   b       A pointer to the second sequence.
+ * @param   size    The number of characters to compare.
+ *
+ * @return  The index of the first pair of characters that differ in any other bit than `0x20` or
+ *          `size`, if there is no such pair.
+ */
+typedef ZyanUSize (*ZyanStringMismatchIFunction)(const ZyanU8* a, const ZyanU8* b,
+    ZyanUSize size);
+
+/**
+ * Defines the `ZyanStringSearchSequence` struct.
+ *
+ * Describes a sequence of characters that is accessed in forward or in reverse order.
+ */
+typedef struct ZyanStringSearchSequence_
+{
+    /**
+     * A pointer to the first character of the sequence.
+     */
+    const ZyanU8* data;
+    /**
+     * `1` for forward sequences or `-1` for reverse sequences.
+     */
+    ZyanISize stride;
+    /**
+     * The mask that is applied to all characters.
+     */
+    ZyanU8 mask;
+} ZyanStringSearchSequence;
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Inline strings                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the vector that is used to modify the given string.
+ *
+ * @param   string  A pointer to the `ZyanString` instance.
+ * @param   temp    A pointer to a `ZyanVector` instance that is used as temporary vector for
+ *                  inline strings.
+ *
+ * @return  A pointer to the vector of the string or `temp`, if the string is inline.
+ *
+ * The temporary vector uses the inline storage of the string as its small buffer, which allows the
+ * `ZyanVector` functions to operate on inline strings and to move them to a dynamically allocated
+ * buffer as soon as the inline storage overflows.
+ *
+ * Every call to this function must be followed by a call to `ZyanStringEndUpdate`.
+ */
+static ZyanVector* ZyanStringBeginUpdate(ZyanString* string, ZyanVector* temp)
+{
+    ZYAN_ASSERT(string);
+    ZYAN_ASSERT(temp);
+
+    if (!(string->flags & ZYAN_STRING_IS_INLINE))
+    {
+        return &string->vector;
+    }
+
+    temp->allocator        = string->vector.allocator;
+    temp->growth_policy    = string->vector.growth_policy;
+    temp->growth_factor    = string->vector.growth_factor;
+    temp->shrink_threshold = string->vector.shrink_threshold;
+    temp->in_small_buffer  = ZYAN_TRUE;
+    temp->size             = string->vector.size;
+    temp->capacity         = ZYAN_STRING_INLINE_SIZE(string);
+    temp->element_size     = sizeof(char);
+    temp->alignment        = 0;
+    temp->max_capacity     = 0;
+    temp->destructor       = ZYAN_NULL;
+    temp->data             = ZYAN_STRING_INLINE_DATA(string);
+
+    return temp;
+}
+
+/**
+ * Writes the changes of the vector returned by `ZyanStringBeginUpdate` back to the given string.
+ *
+ * @param   string  A pointer to the `ZyanString` instance.
+ * @param   vector  The pointer returned by `ZyanStringBeginUpdate`.
+ */
+static void ZyanStringEndUpdate(ZyanString* string, const ZyanVector* vector)
+{
+    ZYAN_ASSERT(string);
+    ZYAN_ASSERT(vector);
+
+    if (vector == &string->vector)
+    {
+        return;
+    }
+
+    ZYAN_ASSERT(string->flags & ZYAN_STRING_IS_INLINE);
+
+    if (vector->in_small_buffer)
+    {
+        // All fields starting at `capacity` overlap with the inline storage
+        string->vector.growth_policy = vector->growth_policy;
+        string->vector.size          = vector->size;
+        return;
+    }
+
+    string->flags &= ~ZYAN_STRING_IS_INLINE;
+    string->vector = *vector;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the number of trailing zero bits of the given non-zero `value`.
+ *
+ * @param   value   The value.
+ *
+ * @return  The number of trailing zero bits.
+ */
+static ZyanUSize ZyanStringCountTrailingZeros(ZyanU32 value)
+{
+    ZYAN_ASSERT(value);
+
+#if defined(ZYAN_GNUC)
+    return (ZyanUSize)__builtin_ctz(value);
+#else
+    ZyanUSize count = 0;
+    while (!(value & 1))
+    {
+        value >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * Returns the index of the most significant set bit of the given non-zero `value`.
+ *
+ * @param   value   The value.
+ *
+ * @return  The index of the most significant set bit.
+ */
+static ZyanUSize ZyanStringMostSignificantBit(ZyanU32 value)
+{
+    ZYAN_ASSERT(value);
+
+#if defined(ZYAN_GNUC)
+    return 31 - (ZyanUSize)__builtin_clz(value);
+#else
+    ZyanUSize index = 0;
+    while (value >>= 1)
+    {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/**
+ * Compares two character sequences.
+ *
+ * @param   a       A pointer to the first sequence.
+ * @param   b       A pointer to the second sequence.
+ * @param   size    The number of characters to compare.
+ * @param   mask    The mask that is applied to all characters.
+ *
+ * @return  `ZYAN_TRUE`, if both sequences are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanStringSearchEquals(const ZyanU8* a, const ZyanU8* b, ZyanUSize size,
+    ZyanU8 mask)
+{
+    if (!mask)
+    {
+        return !ZYAN_MEMCMP(a, b, size);
+    }
+
+    for (ZyanUSize i = 0; i < size; ++i)
+    {
+        if ((a[i] | mask) != (b[i] | mask))
+        {
+            return ZYAN_FALSE;
+        }
+    }
+    return ZYAN_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Two-Way algorithm                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Searches for the first occurrence of `needle` in `haystack` using the Two-Way algorithm by
+ * Crochemore and Perrin.
+ *
+ * @param   haystack        A pointer to the `ZyanStringSearchSequence` to search in.
+ * @param   haystack_size   The number of characters to search in.
+ * @param   needle          A pointer to the `ZyanStringSearchSequence` to search for.
+ * @param   needle_size     The number of characters to search for.
+ *
+ * @return  The index of the first occurrence of `needle` or `ZYCORE_STRING_SEARCH_NOT_FOUND`, if
+ *          the needle was not found.
+ *
+ * A bad character shift on the last character of the window skips most of the haystack for
+ * typical inputs, while the critical factorization guarantees `O(n + m)` time in the worst case.
+ */
+static ZyanUSize ZyanStringSearchTwoWay(const ZyanStringSearchSequence* haystack,
+    ZyanUSize haystack_size, const ZyanStringSearchSequence* needle, ZyanUSize needle_size)
+{
+    ZYAN_ASSERT(needle_size && (needle_size <= haystack_size));
+
+    const ZyanISize n = (ZyanISize)haystack_size;
+    const ZyanISize m = (ZyanISize)needle_size;
+
+    // Compute the maximal suffix for the regular character order
+    ZyanISize i = -1;
+    ZyanISize j = 0;
+    ZyanISize k = 1;
+    ZyanISize p = 1;
+    while (j + k < m)
+    {
+        const ZyanU8 a = ZYCORE_STRING_SEARCH_AT(needle, i + k);
+        const ZyanU8 b = ZYCORE_STRING_SEARCH_AT(needle, j + k);
+        if (a == b)
+        {
+            if (k == p)
+            {
+                j += p;
+                k = 1;
+            } else
+            {
+                ++k;
+            }
+        } else
+        {
+            if (a > b)
+            {
+                j += k;
+                k = 1;
+                p = j - i;
+            } else
+            {
+                i = j++;
+                k = p = 1;
+            }
+        }
+    }
+    ZyanISize suffix = i;
+    ZyanISize period = p;
+
+    // Compute the maximal suffix for the reversed character order
+    i = -1;
+    j = 0;
+    k = 1;
+    p = 1;
+    while (j + k < m)
+    {
+        const ZyanU8 a = ZYCORE_STRING_SEARCH_AT(needle, i + k);
+        const ZyanU8 b = ZYCORE_STRING_SEARCH_AT(needle, j + k);
+        if (a == b)
+        {
+            if (k == p)
+            {
+                j += p;
+                k = 1;
+            } else
+            {
+                ++k;
+            }
+        } else
+        {
+            if (a < b)
+            {
+                j += k;
+                k = 1;
+                p = j - i;
+            } else
+            {
+                i = j++;
+                k = p = 1;
+            }
+        }
+    }
+    // The critical factorization is given by the longer of both suffixes
+    if (i > suffix)
+    {
+        suffix = i;
+        period = p;
+    }
+
+    // Check, if the needle is periodic
+    ZyanISize memory_reset = 0;
+    for (k = 0; k <= suffix; ++k)
+    {
+        if (ZYCORE_STRING_SEARCH_AT(needle, k) != ZYCORE_STRING_SEARCH_AT(needle, k + period))
+        {
+            break;
+        }
+    }
+    if (k <= suffix)
+    {
+        period = ZYAN_MAX(suffix + 1, m - suffix - 1) + 1;
+    } else
+    {
+        memory_reset = m - period;
+    }
+
+    // Bad character shifts for the last character of the window
+    ZyanUSize shift[256];
+    for (k = 0; k < 256; ++k)
+    {
+        shift[k] = (ZyanUSize)m;
+    }
+    for (k = 0; k < m; ++k)
+    {
+        shift[ZYCORE_STRING_SEARCH_AT(needle, k)] = (ZyanUSize)(m - 1 - k);
+    }
+
+    ZyanISize position = 0;
+    ZyanISize memory = 0;
+    while (position <= n - m)
+    {
+        k = (ZyanISize)shift[ZYCORE_STRING_SEARCH_AT(haystack, position + m - 1)];
+        if (k)
+        {
+            position += ZYAN_MAX(k, memory);
+            memory = 0;
+            continue;
+        }
+
+        // Compare the right half
+        for (k = ZYAN_MAX(suffix + 1, memory); (k < m) &&
+            (ZYCORE_STRING_SEARCH_AT(needle, k) == ZYCORE_STRING_SEARCH_AT(haystack, position + k));
+            ++k);
+        if (k < m)
+        {
+            position += k - suffix;
+            memory = 0;
+            continue;
+        }
+
+        // Compare the left half
+        for (k = suffix + 1; (k > memory) && (ZYCORE_STRING_SEARCH_AT(needle, k - 1) ==
+            ZYCORE_STRING_SEARCH_AT(haystack, position + k - 1)); --k);
+        if (k <= memory)
+        {
+            return (ZyanUSize)position;
+        }
+        position += period;
+        memory = memory_reset;
+    }
+
+    return ZYCORE_STRING_SEARCH_NOT_FOUND;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* First/last character filter                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanUSize ZyanStringSearchForward(const ZyanU8* haystack, ZyanUSize haystack_size,
+    const ZyanU8* needle, ZyanUSize needle_size, ZyanU8 mask)
+{
+    const ZyanU8 first = needle[0] | mask;
+    const ZyanU8 last = needle[needle_size - 1] | mask;
+    const ZyanUSize inner = (needle_size > 1) ? needle_size - 2 : 0;
+
+    for (ZyanUSize i = 0; i + needle_size <= haystack_size; ++i)
+    {
+        if (((haystack[i] | mask) == first) &&
+            ((haystack[i + needle_size - 1] | mask) == last) &&
+            ZyanStringSearchEquals(haystack + i + 1, needle + 1, inner, mask))
+        {
+            return i;
+        }
+    }
+
+    return ZYCORE_STRING_SEARCH_NOT_FOUND;
+}
+
+static ZyanUSize ZyanStringSearchReverse(const ZyanU8* haystack, ZyanUSize haystack_size,
+    const ZyanU8* needle, ZyanUSize needle_size, ZyanU8 mask)
+{
+    const ZyanU8 first = needle[0] | mask;
+    const ZyanU8 last = needle[needle_size - 1] | mask;
+    const ZyanUSize inner = (needle_size > 1) ? needle_size - 2 : 0;
+
+    for (ZyanUSize i = haystack_size - needle_size + 1; i-- > 0;)
+    {
+        if (((haystack[i + needle_size - 1] | mask) == last) &&
+            ((haystack[i] | mask) == first) &&
+            ZyanStringSearchEquals(haystack + i + 1, needle + 1, inner, mask))
+        {
+            return i;
+        }
+    }
+
+    return ZYCORE_STRING_SEARCH_NOT_FOUND;
+}
+
+#ifdef ZYCORE_STRING_HAS_SIMD
+
+/**
+ * Verifies the candidates of a block in ascending order.
+ *
+ * @param   haystack    A pointer to the first character of the block.
+ * @param   bits        A mask that has bit `n` set, if the first and last character of the needle
+ *                      match at offset `n`.
+ * @param   needle      A pointer to the characters to search for.
+ * @param   needle_size The number of characters to search for.
+ * @param   mask        The mask that is applied to all characters.
+ *
+ * @return  The offset of the first match inside the block or `ZYCORE_STRING_SEARCH_NOT_FOUND`,
+ *          if none of the candidates matches.
+ */
+static ZyanUSize ZyanStringSearchVerifyForward(const ZyanU8* haystack, ZyanU32 bits,
+    const ZyanU8* needle, ZyanUSize needle_size, ZyanU8 mask)
+{
+    const ZyanUSize inner = (needle_size > 1) ? needle_size - 2 : 0;
+    while (bits)
+    {
+        const ZyanUSize offset = ZyanStringCountTrailingZeros(bits);
+        if (ZyanStringSearchEquals(haystack + offset + 1, needle + 1, inner, mask))
+        {
+            return offset;
+        }
+        bits &= bits - 1;
+    }
+    return ZYCORE_STRING_SEARCH_NOT_FOUND;
+}
+
+/**
+ * Verifies the candidates of a block in descending order.
+ *
+ * @param   haystack    A pointer to the first character of the block.
+ * @param   bits        A mask that has bit `n` set, if the first and last character of the needle
+ *                      match at offset `n`.
+ * @param   needle      A pointer to the characters to search for.
+ * @param   needle_size The number of characters to search for.
+ * @param   mask        The mask that is applied to all characters.
+ *
+ * @return  The offset of the last match inside the block or `ZYCORE_STRING_SEARCH_NOT_FOUND`,
+ *          if none of the candidates matches.
+ */
+static ZyanUSize ZyanStringSearchVerifyReverse(const ZyanU8* haystack, ZyanU32 bits,
+    const ZyanU8* needle, ZyanUSize needle_size, ZyanU8 mask)
+{
+    const ZyanUSize inner = (needle_size > 1) ? needle_size - 2 : 0;
+    while (bits)
+    {
+        const ZyanUSize offset = ZyanStringMostSignificantBit(bits);
+        if (ZyanStringSearchEquals(haystack + offset + 1, needle + 1, inner, mask))
+        {
+            return offset;
+        }
+        bits &= ~((ZyanU32)1 << offset);
+    }
+    return ZYCORE_STRING_SEARCH_NOT_FOUND;
+}
+
+/**
+ * Returns a mask of the 16 candidates starting at `haystack` whose first and last character
+ * match the needle.
+ */
+#define ZYCORE_STRING_SEARCH_MATCH_SSE2(haystack, needle_size, fold, first, last) \
+    (ZyanU32)_mm_movemask_epi8(_mm_and_si128( \
+        _mm_cmpeq_epi8(_mm_or_si128(_mm_loadu_si128((const __m128i*)(haystack)), fold), first), \
+        _mm_cmpeq_epi8(_mm_or_si128(_mm_loadu_si128( \
+            (const __m128i*)((haystack) + (needle_size) - 1)), fold), last)))
+
+/**
+ * Returns a mask of the 32 candidates starting at `haystack` whose first and last character
+ * match the needle.
+ */
+#define ZYCORE_STRING_SEARCH_MATCH_AVX2(haystack, needle_size, fold, first, last) \
+    (ZyanU32)_mm256_movemask_epi8(_mm256_and_si256( \
+        _mm256_cmpeq_epi8(_mm256_or_si256( \
+            _mm256_loadu_si256((const __m256i*)(haystack)), fold), first), \
+        _mm256_cmpeq_epi8(_mm256_or_si256(_mm256_loadu_si256( \
+            (const __m256i*)((haystack) + (needle_size) - 1)), fold), last)))
+
+ZYAN_TARGET("sse2")
+static ZyanUSize ZyanStringSearchForwardSSE2(const ZyanU8* haystack, ZyanUSize haystack_size,
+    const ZyanU8* needle, ZyanUSize needle_size, ZyanU8 mask)
+{
+    const ZyanUSize candidates = haystack_size - needle_size + 1;
+    if (candidates < 16)
+    {
+        return ZyanStringSearchForward(haystack, haystack_size, needle, needle_size, mask);
+    }
+
+    const __m128i fold = _mm_set1_epi8((char)mask);
+    const __m128i first = _mm_set1_epi8((char)(needle[0] | mask));
+    const __m128i last = _mm_set1_epi8((char)(needle[needle_size - 1] | mask));
+
+    ZyanUSize i = 0;
+    for (; i + 16 <= candidates; i += 16)
+    {
+        const ZyanU32 bits =
+            ZYCORE_STRING_SEARCH_MATCH_SSE2(haystack + i, needle_size, fold, first, last);
+        if (bits)
+        {
+            const ZyanUSize offset =
+                ZyanStringSearchVerifyForward(haystack + i, bits, needle, needle_size, mask);
+            if (offset != ZYCORE_STRING_SEARCH_NOT_FOUND)
+            {
+                return i + offset;
+            }
+        }
+    }
+
+    if (i < candidates)
+    {
+        // The last block overlaps the previous one. Skip the candidates that were checked already
+        const ZyanUSize j = candidates - 16;
+        const ZyanU32 bits = ZYCORE_STRING_SEARCH_MATCH_SSE2(haystack + j, needle_size, fold,
+            first, last) & ((ZyanU32)0xFFFF << (i - j));
+        const ZyanUSize offset =
+            ZyanStringSearchVerifyForward(haystack + j, bits, needle, needle_size, mask);
+        if (offset != ZYCORE_STRING_SEARCH_NOT_FOUND)
+        {
+            return j + offset;
+        }
+    }
+
+    return ZYCORE_STRING_SEARCH_NOT_FOUND;
+}
+
+ZYAN_TARGET("sse2")
+static ZyanUSize ZyanStringSearchReverseSSE2(const ZyanU8* haystack, ZyanUSize haystack_size,
+    const ZyanU8* needle, ZyanUSize needle_size, ZyanU8 mask)
+{
+    ZyanUSize candidates = haystack_size - needle_size + 1;
+    if (candidates < 16)
+    {
+        return ZyanStringSearchReverse(haystack, haystack_size, needle, needle_size, mask);
+    }
+
+    const __m128i fold = _mm_set1_epi8((char)mask);
+    const __m128i first = _mm_set1_epi8((char)(needle[0] | mask));
+    const __m128i last = _mm_set1_epi8((char)(needle[needle_size - 1] | mask));
+
+    for (; candidates >= 16; candidates -= 16)
+    {
+        const ZyanUSize i = candidates - 16;
+        const ZyanU32 bits =
+            ZYCORE_STRING_SEARCH_MATCH_SSE2(haystack + i, needle_size, fold, first, last);
+        if (bits)
+        {
+            const ZyanUSize offset =
+                ZyanStringSearchVerifyReverse(haystack + i, bits, needle, needle_size, mask);
+            if (offset != ZYCORE_STRING_SEARCH_NOT_FOUND)
+            {
+                return i + offset;
+            }
+        }
+    }
+
+    if (candidates)
+    {
+        // The first block overlaps the previous one. Skip the candidates that were checked already
+        const ZyanU32 bits = ZYCORE_STRING_SEARCH_MATCH_SSE2(haystack, needle_size, fold, first,
+            last) & (((ZyanU32)1 << candidates) - 1);
+        return ZyanStringSearchVerifyReverse(haystack, bits, needle, needle_size, mask);
+    }
+
+    return ZYCORE_STRING_SEARCH_NOT_FOUND;
+}
+
+ZYAN_TARGET("avx2")
+static ZyanUSize ZyanStringSearchForwardAVX2(const ZyanU8* haystack, ZyanUSize haystack_size,
+    const ZyanU8* needle, ZyanUSize needle_size, ZyanU8 mask)
+{
+    const ZyanUSize candidates = haystack_size - needle_size + 1;
+    if (candidates < 32)
+    {
+        return ZyanStringSearchForwardSSE2(haystack, haystack_size, needle, needle_size, mask);
+    }
+
+    const __m256i fold = _mm256_set1_epi8((char)mask);
+    const __m256i first = _mm256_set1_epi8((char)(needle[0] | mask));
+    const __m256i last = _mm256_set1_epi8((char)(needle[needle_size - 1] | mask));
+
+    ZyanUSize i = 0;
+    for (; i + 64 <= candidates; i += 64)
+    {
+        // Check two blocks at once, as matching candidates are rare
+        const ZyanU32 lo =
+            ZYCORE_STRING_SEARCH_MATCH_AVX2(haystack + i, needle_size, fold, first, last);
+        const ZyanU32 hi =
+            ZYCORE_STRING_SEARCH_MATCH_AVX2(haystack + i + 32, needle_size, fold, first, last);
+        if (lo | hi)
+        {
+            ZyanUSize offset =
+                ZyanStringSearchVerifyForward(haystack + i, lo, needle, needle_size, mask);
+            if (offset != ZYCORE_STRING_SEARCH_NOT_FOUND)
+            {
+                return i + offset;
+            }
+            offset =
+                ZyanStringSearchVerifyForward(haystack + i + 32, hi, needle, needle_size, mask);
+            if (offset != ZYCORE_STRING_SEARCH_NOT_FOUND)
+            {
+                return i + 32 + offset;
+            }
+        }
+    }
+    for (; i + 32 <= candidates; i += 32)
+    {
+        const ZyanU32 bits =
+            ZYCORE_STRING_SEARCH_MATCH_AVX2(haystack + i, needle_size, fold, first, last);
+        const ZyanUSize offset =
+            ZyanStringSearchVerifyForward(haystack + i, bits, needle, needle_size, mask);
+        if (offset != ZYCORE_STRING_SEARCH_NOT_FOUND)
+        {
+            return i + offset;
+        }
+    }
+
+    if (i < candidates)
+    {
+        // The last block overlaps the previous one. Skip the candidates that were checked already
+        const ZyanUSize j = candidates - 32;
+        const ZyanU32 bits = ZYCORE_STRING_SEARCH_MATCH_AVX2(haystack + j, needle_size, fold,
+            first, last) & ((ZyanU32)0xFFFFFFFF << (i - j));
+        const ZyanUSize offset =
+            ZyanStringSearchVerifyForward(haystack + j, bits, needle, needle_size, mask);
+        if (offset != ZYCORE_STRING_SEARCH_NOT_FOUND)
+        {
+            return j + offset;
+        }
+    }
+
+    return ZYCORE_STRING_SEARCH_NOT_FOUND;
+}
+
+ZYAN_TARGET("avx2")
+static ZyanUSize ZyanStringSearchReverseAVX2(const ZyanU8* haystack, ZyanUSize haystack_size,
+    const ZyanU8* needle, ZyanUSize needle_size, ZyanU8 mask)
+{
+    ZyanUSize candidates = haystack_size - needle_size + 1;
+    if (candidates < 32)
+    {
+        return ZyanStringSearchReverseSSE2(haystack, haystack_size, needle, needle_size, mask);
+    }
+
+    const __m256i fold = _mm256_set1_epi8((char)mask);
+    const __m256i first = _mm256_set1_epi8((char)(needle[0] | mask));
+    const __m256i last = _mm256_set1_epi8((char)(needle[needle_size - 1] | mask));
+
+    for (; candidates >= 32; candidates -= 32)
+    {
+        const ZyanUSize i = candidates - 32;
+        const ZyanU32 bits =
+            ZYCORE_STRING_SEARCH_MATCH_AVX2(haystack + i, needle_size, fold, first, last);
+        if (bits)
+        {
+            const ZyanUSize offset =
+                ZyanStringSearchVerifyReverse(haystack + i, bits, needle, needle_size, mask);
+            if (offset != ZYCORE_STRING_SEARCH_NOT_FOUND)
+            {
+                return i + offset;
+            }
+        }
+    }
+
+    if (candidates)
+    {
+        // The first block overlaps the previous one. Skip the candidates that were checked already
+        const ZyanU32 bits = ZYCORE_STRING_SEARCH_MATCH_AVX2(haystack, needle_size, fold, first,
+            last) & (((ZyanU32)1 << candidates) - 1);
+        return ZyanStringSearchVerifyReverse(haystack, bits, needle, needle_size, mask);
+    }
+
+    return ZYCORE_STRING_SEARCH_NOT_FOUND;
+}
+
+#endif // ZYCORE_STRING_HAS_SIMD
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Case folding                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the given byte `value` repeated in all bytes of a 64-bit word.
+ */
+#define ZYCORE_STRING_SWAR_BROADCAST(value) \
+    ((ZyanU64)0x0101010101010101 * (ZyanU8)(value))
+
+static void ZyanStringFlipCase(ZyanU8* data, ZyanUSize size, ZyanU8 first)
+{
+    // Processes 8 characters at once. Adding the offsets to the lower 7 bits of a character never
+    // carries into the next character and sets bit 7, if the character is not below the bound.
+    // Characters with bit 7 set are never letters.
+    const ZyanU64 high  = ZYCORE_STRING_SWAR_BROADCAST(0x80);
+    const ZyanU64 lower = ZYCORE_STRING_SWAR_BROADCAST(0x80 - first);
+    const ZyanU64 upper = ZYCORE_STRING_SWAR_BROADCAST(0x80 - first - 26);
+
+    ZyanUSize i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        ZyanU64 value;
+        ZYAN_MEMCPY(&value, data + i, 8);
+        const ZyanU64 bits = value & ~high;
+        const ZyanU64 letters = ((bits + lower) ^ (bits + upper)) & ~value & high;
+        if (letters)
+        {
+            value ^= letters >> 2;
+            ZYAN_MEMCPY(data + i, &value, 8);
+        }
+    }
+    for (; i < size; ++i)
+    {
+        if ((ZyanU8)(data[i] - first) < 26)
+        {
+            data[i] ^= 0x20;
+        }
+    }
+}
+
+static ZyanUSize ZyanStringMismatchI(const ZyanU8* a, const ZyanU8* b, ZyanUSize size)
+{
+    const ZyanU64 fold = ZYCORE_STRING_SWAR_BROADCAST(0x20);
+
+    ZyanUSize i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        ZyanU64 x, y;
+        ZYAN_MEMCPY(&x, a + i, 8);
+        ZYAN_MEMCPY(&y, b + i, 8);
+        if ((x ^ y) & ~fold)
+        {
+            break;
+        }
+    }
+    for (; i < size; ++i)
+    {
+        if ((a[i] ^ b[i]) & ~0x20)
+        {
+            return i;
+        }
+    }
+
+    return size;
+}
+
+#ifdef ZYCORE_STRING_HAS_SIMD
+
+/**
+ * Returns a mask of the characters in the given vector that are letters in the range described by
+ * `offset`.
+ *
+ * Adding `offset` maps the range of letters to the lowest 26 signed values, so a single signed
+ * comparison suffices.
+ */
+#define ZYCORE_STRING_LETTERS_SSE2(value, offset) \
+    _mm_cmplt_epi8(_mm_add_epi8(value, offset), _mm_set1_epi8(-128 + 26))
+
+/**
+ * Returns a mask of the characters in the given vector that are letters in the range described by
+ * `offset`.
+ */
+#define ZYCORE_STRING_LETTERS_AVX2(value, offset) \
+    _mm256_cmpgt_epi8(_mm256_set1_epi8(-128 + 26), _mm256_add_epi8(value, offset))
+
+ZYAN_TARGET("sse2")
+static void ZyanStringFlipCaseSSE2(ZyanU8* data, ZyanUSize size, ZyanU8 first)
+{
+    const __m128i offset = _mm_set1_epi8((char)(0x80 - first));
+    const __m128i fold = _mm_set1_epi8(0x20);
+
+    ZyanUSize i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const __m128i value = _mm_loadu_si128((const __m128i*)(data + i));
+        const __m128i letters = ZYCORE_STRING_LETTERS_SSE2(value, offset);
+        // Blocks of strings that are already normalized are not written at all
+        if (_mm_movemask_epi8(letters))
+        {
+            _mm_storeu_si128((__m128i*)(data + i),
+                _mm_xor_si128(value, _mm_and_si128(letters, fold)));
+        }
+    }
+
+    // Toggling is not idempotent, so the tail can not be handled by an overlapping block
+    ZyanStringFlipCase(data + i, size - i, first);
+}
+
+ZYAN_TARGET("avx2")
+static void ZyanStringFlipCaseAVX2(ZyanU8* data, ZyanUSize size, ZyanU8 first)
+{
+    const __m256i offset = _mm256_set1_epi8((char)(0x80 - first));
+    const __m256i fold = _mm256_set1_epi8(0x20);
+
+    ZyanUSize i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const __m256i value = _mm256_loadu_si256((const __m256i*)(data + i));
+        const __m256i letters = ZYCORE_STRING_LETTERS_AVX2(value, offset);
+        if (_mm256_movemask_epi8(letters))
+        {
+            _mm256_storeu_si256((__m256i*)(data + i),
+                _mm256_xor_si256(value, _mm256_and_si256(letters, fold)));
+        }
+    }
+    if (i + 16 <= size)
+    {
+        const __m128i value = _mm_loadu_si128((const __m128i*)(data + i));
+        const __m128i letters =
+            ZYCORE_STRING_LETTERS_SSE2(value, _mm256_castsi256_si128(offset));
+        if (_mm_movemask_epi8(letters))
+        {
+            _mm_storeu_si128((__m128i*)(data + i),
+                _mm_xor_si128(value, _mm_and_si128(letters, _mm256_castsi256_si128(fold))));
+        }
+        i += 16;
+    }
+
+    // Avoid the transition penalty when the scalar code uses legacy SSE instructions
+    _mm256_zeroupper();
+    ZyanStringFlipCase(data + i, size - i, first);
+}
+
+/**
+ * Returns a mask of the 16 positions at which the given sequences are equal, ignoring bit `0x20`.
  */
-#define ZYCORE_STRING_NULLTERMINATE(string) \
-      *(char*)((ZyanU8*)(string)->vector.data + (string)->vector.size - 1) = '\0';
+#define ZYCORE_STRING_EQUAL_I_SSE2(a, b, fold) \
+    (ZyanU32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_or_si128( \
+        _mm_loadu_si128((const __m128i*)(a)), fold), \
+        _mm_or_si128(_mm_loadu_si128((const __m128i*)(b)), fold)))
 
 /**
- * Checks for a terminating '\0' character at the end of the string data.
+ * Returns a mask of the 32 positions at which the given sequences are equal, ignoring bit `0x20`.
  */
-#define ZYCORE_STRING_ASSERT_NULLTERMINATION(string) \
-      ZYAN_ASSERT(*(char*)((ZyanU8*)(string)->vector.data + (string)->vector.size - 1) == '\0');
+#define ZYCORE_STRING_EQUAL_I_AVX2(a, b, fold) \
+    (ZyanU32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_or_si256( \
+        _mm256_loadu_si256((const __m256i*)(a)), fold), \
+        _mm256_or_si256(_mm256_loadu_si256((const __m256i*)(b)), fold)))
+
+ZYAN_TARGET("sse2")
+static ZyanUSize ZyanStringMismatchISSE2(const ZyanU8* a, const ZyanU8* b, ZyanUSize size)
+{
+    ZYAN_ASSERT(size >= 16);
+
+    const __m128i fold = _mm_set1_epi8(0x20);
+    ZyanUSize i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const ZyanU32 equal = ZYCORE_STRING_EQUAL_I_SSE2(a + i, b + i, fold);
+        if (equal != 0xFFFF)
+        {
+            return i + ZyanStringCountTrailingZeros(~equal);
+        }
+    }
+    if (i == size)
+    {
+        return size;
+    }
+
+    // The last block overlaps with the previous one
+    i = size - 16;
+    const ZyanU32 equal = ZYCORE_STRING_EQUAL_I_SSE2(a + i, b + i, fold);
+    return (equal == 0xFFFF) ? size : i + ZyanStringCountTrailingZeros(~equal);
+}
+
+ZYAN_TARGET("avx2")
+static ZyanUSize ZyanStringMismatchIAVX2(const ZyanU8* a, const ZyanU8* b, ZyanUSize size)
+{
+    ZYAN_ASSERT(size >= 16);
+
+    if (size < 32)
+    {
+        // Two overlapping blocks of 16 characters
+        const __m128i fold = _mm_set1_epi8(0x20);
+        ZyanU32 equal = ZYCORE_STRING_EQUAL_I_SSE2(a, b, fold);
+        if (equal != 0xFFFF)
+        {
+            return ZyanStringCountTrailingZeros(~equal);
+        }
+        equal = ZYCORE_STRING_EQUAL_I_SSE2(a + size - 16, b + size - 16, fold);
+        return (equal == 0xFFFF) ? size : size - 16 + ZyanStringCountTrailingZeros(~equal);
+    }
+
+    const __m256i fold = _mm256_set1_epi8(0x20);
+    ZyanUSize i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const ZyanU32 equal = ZYCORE_STRING_EQUAL_I_AVX2(a + i, b + i, fold);
+        if (equal != 0xFFFFFFFF)
+        {
+            return i + ZyanStringCountTrailingZeros(~equal);
+        }
+    }
+    if (i == size)
+    {
+        return size;
+    }
+
+    i = size - 32;
+    const ZyanU32 equal = ZYCORE_STRING_EQUAL_I_AVX2(a + i, b + i, fold);
+    return (equal == 0xFFFFFFFF) ? size : i + ZyanStringCountTrailingZeros(~equal);
+}
+
+#endif // ZYCORE_STRING_HAS_SIMD
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Dispatching                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the fastest first/last character filter that is supported by the current processor.
+ *
+ * @param   reverse `ZYAN_TRUE` to search from the right or `ZYAN_FALSE`, if not.
+ *
+ * @return  The search function.
+ */
+static ZyanStringSearchFunction ZyanStringGetSearchFunction(ZyanBool reverse)
+{
+#ifdef ZYCORE_STRING_HAS_SIMD
+    if (ZyanProcessorHasFeature(ZYAN_PROCESSOR_FEATURE_AVX2))
+    {
+        return reverse ? &ZyanStringSearchReverseAVX2 : &ZyanStringSearchForwardAVX2;
+    }
+    if (ZyanProcessorHasFeature(ZYAN_PROCESSOR_FEATURE_SSE2))
+    {
+        return reverse ? &ZyanStringSearchReverseSSE2 : &ZyanStringSearchForwardSSE2;
+    }
+#endif
+
+    return reverse ? &ZyanStringSearchReverse : &ZyanStringSearchForward;
+}
+
+/**
+ * Returns the fastest case conversion function for strings of the given `size` that is supported
+ * by the current processor.
+ *
+ * @param   size    The number of characters to convert.
+ *
+ * @return  The case conversion function.
+ */
+static ZyanStringFlipCaseFunction ZyanStringGetFlipCaseFunction(ZyanUSize size)
+{
+#ifdef ZYCORE_STRING_HAS_SIMD
+    if (size < 16)
+    {
+        return &ZyanStringFlipCase;
+    }
+    if (ZyanProcessorHasFeature(ZYAN_PROCESSOR_FEATURE_AVX2))
+    {
+        return &ZyanStringFlipCaseAVX2;
+    }
+    if (ZyanProcessorHasFeature(ZYAN_PROCESSOR_FEATURE_SSE2))
+    {
+        return &ZyanStringFlipCaseSSE2;
+    }
+#else
+    ZYAN_UNUSED(size);
+#endif
+
+    return &ZyanStringFlipCase;
+}
+
+/**
+ * Returns the fastest case-insensitive comparison function for strings of the given `size` that
+ * is supported by the current processor.
+ *
+ * @param   size    The number of characters to compare.
+ *
+ * @return  The comparison function.
+ */
+static ZyanStringMismatchIFunction ZyanStringGetMismatchIFunction(ZyanUSize size)
+{
+#ifdef ZYCORE_STRING_HAS_SIMD
+    // The vectorized functions require at least one full block of 16 characters
+    if (size < 16)
+    {
+        return &ZyanStringMismatchI;
+    }
+    if (ZyanProcessorHasFeature(ZYAN_PROCESSOR_FEATURE_AVX2))
+    {
+        return &ZyanStringMismatchIAVX2;
+    }
+    if (ZyanProcessorHasFeature(ZYAN_PROCESSOR_FEATURE_SSE2))
+    {
+        return &ZyanStringMismatchISSE2;
+    }
+#else
+    ZYAN_UNUSED(size);
+#endif
+
+    return &ZyanStringMismatchI;
+}
+
+/**
+ * Searches for the first (or last) occurrence of `needle` in `haystack`.
+ *
+ * @param   haystack        A pointer to the characters to search in.
+ * @param   haystack_size   The number of characters to search in.
+ * @param   needle          A pointer to the characters to search for.
+ * @param   needle_size     The number of characters to search for (at least `1`).
+ * @param   mask            `0x20` for case-insensitive searches or `0x00`, if not.
+ * @param   reverse         `ZYAN_TRUE` to search for the last occurrence or `ZYAN_FALSE`, if not.
+ *
+ * @return  The index of the occurrence or `ZYCORE_STRING_SEARCH_NOT_FOUND`, if the needle was not
+ *          found.
+ */
+static ZyanUSize ZyanStringSearch(const ZyanU8* haystack, ZyanUSize haystack_size,
+    const ZyanU8* needle, ZyanUSize needle_size, ZyanU8 mask, ZyanBool reverse)
+{
+    ZYAN_ASSERT(needle_size);
+
+    if (needle_size > haystack_size)
+    {
+        return ZYCORE_STRING_SEARCH_NOT_FOUND;
+    }
+
+    if (needle_size <= ZYCORE_STRING_SEARCH_FILTER_MAX_NEEDLE)
+    {
+        return ZyanStringGetSearchFunction(reverse)(haystack, haystack_size, needle,
+            needle_size, mask);
+    }
+
+    if (!reverse)
+    {
+        const ZyanStringSearchSequence h = { haystack, 1, mask };
+        const ZyanStringSearchSequence n = { needle, 1, mask };
+        return ZyanStringSearchTwoWay(&h, haystack_size, &n, needle_size);
+    }
+
+    // Searching for the last occurrence equals searching for the first occurrence of the
+    // reversed needle in the reversed haystack
+    const ZyanStringSearchSequence h = { haystack + haystack_size - 1, -1, mask };
+    const ZyanStringSearchSequence n = { needle + needle_size - 1, -1, mask };
+    const ZyanUSize result = ZyanStringSearchTwoWay(&h, haystack_size, &n, needle_size);
+    return (result == ZYCORE_STRING_SEARCH_NOT_FOUND) ? result :
+        haystack_size - needle_size - result;
+}
+
+/**
+ * Implements the `ZyanStringLPos*` and `ZyanStringRPos*` functions.
+ *
+ * @param   haystack    The string to search in.
+ * @param   needle      The sub-string to search for.
+ * @param   found_index A pointer to a variable that receives the index of the occurrence.
+ * @param   start       The index of the first character to search in.
+ * @param   count       The number of characters to search in.
+ * @param   mask        `0x20` for case-insensitive searches or `0x00`, if not.
+ * @param   reverse     `ZYAN_TRUE` to search for the last occurrence or `ZYAN_FALSE`, if not.
+ *
+ * @return  `ZYAN_STATUS_TRUE`, if the needle was found or `ZYAN_STATUS_FALSE`, if not.
+ */
+static ZyanStatus ZyanStringPosInternal(const ZyanStringView* haystack,
+    const ZyanStringView* needle, ZyanISize* found_index, ZyanUSize start, ZyanUSize count,
+    ZyanU8 mask, ZyanBool reverse)
+{
+    *found_index = -1;
+    if ((haystack->string.vector.size == 1) || (needle->string.vector.size == 1))
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    const ZyanUSize result = ZyanStringSearch(
+        (const ZyanU8*)ZYAN_STRING_DATA(&haystack->string) + start, count,
+        (const ZyanU8*)ZYAN_STRING_DATA(&needle->string), needle->string.vector.size - 1, mask,
+        reverse);
+    if (result == ZYCORE_STRING_SEARCH_NOT_FOUND)
+    {
+        return ZYAN_STATUS_FALSE;
+    }
+
+    *found_index = (ZyanISize)(start + result);
+    return ZYAN_STATUS_TRUE;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
 /* Exported functions                                                                             */
@@ -64,11 +1209,26 @@ ZyanStatus ZyanStringInit(ZyanString* string, ZyanUSize capacity)
 ZyanStatus ZyanStringInitEx(ZyanString* string, ZyanUSize capacity, ZyanAllocator* allocator,
     ZyanU8 growth_factor, ZyanU8 shrink_threshold)
 {
-    if (!string)
+    if (!string || !allocator || (growth_factor < 1))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
+    // Short strings are stored inline and don't require any dynamically allocated memory
+    if (capacity < ZYAN_STRING_INLINE_SIZE(string))
+    {
+        string->flags                   = ZYAN_STRING_IS_INLINE;
+        string->vector.allocator        = allocator;
+        string->vector.growth_policy    = ZYAN_NULL;
+        string->vector.growth_factor    = growth_factor;
+        string->vector.shrink_threshold = shrink_threshold;
+        string->vector.in_small_buffer  = ZYAN_FALSE;
+        string->vector.size             = 1;
+        *ZYAN_STRING_INLINE_DATA(string) = '\0';
+
+        return ZYAN_STATUS_SUCCESS;
+    }
+
     string->flags = 0;
     capacity = ZYAN_MAX(ZYAN_STRING_MIN_CAPACITY, capacity) + 1;
     ZYAN_CHECK(ZyanVectorInitEx(&string->vector, sizeof(char), capacity, ZYAN_NULL, allocator,
@@ -109,7 +1269,7 @@ ZyanStatus ZyanStringDestroy(ZyanString* string)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (string->flags & ZYAN_STRING_HAS_FIXED_CAPACITY)
+    if (string->flags & (ZYAN_STRING_HAS_FIXED_CAPACITY | ZYAN_STRING_IS_INLINE))
     {
         return ZYAN_STATUS_SUCCESS;
     }
@@ -143,9 +1303,9 @@ ZyanStatus ZyanStringDuplicateEx(ZyanString* destination, const ZyanStringView*
     const ZyanUSize len = source->string.vector.size;
     capacity = ZYAN_MAX(capacity, len - 1);
     ZYAN_CHECK(ZyanStringInitEx(destination, capacity, allocator, growth_factor, shrink_threshold));
-    ZYAN_ASSERT(destination->vector.capacity >= len);
+    ZYAN_ASSERT(ZYAN_STRING_BUFFER_SIZE(destination) >= len);
 
-    ZYAN_MEMCPY(destination->vector.data, source->string.vector.data,
+    ZYAN_MEMCPY(ZYAN_STRING_DATA(destination), ZYAN_STRING_DATA(&source->string),
         source->string.vector.size - 1);
     destination->vector.size = len;
     ZYCORE_STRING_NULLTERMINATE(destination);
@@ -168,9 +1328,9 @@ ZyanStatus ZyanStringDuplicateCustomBuffer(ZyanString* destination, const ZyanSt
     }
 
     ZYAN_CHECK(ZyanStringInitCustomBuffer(destination, buffer, capacity));
-    ZYAN_ASSERT(destination->vector.capacity >= len);
+    ZYAN_ASSERT(ZYAN_STRING_BUFFER_SIZE(destination) >= len);
 
-    ZYAN_MEMCPY(destination->vector.data, source->string.vector.data,
+    ZYAN_MEMCPY(ZYAN_STRING_DATA(destination), ZYAN_STRING_DATA(&source->string),
         source->string.vector.size - 1);
     destination->vector.size = len;
     ZYCORE_STRING_NULLTERMINATE(destination);
@@ -205,11 +1365,12 @@ ZyanStatus ZyanStringConcatEx(ZyanString* destination, const ZyanStringView* s1,
     const ZyanUSize len = s1->string.vector.size + s2->string.vector.size - 1;
     capacity = ZYAN_MAX(capacity, len - 1);
     ZYAN_CHECK(ZyanStringInitEx(destination, capacity, allocator, growth_factor, shrink_threshold));
-    ZYAN_ASSERT(destination->vector.capacity >= len);
+    ZYAN_ASSERT(ZYAN_STRING_BUFFER_SIZE(destination) >= len);
 
-    ZYAN_MEMCPY(destination->vector.data, s1->string.vector.data, s1->string.vector.size - 1);
-    ZYAN_MEMCPY((char*)destination->vector.data + s1->string.vector.size - 1,
-        s2->string.vector.data, s2->string.vector.size - 1);
+    char* const data = ZYAN_STRING_DATA(destination);
+    ZYAN_MEMCPY(data, ZYAN_STRING_DATA(&s1->string), s1->string.vector.size - 1);
+    ZYAN_MEMCPY(data + s1->string.vector.size - 1, ZYAN_STRING_DATA(&s2->string),
+        s2->string.vector.size - 1);
     destination->vector.size = len;
     ZYCORE_STRING_NULLTERMINATE(destination);
 
@@ -231,11 +1392,12 @@ ZyanStatus ZyanStringConcatCustomBuffer(ZyanString* destination, const ZyanStrin
     }
 
     ZYAN_CHECK(ZyanStringInitCustomBuffer(destination, buffer, capacity));
-    ZYAN_ASSERT(destination->vector.capacity >= len);
+    ZYAN_ASSERT(ZYAN_STRING_BUFFER_SIZE(destination) >= len);
 
-    ZYAN_MEMCPY(destination->vector.data, s1->string.vector.data, s1->string.vector.size - 1);
-    ZYAN_MEMCPY((char*)destination->vector.data + s1->string.vector.size - 1,
-        s2->string.vector.data, s2->string.vector.size - 1);
+    char* const data = ZYAN_STRING_DATA(destination);
+    ZYAN_MEMCPY(data, ZYAN_STRING_DATA(&s1->string), s1->string.vector.size - 1);
+    ZYAN_MEMCPY(data + s1->string.vector.size - 1, ZYAN_STRING_DATA(&s2->string),
+        s2->string.vector.size - 1);
     destination->vector.size = len;
     ZYCORE_STRING_NULLTERMINATE(destination);
 
@@ -253,8 +1415,9 @@ ZyanStatus ZyanStringViewInsideView(ZyanStringView* view, const ZyanStringView*
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    view->string.vector.data = source->string.vector.data;
+    view->string.vector.data = ZYAN_STRING_DATA(&source->string);
     view->string.vector.size = source->string.vector.size;
+    view->string.flags = 0;
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -272,8 +1435,9 @@ ZyanStatus ZyanStringViewInsideViewEx(ZyanStringView* view, const ZyanStringView
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    view->string.vector.data = (void*)((char*)source->string.vector.data + index);
+    view->string.vector.data = ZYAN_STRING_DATA(&source->string) + index;
     view->string.vector.size = count;
+    view->string.flags = 0;
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -285,6 +1449,7 @@ ZyanStatus ZyanStringViewInsideBuffer(ZyanStringView* view, const char* string)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
+    view->string.flags = 0;
     view->string.vector.data = (void*)string;
     view->string.vector.size = ZYAN_STRLEN(string) + 1;
 
@@ -298,6 +1463,7 @@ ZyanStatus ZyanStringViewInsideBufferEx(ZyanStringView* view, const char* buffer
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
+    view->string.flags = 0;
     view->string.vector.data = (void*)buffer;
     view->string.vector.size = length + 1;
 
@@ -324,7 +1490,7 @@ ZYCORE_EXPORT ZyanStatus ZyanStringViewGetData(const ZyanStringView* view, const
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    *buffer = view->string.vector.data;
+    *buffer = ZYAN_STRING_DATA(&view->string);
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -346,16 +1512,14 @@ ZyanStatus ZyanStringGetChar(const ZyanStringView* string, ZyanUSize index, char
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    const char* chr;
-    ZYAN_CHECK(ZyanVectorGetPointer(&string->string.vector, index, (const void**)&chr));
-    *value = *chr;
+    *value = ZYAN_STRING_DATA(&string->string)[index];
 
     return ZYAN_STATUS_SUCCESS;
 }
 
 ZyanStatus ZyanStringGetCharMutable(ZyanString* string, ZyanUSize index, char** value)
 {
-    if (!string)
+    if (!string || !value)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
@@ -366,7 +1530,9 @@ ZyanStatus ZyanStringGetCharMutable(ZyanString* string, ZyanUSize index, char**
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    return ZyanVectorGetPointerMutable(&string->vector, index, (void**)value);
+    *value = ZYAN_STRING_DATA(string) + index;
+
+    return ZYAN_STATUS_SUCCESS;
 }
 
 ZyanStatus ZyanStringSetChar(ZyanString* string, ZyanUSize index, char value)
@@ -382,7 +1548,9 @@ ZyanStatus ZyanStringSetChar(ZyanString* string, ZyanUSize index, char value)
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    return ZyanVectorSet(&string->vector, index, (void*)&value);
+    ZYAN_STRING_DATA(string)[index] = value;
+
+    return ZYAN_STATUS_SUCCESS;
 }
 
 /* ---------------------------------------------------------------------------------------------- */
@@ -407,8 +1575,12 @@ ZyanStatus ZyanStringInsert(ZyanString* destination, ZyanUSize index, const Zyan
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    ZYAN_CHECK(ZyanVectorInsertRange(&destination->vector, index, source->string.vector.data,
-        source->string.vector.size - 1));
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(destination, &temp);
+    const ZyanStatus status = ZyanVectorInsertRange(vector, index,
+        ZYAN_STRING_DATA(&source->string), source->string.vector.size - 1);
+    ZyanStringEndUpdate(destination, vector);
+    ZYAN_CHECK(status);
     ZYCORE_STRING_ASSERT_NULLTERMINATION(destination);
 
     return ZYAN_STATUS_SUCCESS;
@@ -439,8 +1611,12 @@ ZyanStatus ZyanStringInsertEx(ZyanString* destination, ZyanUSize destination_ind
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    ZYAN_CHECK(ZyanVectorInsertRange(&destination->vector, destination_index,
-        (char*)source->string.vector.data + source_index, count));
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(destination, &temp);
+    const ZyanStatus status = ZyanVectorInsertRange(vector, destination_index,
+        ZYAN_STRING_DATA(&source->string) + source_index, count);
+    ZyanStringEndUpdate(destination, vector);
+    ZYAN_CHECK(status);
     ZYCORE_STRING_ASSERT_NULLTERMINATION(destination);
 
     return ZYAN_STATUS_SUCCESS;
@@ -458,8 +1634,12 @@ ZyanStatus ZyanStringAppend(ZyanString* destination, const ZyanStringView* sourc
     }
 
     const ZyanUSize len = destination->vector.size;
-    ZYAN_CHECK(ZyanVectorResize(&destination->vector, len + source->string.vector.size - 1));
-    ZYAN_MEMCPY((char*)destination->vector.data + len - 1, source->string.vector.data,
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(destination, &temp);
+    const ZyanStatus status = ZyanVectorResize(vector, len + source->string.vector.size - 1);
+    ZyanStringEndUpdate(destination, vector);
+    ZYAN_CHECK(status);
+    ZYAN_MEMCPY(ZYAN_STRING_DATA(destination) + len - 1, ZYAN_STRING_DATA(&source->string),
         source->string.vector.size - 1);
     ZYCORE_STRING_NULLTERMINATE(destination);
 
@@ -481,9 +1661,13 @@ ZyanStatus ZyanStringAppendEx(ZyanString* destination, const ZyanStringView* sou
     }
 
     const ZyanUSize len = destination->vector.size;
-    ZYAN_CHECK(ZyanVectorResize(&destination->vector, len + count));
-    ZYAN_MEMCPY((char*)destination->vector.data + len - 1,
-        (const char*)source->string.vector.data + source_index, count);
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(destination, &temp);
+    const ZyanStatus status = ZyanVectorResize(vector, len + count);
+    ZyanStringEndUpdate(destination, vector);
+    ZYAN_CHECK(status);
+    ZYAN_MEMCPY(ZYAN_STRING_DATA(destination) + len - 1,
+        ZYAN_STRING_DATA(&source->string) + source_index, count);
     ZYCORE_STRING_NULLTERMINATE(destination);
 
     return ZYAN_STATUS_SUCCESS;
@@ -506,7 +1690,11 @@ ZyanStatus ZyanStringDelete(ZyanString* string, ZyanUSize index, ZyanUSize count
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    ZYAN_CHECK(ZyanVectorDeleteRange(&string->vector, index, count));
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(string, &temp);
+    const ZyanStatus status = ZyanVectorDeleteRange(vector, index, count);
+    ZyanStringEndUpdate(string, vector);
+    ZYAN_CHECK(status);
     ZYCORE_STRING_NULLTERMINATE(string);
 
     return ZYAN_STATUS_SUCCESS;
@@ -525,7 +1713,12 @@ ZyanStatus ZyanStringTruncate(ZyanString* string, ZyanUSize index)
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    ZYAN_CHECK(ZyanVectorDeleteRange(&string->vector, index, string->vector.size - index - 1));
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(string, &temp);
+    const ZyanStatus status =
+        ZyanVectorDeleteRange(vector, index, string->vector.size - index - 1);
+    ZyanStringEndUpdate(string, vector);
+    ZYAN_CHECK(status);
     ZYCORE_STRING_NULLTERMINATE(string);
 
     return ZYAN_STATUS_SUCCESS;
@@ -538,11 +1731,15 @@ ZyanStatus ZyanStringClear(ZyanString* string)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    ZYAN_CHECK(ZyanVectorClear(&string->vector));
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(string, &temp);
+    const ZyanStatus status = ZyanVectorClear(vector);
+    ZyanStringEndUpdate(string, vector);
+    ZYAN_CHECK(status);
     // `ZyanVector` guarantees a minimum capacity of 1 element/character
-    ZYAN_ASSERT(string->vector.capacity >= 1);
+    ZYAN_ASSERT(ZYAN_STRING_BUFFER_SIZE(string) >= 1);
 
-    *(char*)string->vector.data = '\0';
+    *ZYAN_STRING_DATA(string) = '\0';
     string->vector.size++;
 
     return ZYAN_STATUS_SUCCESS;
@@ -577,44 +1774,7 @@ ZyanStatus ZyanStringLPosEx(const ZyanStringView* haystack, const ZyanStringView
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    if ((haystack->string.vector.size == 1) || (needle->string.vector.size == 1) ||
-        (haystack->string.vector.size < needle->string.vector.size))
-    {
-        *found_index = -1;
-        return ZYAN_STATUS_FALSE;
-    }
-
-    const char* s = (const char*)haystack->string.vector.data + index;
-    const char* b = (const char*)needle->string.vector.data;
-    for (; s + 1 < (const char*)haystack->string.vector.data + haystack->string.vector.size; ++s)
-    {
-        if (*s != *b)
-        {
-            continue;
-        }
-        const char* a = s;
-        for (;;)
-        {
-            if ((ZyanUSize)(a - (const char*)haystack->string.vector.data) > index + count)
-            {
-                *found_index = -1;
-                return ZYAN_STATUS_FALSE;
-            }
-            if (*b == 0)
-            {
-                *found_index = (ZyanISize)(s - (const char*)haystack->string.vector.data);
-                return ZYAN_STATUS_TRUE;
-            }
-            if (*a++ != *b++)
-            {
-                break;
-            }
-        }
-        b = (char*)needle->string.vector.data;
-    }
-
-    *found_index = -1;
-    return ZYAN_STATUS_FALSE;
+    return ZyanStringPosInternal(haystack, needle, found_index, index, count, 0x00, ZYAN_FALSE);
 }
 
 ZyanStatus ZyanStringLPosI(const ZyanStringView* haystack, const ZyanStringView* needle,
@@ -631,10 +1791,6 @@ ZyanStatus ZyanStringLPosI(const ZyanStringView* haystack, const ZyanStringView*
 ZyanStatus ZyanStringLPosIEx(const ZyanStringView* haystack, const ZyanStringView* needle,
     ZyanISize* found_index, ZyanUSize index, ZyanUSize count)
 {
-    // This solution assumes that characters are represented using ASCII representation, i.e.,
-    // codes for 'a', 'b', 'c', .. 'z' are 97, 98, 99, .. 122 respectively. And codes for 'A',
-    // 'B', 'C', .. 'Z' are 65, 66, .. 95 respectively.
-
     if (!haystack || !needle || !found_index)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
@@ -646,46 +1802,7 @@ ZyanStatus ZyanStringLPosIEx(const ZyanStringView* haystack, const ZyanStringVie
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    if ((haystack->string.vector.size == 1) || (needle->string.vector.size == 1) ||
-        (haystack->string.vector.size < needle->string.vector.size))
-    {
-        *found_index = -1;
-        return ZYAN_STATUS_FALSE;
-    }
-
-    const char* s = (const char*)haystack->string.vector.data + index;
-    const char* b = (const char*)needle->string.vector.data;
-    for (; s + 1 < (const char*)haystack->string.vector.data + haystack->string.vector.size; ++s)
-    {
-        if ((*s != *b) && ((*s ^ 32) != *b))
-        {
-            continue;
-        }
-        const char* a = s;
-        for (;;)
-        {
-            if ((ZyanUSize)(a - (const char*)haystack->string.vector.data) > index + count)
-            {
-                *found_index = -1;
-                return ZYAN_STATUS_FALSE;
-            }
-            if (*b == 0)
-            {
-                *found_index = (ZyanISize)(s - (const char*)haystack->string.vector.data);
-                return ZYAN_STATUS_TRUE;
-            }
-            const char c1 = *a++;
-            const char c2 = *b++;
-            if ((c1 != c2) && ((c1 ^ 32) != c2))
-            {
-                break;
-            }
-        }
-        b = (char*)needle->string.vector.data;
-    }
-
-    *found_index = -1;
-    return ZYAN_STATUS_FALSE;
+    return ZyanStringPosInternal(haystack, needle, found_index, index, count, 0x20, ZYAN_FALSE);
 }
 
 ZyanStatus ZyanStringRPos(const ZyanStringView* haystack, const ZyanStringView* needle,
@@ -714,45 +1831,8 @@ ZyanStatus ZyanStringRPosEx(const ZyanStringView* haystack, const ZyanStringView
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    if (!index || !count ||
-        (haystack->string.vector.size == 1) || (needle->string.vector.size == 1) ||
-        (haystack->string.vector.size < needle->string.vector.size))
-    {
-        *found_index = -1;
-        return ZYAN_STATUS_FALSE;
-    }
-
-    const char* s = (const char*)haystack->string.vector.data + index - 1;
-    const char* b = (const char*)needle->string.vector.data + needle->string.vector.size - 2;
-    for (; s >= (const char*)haystack->string.vector.data; --s)
-    {
-        if (*s != *b)
-        {
-            continue;
-        }
-        const char* a = s;
-        for (;;)
-        {
-            if (b < (const char*)needle->string.vector.data)
-            {
-                *found_index = (ZyanISize)(a - (const char*)haystack->string.vector.data + 1);
-                return ZYAN_STATUS_TRUE;
-            }
-            if (a < (const char*)haystack->string.vector.data + index - count)
-            {
-                *found_index = -1;
-                return ZYAN_STATUS_FALSE;
-            }
-            if (*a-- != *b--)
-            {
-                break;
-            }
-        }
-        b = (char*)needle->string.vector.data + needle->string.vector.size - 2;
-    }
-
-    *found_index = -1;
-    return ZYAN_STATUS_FALSE;
+    return ZyanStringPosInternal(haystack, needle, found_index, index - count, count, 0x00,
+        ZYAN_TRUE);
 }
 
 ZyanStatus ZyanStringRPosI(const ZyanStringView* haystack, const ZyanStringView* needle,
@@ -770,10 +1850,6 @@ ZyanStatus ZyanStringRPosI(const ZyanStringView* haystack, const ZyanStringView*
 ZyanStatus ZyanStringRPosIEx(const ZyanStringView* haystack, const ZyanStringView* needle,
     ZyanISize* found_index, ZyanUSize index, ZyanUSize count)
 {
-    // This solution assumes that characters are represented using ASCII representation, i.e.,
-    // codes for 'a', 'b', 'c', .. 'z' are 97, 98, 99, .. 122 respectively. And codes for 'A',
-    // 'B', 'C', .. 'Z' are 65, 66, .. 95 respectively.
-
     if (!haystack || !needle || !found_index)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
@@ -785,47 +1861,8 @@ ZyanStatus ZyanStringRPosIEx(const ZyanStringView* haystack, const ZyanStringVie
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    if (!index || !count ||
-        (haystack->string.vector.size == 1) || (needle->string.vector.size == 1) ||
-        (haystack->string.vector.size < needle->string.vector.size))
-    {
-        *found_index = -1;
-        return ZYAN_STATUS_FALSE;
-    }
-
-    const char* s = (const char*)haystack->string.vector.data + index - 1;
-    const char* b = (const char*)needle->string.vector.data + needle->string.vector.size - 2;
-    for (; s >= (const char*)haystack->string.vector.data; --s)
-    {
-        if ((*s != *b) && ((*s ^ 32) != *b))
-        {
-            continue;
-        }
-        const char* a = s;
-        for (;;)
-        {
-            if (b < (const char*)needle->string.vector.data)
-            {
-                *found_index = (ZyanISize)(a - (const char*)haystack->string.vector.data + 1);
-                return ZYAN_STATUS_TRUE;
-            }
-            if (a < (const char*)haystack->string.vector.data + index - count)
-            {
-                *found_index = -1;
-                return ZYAN_STATUS_FALSE;
-            }
-            const char c1 = *a--;
-            const char c2 = *b--;
-            if ((c1 != c2) && ((c1 ^ 32) != c2))
-            {
-                break;
-            }
-        }
-        b = (char*)needle->string.vector.data + needle->string.vector.size - 2;
-    }
-
-    *found_index = -1;
-    return ZYAN_STATUS_FALSE;
+    return ZyanStringPosInternal(haystack, needle, found_index, index - count, count, 0x20,
+        ZYAN_TRUE);
 }
 
 /* ---------------------------------------------------------------------------------------------- */
@@ -850,8 +1887,8 @@ ZyanStatus ZyanStringCompare(const ZyanStringView* s1, const ZyanStringView* s2,
         return ZYAN_STATUS_FALSE;
     }
 
-    const char* const a = (char*)s1->string.vector.data;
-    const char* const b = (char*)s2->string.vector.data;
+    const char* const a = ZYAN_STRING_DATA(&s1->string);
+    const char* const b = ZYAN_STRING_DATA(&s2->string);
     ZyanUSize i;
     for (i = 0; (i + 1 < s1->string.vector.size) && (i + 1 < s2->string.vector.size); ++i)
     {
@@ -900,19 +1937,13 @@ ZyanStatus ZyanStringCompareI(const ZyanStringView* s1, const ZyanStringView* s2
         return ZYAN_STATUS_FALSE;
     }
 
-    const char* const a = (char*)s1->string.vector.data;
-    const char* const b = (char*)s2->string.vector.data;
-    ZyanUSize i;
-    for (i = 0; (i + 1 < s1->string.vector.size) && (i + 1 < s2->string.vector.size); ++i)
-    {
-        if ((a[i] == b[i]) || ((a[i] ^ 32) == b[i]))
-        {
-            continue;
-        }
-        break;
-    }
+    const char* const a = ZYAN_STRING_DATA(&s1->string);
+    const char* const b = ZYAN_STRING_DATA(&s2->string);
+    const ZyanUSize size = s1->string.vector.size - 1;
+    const ZyanUSize i =
+        ZyanStringGetMismatchIFunction(size)((const ZyanU8*)a, (const ZyanU8*)b, size);
 
-    if (a[i] == b[i])
+    if (i == size)
     {
         *result = 0;
         return ZYAN_STATUS_TRUE;
@@ -959,16 +1990,7 @@ ZyanStatus ZyanStringToLowerCaseEx(ZyanString* string, ZyanUSize index, ZyanUSiz
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    char* s = (char*)string->vector.data + index;
-    for (ZyanUSize i = index; i < index + count; ++i)
-    {
-        const char c = *s;
-        if ((c >= 'A') && (c <= 'Z'))
-        {
-            *s = c | 32;
-        }
-        ++s;
-    }
+    ZyanStringGetFlipCaseFunction(count)((ZyanU8*)ZYAN_STRING_DATA(string) + index, count, 'A');
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -1000,16 +2022,7 @@ ZyanStatus ZyanStringToUpperCaseEx(ZyanString* string, ZyanUSize index, ZyanUSiz
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    char* s = (char*)string->vector.data + index;
-    for (ZyanUSize i = index; i < index + count; ++i)
-    {
-        const char c = *s;
-        if ((c >= 'a') && (c <= 'z'))
-        {
-            *s = c & ~32;
-        }
-        ++s;
-    }
+    ZyanStringGetFlipCaseFunction(count)((ZyanU8*)ZYAN_STRING_DATA(string) + index, count, 'a');
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -1025,7 +2038,11 @@ ZyanStatus ZyanStringResize(ZyanString* string, ZyanUSize size)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    ZYAN_CHECK(ZyanVectorResize(&string->vector, size + 1));
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(string, &temp);
+    const ZyanStatus status = ZyanVectorResize(vector, size + 1);
+    ZyanStringEndUpdate(string, vector);
+    ZYAN_CHECK(status);
     ZYCORE_STRING_NULLTERMINATE(string);
 
     return ZYAN_STATUS_SUCCESS;
@@ -1038,7 +2055,27 @@ ZyanStatus ZyanStringReserve(ZyanString* string, ZyanUSize capacity)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    return ZyanVectorReserve(&string->vector, capacity);
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(string, &temp);
+    const ZyanStatus status = ZyanVectorReserve(vector, capacity);
+    ZyanStringEndUpdate(string, vector);
+
+    return status;
+}
+
+ZyanStatus ZyanStringSetGrowthPolicy(ZyanString* string, const ZyanGrowthPolicy* policy)
+{
+    if (!string)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(string, &temp);
+    const ZyanStatus status = ZyanVectorSetGrowthPolicy(vector, policy);
+    ZyanStringEndUpdate(string, vector);
+
+    return status;
 }
 
 ZyanStatus ZyanStringShrinkToFit(ZyanString* string)
@@ -1048,7 +2085,12 @@ ZyanStatus ZyanStringShrinkToFit(ZyanString* string)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    return ZyanVectorShrinkToFit(&string->vector);
+    ZyanVector temp;
+    ZyanVector* const vector = ZyanStringBeginUpdate(string, &temp);
+    const ZyanStatus status = ZyanVectorShrinkToFit(vector);
+    ZyanStringEndUpdate(string, vector);
+
+    return status;
 }
 
 /* ---------------------------------------------------------------------------------------------- */
@@ -1062,8 +2104,8 @@ ZyanStatus ZyanStringGetCapacity(const ZyanString* string, ZyanUSize* capacity)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    ZYAN_ASSERT(string->vector.capacity >= 1);
-    *capacity = string->vector.capacity - 1;
+    ZYAN_ASSERT(ZYAN_STRING_BUFFER_SIZE(string) >= 1);
+    *capacity = ZYAN_STRING_BUFFER_SIZE(string) - 1;
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -1088,7 +2130,7 @@ ZyanStatus ZyanStringGetData(const ZyanString* string, const char** value)
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
 
-    *value = string->vector.data;
+    *value = ZYAN_STRING_DATA(string);
 
     return ZYAN_STATUS_SUCCESS;
 }
@@ -0,0 +1,648 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/StringMatcher.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Marks missing transitions and empty pattern lists while building the automaton.
+ */
+#define ZYCORE_STRING_MATCHER_NONE \
+    ((ZyanU32)-1)
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanStringMatcherBuilder` struct.
+ *
+ * Holds the temporary tables used while building the automaton. All tables are stored in a
+ * single buffer.
+ */
+typedef struct ZyanStringMatcherBuilder_
+{
+    /**
+     * The transition table of the trie (and later of the automaton) with `class_count` entries
+     * per state.
+     */
+    ZyanU32* transitions;
+    /**
+     * The failure link of every state.
+     */
+    ZyanU32* fail;
+    /**
+     * The states in breadth-first order.
+     */
+    ZyanU32* order;
+    /**
+     * The first pattern that ends in every state.
+     */
+    ZyanU32* patterns;
+    /**
+     * The next pattern that ends in the same state, for every pattern.
+     */
+    ZyanU32* next;
+    /**
+     * The number of patterns that match in every state (including the ones reachable via the
+     * failure links).
+     */
+    ZyanU32* output_counts;
+    /**
+     * The final index of every state.
+     */
+    ZyanU32* remap;
+    /**
+     * The number of states.
+     */
+    ZyanUSize state_count;
+} ZyanStringMatcherBuilder;
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Initializes the character classes of the given matcher.
+ *
+ * @param   matcher     A pointer to the `ZyanStringMatcher` instance.
+ * @param   patterns    A pointer to the array of patterns.
+ * @param   count       The number of patterns.
+ * @param   fold        `0x20` for case-insensitive matchers or `0x00`, if not.
+ * @param   total_size  Receives the total number of characters of all patterns.
+ *
+ * @return  A zyan status code.
+ *
+ * Characters that do not occur in any pattern share class `0`. In case-insensitive mode, both
+ * characters that only differ in bit `0x20` share the same class, which makes case folding free
+ * during the search.
+ */
+static ZyanStatus ZyanStringMatcherInitClasses(ZyanStringMatcher* matcher,
+    const ZyanStringView* patterns, ZyanUSize count, ZyanU8 fold, ZyanUSize* total_size)
+{
+    ZYAN_ASSERT(matcher);
+    ZYAN_ASSERT(total_size);
+
+    ZyanBool used[256];
+    ZYAN_MEMSET(used, 0, sizeof(used));
+
+    ZyanUSize total = 0;
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        const char* data;
+        ZyanUSize size;
+        ZYAN_CHECK(ZyanStringViewGetData(&patterns[i], &data));
+        ZYAN_CHECK(ZyanStringViewGetSize(&patterns[i], &size));
+        if (!size)
+        {
+            return ZYAN_STATUS_INVALID_ARGUMENT;
+        }
+        if (size >= (ZyanU32)-1 - total)
+        {
+            return ZYAN_STATUS_OUT_OF_RANGE;
+        }
+        total += size;
+
+        for (ZyanUSize j = 0; j < size; ++j)
+        {
+            used[(ZyanU8)data[j] | fold] = ZYAN_TRUE;
+        }
+    }
+
+    ZyanBool has_unused = ZYAN_FALSE;
+    for (ZyanUSize c = 0; c < 256; ++c)
+    {
+        has_unused |= !used[c | fold];
+    }
+
+    ZyanU16 folded[256];
+    ZyanU16 next = has_unused ? 1 : 0;
+    for (ZyanUSize c = 0; c < 256; ++c)
+    {
+        folded[c] = 0xFFFF;
+    }
+    for (ZyanUSize c = 0; c < 256; ++c)
+    {
+        const ZyanUSize f = c | fold;
+        if (!used[f])
+        {
+            matcher->classes[c] = 0;
+            continue;
+        }
+        if (folded[f] == 0xFFFF)
+        {
+            folded[f] = next++;
+        }
+        matcher->classes[c] = (ZyanU8)folded[f];
+    }
+
+    matcher->class_count = next;
+    *total_size = total;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Construction                                                                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Inserts all patterns into the trie.
+ *
+ * @param   matcher     A pointer to the `ZyanStringMatcher` instance.
+ * @param   builder     A pointer to the `ZyanStringMatcherBuilder` struct.
+ * @param   patterns    A pointer to the array of patterns.
+ * @param   count       The number of patterns.
+ */
+static void ZyanStringMatcherBuildTrie(const ZyanStringMatcher* matcher,
+    ZyanStringMatcherBuilder* builder, const ZyanStringView* patterns, ZyanUSize count)
+{
+    ZYAN_ASSERT(matcher);
+    ZYAN_ASSERT(builder);
+
+    const ZyanUSize k = matcher->class_count;
+
+    ZYAN_MEMSET(builder->transitions, 0xFF, k * sizeof(ZyanU32));
+    builder->patterns[0] = ZYCORE_STRING_MATCHER_NONE;
+    builder->state_count = 1;
+
+    // Patterns are inserted in reverse order to keep the per-state pattern lists sorted
+    for (ZyanUSize i = count; i-- > 0;)
+    {
+        const ZyanU8* data = (const ZyanU8*)ZYAN_STRING_DATA(&patterns[i].string);
+        const ZyanUSize size = patterns[i].string.vector.size - 1;
+
+        ZyanU32 state = 0;
+        for (ZyanUSize j = 0; j < size; ++j)
+        {
+            ZyanU32* const transition =
+                &builder->transitions[state * k + matcher->classes[data[j]]];
+            if (*transition == ZYCORE_STRING_MATCHER_NONE)
+            {
+                const ZyanU32 target = (ZyanU32)builder->state_count++;
+                ZYAN_MEMSET(&builder->transitions[target * k], 0xFF, k * sizeof(ZyanU32));
+                builder->patterns[target] = ZYCORE_STRING_MATCHER_NONE;
+                *transition = target;
+            }
+            state = *transition;
+        }
+
+        builder->next[i] = builder->patterns[state];
+        builder->patterns[state] = (ZyanU32)i;
+    }
+}
+
+/**
+ * Computes the failure links and turns the trie into a deterministic automaton.
+ *
+ * @param   matcher A pointer to the `ZyanStringMatcher` instance.
+ * @param   builder A pointer to the `ZyanStringMatcherBuilder` struct.
+ *
+ * Missing transitions of a state are copied from its failure state, which is always processed
+ * first, as it has a lower depth.
+ */
+static void ZyanStringMatcherBuildAutomaton(const ZyanStringMatcher* matcher,
+    ZyanStringMatcherBuilder* builder)
+{
+    ZYAN_ASSERT(matcher);
+    ZYAN_ASSERT(builder);
+
+    const ZyanUSize k = matcher->class_count;
+    ZyanU32* const transitions = builder->transitions;
+
+    ZyanUSize tail = 0;
+    builder->order[tail++] = 0;
+    builder->fail[0] = 0;
+    for (ZyanUSize c = 0; c < k; ++c)
+    {
+        const ZyanU32 target = transitions[c];
+        if (target == ZYCORE_STRING_MATCHER_NONE)
+        {
+            transitions[c] = 0;
+            continue;
+        }
+        builder->fail[target] = 0;
+        builder->order[tail++] = target;
+    }
+
+    for (ZyanUSize head = 1; head < tail; ++head)
+    {
+        const ZyanU32 state = builder->order[head];
+        const ZyanU32* const fallback = &transitions[builder->fail[state] * k];
+        ZyanU32* const row = &transitions[state * k];
+        for (ZyanUSize c = 0; c < k; ++c)
+        {
+            if (row[c] == ZYCORE_STRING_MATCHER_NONE)
+            {
+                row[c] = fallback[c];
+                continue;
+            }
+            builder->fail[row[c]] = fallback[c];
+            builder->order[tail++] = row[c];
+        }
+    }
+
+    ZYAN_ASSERT(tail == builder->state_count);
+}
+
+/**
+ * Counts the matching patterns of all states and assigns the final state indices.
+ *
+ * @param   builder         A pointer to the `ZyanStringMatcherBuilder` struct.
+ * @param   match_state     Receives the index of the first state that reports matches.
+ * @param   output_count    Receives the total number of entries of the output table.
+ *
+ * @return  A zyan status code.
+ *
+ * States that report matches are moved to the end, so the search only needs a single comparison
+ * to detect them.
+ */
+static ZyanStatus ZyanStringMatcherAssignStates(ZyanStringMatcherBuilder* builder,
+    ZyanUSize* match_state, ZyanUSize* output_count)
+{
+    ZYAN_ASSERT(builder);
+    ZYAN_ASSERT(match_state);
+    ZYAN_ASSERT(output_count);
+
+    ZyanUSize total = 0;
+    builder->output_counts[0] = 0;
+    for (ZyanUSize i = 1; i < builder->state_count; ++i)
+    {
+        const ZyanU32 state = builder->order[i];
+        ZyanU32 count = builder->output_counts[builder->fail[state]];
+        for (ZyanU32 p = builder->patterns[state]; p != ZYCORE_STRING_MATCHER_NONE;
+            p = builder->next[p])
+        {
+            ++count;
+        }
+        builder->output_counts[state] = count;
+
+        if (count > (ZyanU32)-1 - total)
+        {
+            return ZYAN_STATUS_OUT_OF_RANGE;
+        }
+        total += count;
+    }
+
+    ZyanU32 index = 0;
+    for (ZyanUSize i = 0; i < builder->state_count; ++i)
+    {
+        const ZyanU32 state = builder->order[i];
+        if (!builder->output_counts[state])
+        {
+            builder->remap[state] = index++;
+        }
+    }
+    *match_state = index;
+    for (ZyanUSize i = 0; i < builder->state_count; ++i)
+    {
+        const ZyanU32 state = builder->order[i];
+        if (builder->output_counts[state])
+        {
+            builder->remap[state] = index++;
+        }
+    }
+
+    *output_count = total;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Writes the final tables of the automaton.
+ *
+ * @param   matcher     A pointer to the `ZyanStringMatcher` instance.
+ * @param   builder     A pointer to the `ZyanStringMatcherBuilder` struct.
+ * @param   patterns    A pointer to the array of patterns.
+ * @param   match_state The index of the first state that reports matches.
+ */
+static void ZyanStringMatcherWriteTables(ZyanStringMatcher* matcher,
+    const ZyanStringMatcherBuilder* builder, const ZyanStringView* patterns,
+    ZyanUSize match_state)
+{
+    ZYAN_ASSERT(matcher);
+    ZYAN_ASSERT(builder);
+
+    const ZyanUSize k = matcher->class_count;
+
+    ZyanUSize* const sizes = (ZyanUSize*)matcher->sizes;
+    for (ZyanUSize i = 0; i < matcher->pattern_count; ++i)
+    {
+        sizes[i] = patterns[i].string.vector.size - 1;
+    }
+
+    ZyanU32* const transitions = (ZyanU32*)matcher->transitions;
+    for (ZyanUSize state = 0; state < builder->state_count; ++state)
+    {
+        const ZyanU32* const source = &builder->transitions[state * k];
+        ZyanU32* const destination = &transitions[builder->remap[state] * k];
+        for (ZyanUSize c = 0; c < k; ++c)
+        {
+            destination[c] = builder->remap[source[c]] * (ZyanU32)k;
+        }
+    }
+
+    // The outputs of a state are its own patterns, followed by the patterns of all states along
+    // the failure links. This reports longer matches first
+    ZyanU32* const offsets = (ZyanU32*)matcher->output_offsets;
+    ZyanU32* const outputs = (ZyanU32*)matcher->outputs;
+    ZyanU32 offset = 0;
+    for (ZyanUSize i = 0; i < builder->state_count; ++i)
+    {
+        const ZyanU32 state = builder->order[i];
+        if (!builder->output_counts[state])
+        {
+            continue;
+        }
+        offsets[builder->remap[state] - match_state] = offset;
+        for (ZyanU32 s = state; s; s = builder->fail[s])
+        {
+            for (ZyanU32 p = builder->patterns[s]; p != ZYCORE_STRING_MATCHER_NONE;
+                p = builder->next[p])
+            {
+                outputs[offset++] = p;
+            }
+        }
+    }
+    offsets[builder->state_count - match_state] = offset;
+}
+
+/**
+ * Builds the automaton for the given patterns.
+ *
+ * @param   matcher     A pointer to the `ZyanStringMatcher` instance.
+ * @param   builder     A pointer to the `ZyanStringMatcherBuilder` struct.
+ * @param   patterns    A pointer to the array of patterns.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanStringMatcherBuild(ZyanStringMatcher* matcher,
+    ZyanStringMatcherBuilder* builder, const ZyanStringView* patterns)
+{
+    ZYAN_ASSERT(matcher);
+    ZYAN_ASSERT(builder);
+
+    const ZyanUSize k = matcher->class_count;
+
+    ZyanStringMatcherBuildTrie(matcher, builder, patterns, matcher->pattern_count);
+    ZyanStringMatcherBuildAutomaton(matcher, builder);
+
+    ZyanUSize match_state, output_count;
+    ZYAN_CHECK(ZyanStringMatcherAssignStates(builder, &match_state, &output_count));
+
+    // Transitions store premultiplied state indices
+    const ZyanUSize state_count = builder->state_count;
+    if (state_count > (ZyanU32)-1 / k)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    const ZyanUSize sizes_size = matcher->pattern_count * sizeof(ZyanUSize);
+    const ZyanUSize transitions_size = state_count * k * sizeof(ZyanU32);
+    const ZyanUSize offsets_size = (state_count - match_state + 1) * sizeof(ZyanU32);
+    const ZyanUSize outputs_size = output_count * sizeof(ZyanU32);
+    const ZyanUSize buffer_size = sizes_size + transitions_size + offsets_size + outputs_size;
+
+    ZyanU8* buffer;
+    ZYAN_CHECK(matcher->allocator->allocate(matcher->allocator, (void**)&buffer, 1, buffer_size));
+
+    matcher->buffer         = buffer;
+    matcher->buffer_size    = buffer_size;
+    matcher->state_count    = state_count;
+    matcher->match_state    = (ZyanU32)(match_state * k);
+    matcher->sizes          = (const ZyanUSize*)buffer;
+    matcher->transitions    = (const ZyanU32*)(buffer + sizes_size);
+    matcher->output_offsets = (const ZyanU32*)(buffer + sizes_size + transitions_size);
+    matcher->outputs        = (const ZyanU32*)(buffer + sizes_size + transitions_size +
+        offsets_size);
+
+    ZyanStringMatcherWriteTables(matcher, builder, patterns, match_state);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Matching                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Appends the given match to a `ZyanVector`.
+ *
+ * @param   match       A pointer to the `ZyanStringMatch` struct.
+ * @param   user_data   A pointer to the `ZyanVector` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanStringMatcherPushBack(const ZyanStringMatch* match, void* user_data)
+{
+    return ZyanVectorPushBack((ZyanVector*)user_data, match);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanStringMatcherInit(ZyanStringMatcher* matcher, const ZyanStringView* patterns,
+    ZyanUSize count, ZyanStringMatcherFlags flags)
+{
+    return ZyanStringMatcherInitEx(matcher, patterns, count, flags, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanStringMatcherInitEx(ZyanStringMatcher* matcher, const ZyanStringView* patterns,
+    ZyanUSize count, ZyanStringMatcherFlags flags, ZyanAllocator* allocator)
+{
+    if (!matcher || (!patterns && count) || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (count >= (ZyanU32)-1)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+    ZYAN_ASSERT(allocator->deallocate);
+
+    const ZyanU8 fold = (flags & ZYAN_STRING_MATCHER_CASE_INSENSITIVE) ? 0x20 : 0x00;
+    ZyanUSize total_size;
+    ZYAN_CHECK(ZyanStringMatcherInitClasses(matcher, patterns, count, fold, &total_size));
+
+    matcher->allocator     = allocator;
+    matcher->pattern_count = count;
+
+    // Every character of a pattern adds at most one state
+    const ZyanUSize k = matcher->class_count;
+    const ZyanUSize max_states = total_size + 1;
+    if (max_states > ((ZyanUSize)-1 / sizeof(ZyanU32) - count) / (k + 5))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+    const ZyanUSize temp_count = max_states * (k + 5) + count;
+
+    ZyanU32* temp;
+    ZYAN_CHECK(allocator->allocate(allocator, (void**)&temp, sizeof(ZyanU32), temp_count));
+
+    ZyanStringMatcherBuilder builder;
+    builder.transitions   = temp;
+    builder.fail          = builder.transitions + max_states * k;
+    builder.order         = builder.fail + max_states;
+    builder.patterns      = builder.order + max_states;
+    builder.output_counts = builder.patterns + max_states;
+    builder.remap         = builder.output_counts + max_states;
+    builder.next          = builder.remap + max_states;
+    builder.state_count   = 0;
+
+    const ZyanStatus status = ZyanStringMatcherBuild(matcher, &builder, patterns);
+    ZYAN_CHECK(allocator->deallocate(allocator, temp, sizeof(ZyanU32), temp_count));
+
+    return status;
+}
+
+ZyanStatus ZyanStringMatcherDestroy(ZyanStringMatcher* matcher)
+{
+    if (!matcher)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(matcher->allocator->deallocate(matcher->allocator, matcher->buffer, 1,
+        matcher->buffer_size));
+    matcher->buffer = ZYAN_NULL;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Matching                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanStringMatcherFind(const ZyanStringMatcher* matcher, const ZyanStringView* haystack,
+    ZyanStringMatcherCallback callback, void* user_data)
+{
+    if (!matcher || !haystack || !callback)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const char* data;
+    ZyanUSize size;
+    ZYAN_CHECK(ZyanStringViewGetData(haystack, &data));
+    ZYAN_CHECK(ZyanStringViewGetSize(haystack, &size));
+
+    const ZyanU8* const characters = (const ZyanU8*)data;
+    const ZyanU8* const classes = matcher->classes;
+    const ZyanU32* const transitions = matcher->transitions;
+    const ZyanU32 match_state = matcher->match_state;
+
+    ZyanU32 state = 0;
+    for (ZyanUSize i = 0; i < size; ++i)
+    {
+        state = transitions[state + classes[characters[i]]];
+        if (state < match_state)
+        {
+            continue;
+        }
+
+        const ZyanUSize index = (state - match_state) / matcher->class_count;
+        const ZyanU32 end = matcher->output_offsets[index + 1];
+        for (ZyanU32 j = matcher->output_offsets[index]; j < end; ++j)
+        {
+            ZyanStringMatch match;
+            match.pattern = matcher->outputs[j];
+            match.size    = matcher->sizes[match.pattern];
+            match.index   = i + 1 - match.size;
+
+            const ZyanStatus status = callback(&match, user_data);
+            if (status == ZYAN_STATUS_FALSE)
+            {
+                return ZYAN_STATUS_SUCCESS;
+            }
+            ZYAN_CHECK(status);
+        }
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanStringMatcherFindAll(const ZyanStringMatcher* matcher,
+    const ZyanStringView* haystack, ZyanVector* matches)
+{
+    if (!matches || (matches->element_size != sizeof(ZyanStringMatch)))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanStringMatcherFind(matcher, haystack, &ZyanStringMatcherPushBack, matches);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanStringMatcherGetStateCount(const ZyanStringMatcher* matcher, ZyanUSize* count)
+{
+    if (!matcher || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *count = matcher->state_count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanStringMatcherGetClassCount(const ZyanStringMatcher* matcher, ZyanUSize* count)
+{
+    if (!matcher || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *count = matcher->class_count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
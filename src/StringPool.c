@@ -0,0 +1,500 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/Hash.h>
+#include <Zycore/LibC.h>
+#include <Zycore/StringPool.h>
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+#ifndef ZYAN_NO_LIBC
+#   define ZYCORE_STRING_POOL_ENTER_SHARED(pool) \
+        ZyanReadWriteLockEnterShared(&(pool)->lock)
+#   define ZYCORE_STRING_POOL_LEAVE_SHARED(pool) \
+        ZyanReadWriteLockLeaveShared(&(pool)->lock)
+#   define ZYCORE_STRING_POOL_ENTER_EXCLUSIVE(pool) \
+        ZyanReadWriteLockEnterExclusive(&(pool)->lock)
+#   define ZYCORE_STRING_POOL_LEAVE_EXCLUSIVE(pool) \
+        ZyanReadWriteLockLeaveExclusive(&(pool)->lock)
+#else
+    // Builds without libc have no threading support
+#   define ZYCORE_STRING_POOL_ENTER_SHARED(pool)    ZYAN_STATUS_SUCCESS
+#   define ZYCORE_STRING_POOL_LEAVE_SHARED(pool)    ZYAN_STATUS_SUCCESS
+#   define ZYCORE_STRING_POOL_ENTER_EXCLUSIVE(pool) ZYAN_STATUS_SUCCESS
+#   define ZYCORE_STRING_POOL_LEAVE_EXCLUSIVE(pool) ZYAN_STATUS_SUCCESS
+#endif
+
+/* ============================================================================================== */
+/* Internal types                                                                                 */
+/* ============================================================================================== */
+
+/**
+ * Defines the `ZyanStringPoolEntry` struct.
+ *
+ * Describes an interned string. Used as element of the `strings` vector and as key of the
+ * `index` hash map.
+ */
+typedef struct ZyanStringPoolEntry_
+{
+    /**
+     * A pointer to the characters of the string.
+     */
+    const char* data;
+    /**
+     * The length of the string.
+     */
+    ZyanUSize size;
+    /**
+     * The hash value of the string.
+     */
+    ZyanU64 hash;
+} ZyanStringPoolEntry;
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Hash map callbacks                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the hash value of the given `ZyanStringPoolEntry`.
+ *
+ * @param   key A pointer to the `ZyanStringPoolEntry` struct.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 ZyanStringPoolEntryHash(const void* key)
+{
+    return ((const ZyanStringPoolEntry*)key)->hash;
+}
+
+/**
+ * Checks, if the given `ZyanStringPoolEntry` structs describe equal strings.
+ *
+ * @param   left    A pointer to the first `ZyanStringPoolEntry` struct.
+ * @param   right   A pointer to the second `ZyanStringPoolEntry` struct.
+ *
+ * @return  `ZYAN_TRUE`, if the strings are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanStringPoolEntryEquals(const void* left, const void* right)
+{
+    const ZyanStringPoolEntry* const a = (const ZyanStringPoolEntry*)left;
+    const ZyanStringPoolEntry* const b = (const ZyanStringPoolEntry*)right;
+
+    return (a->hash == b->hash) && (a->size == b->size) &&
+        !ZYAN_MEMCMP(a->data, b->data, a->size);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Allocates a new block and adds it to the list of blocks.
+ *
+ * @param   pool        A pointer to the `ZyanStringPool` instance.
+ * @param   capacity    The usable size of the block in bytes.
+ * @param   block       Receives a pointer to the new block.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanStringPoolAllocateBlock(ZyanStringPool* pool, ZyanUSize capacity,
+    ZyanStringPoolBlock** block)
+{
+    ZYAN_ASSERT(pool);
+    ZYAN_ASSERT(block);
+
+    if (capacity > (ZyanUSize)-1 - sizeof(ZyanStringPoolBlock))
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    void* memory;
+    ZYAN_CHECK(pool->allocator->allocate(pool->allocator, &memory, 1,
+        sizeof(ZyanStringPoolBlock) + capacity));
+
+    *block = (ZyanStringPoolBlock*)memory;
+    (*block)->next = pool->blocks;
+    (*block)->capacity = capacity;
+    pool->blocks = *block;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Copies the characters of a string into the pool.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ * @param   data    A pointer to the characters of the string.
+ * @param   size    The length of the string.
+ * @param   copy    Receives a pointer to the zero terminated copy.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanStringPoolStore(ZyanStringPool* pool, const char* data, ZyanUSize size,
+    const char** copy)
+{
+    ZYAN_ASSERT(pool);
+    ZYAN_ASSERT(copy);
+
+    if (size == (ZyanUSize)-1)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    ZyanU8* destination;
+    const ZyanUSize required = size + 1;
+    if (required <= (ZyanUSize)(pool->end - pool->cursor))
+    {
+        destination = pool->cursor;
+        pool->cursor += required;
+    } else
+    {
+        ZyanStringPoolBlock* block;
+        if (required > pool->block_size / 4)
+        {
+            // Large strings get a dedicated block, so the remainder of the current block is not
+            // wasted
+            ZYAN_CHECK(ZyanStringPoolAllocateBlock(pool, required, &block));
+            destination = (ZyanU8*)(block + 1);
+        } else
+        {
+            ZYAN_CHECK(ZyanStringPoolAllocateBlock(pool, pool->block_size, &block));
+            destination = (ZyanU8*)(block + 1);
+            pool->cursor = destination + required;
+            pool->end = destination + pool->block_size;
+        }
+    }
+
+    if (size)
+    {
+        ZYAN_MEMCPY(destination, data, size);
+    }
+    destination[size] = '\0';
+    *copy = (const char*)destination;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Adds a new string to the pool.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ * @param   entry   A pointer to the `ZyanStringPoolEntry` struct that describes the string.
+ * @param   id      Receives the ID of the string.
+ *
+ * @return  A zyan status code.
+ *
+ * The caller has to hold the lock in exclusive mode.
+ */
+static ZyanStatus ZyanStringPoolAdd(ZyanStringPool* pool, const ZyanStringPoolEntry* entry,
+    ZyanU32* id)
+{
+    ZYAN_ASSERT(pool);
+    ZYAN_ASSERT(entry);
+    ZYAN_ASSERT(id);
+
+    if (pool->strings.size > (ZyanU32)-1)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZyanStringPoolEntry copy = *entry;
+    ZYAN_CHECK(ZyanStringPoolStore(pool, entry->data, entry->size, &copy.data));
+
+    const ZyanU32 value = (ZyanU32)pool->strings.size;
+    ZYAN_CHECK(ZyanVectorPushBack(&pool->strings, &copy));
+
+    const ZyanStatus status = ZyanHashMapInsert(&pool->index, &copy, &value);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZYAN_CHECK(ZyanVectorPopBack(&pool->strings));
+        return status;
+    }
+
+    *id = value;
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Returns the ID of the given string and adds it to the pool, if it is not interned yet.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ * @param   data    A pointer to the characters of the string.
+ * @param   size    The length of the string.
+ * @param   id      Receives the ID of the string.
+ *
+ * @return  `ZYAN_STATUS_TRUE` if the string was added to the pool, `ZYAN_STATUS_FALSE` if it was
+ *          already interned, or another zyan status code, if an error occurred.
+ */
+static ZyanStatus ZyanStringPoolInternInternal(ZyanStringPool* pool, const char* data,
+    ZyanUSize size, ZyanU32* id)
+{
+    ZYAN_ASSERT(pool);
+    ZYAN_ASSERT(id);
+
+    ZyanStringPoolEntry entry;
+    entry.data = data;
+    entry.size = size;
+    entry.hash = ZyanHash(data, size, 0);
+
+    // Most strings are already interned, which only requires the shared lock
+    const void* value;
+    ZYAN_CHECK(ZYCORE_STRING_POOL_ENTER_SHARED(pool));
+    ZyanStatus status = ZyanHashMapFind(&pool->index, &entry, &value);
+    if (status == ZYAN_STATUS_TRUE)
+    {
+        *id = *(const ZyanU32*)value;
+    }
+    ZYAN_CHECK(ZYCORE_STRING_POOL_LEAVE_SHARED(pool));
+    if (status != ZYAN_STATUS_FALSE)
+    {
+        return (status == ZYAN_STATUS_TRUE) ? ZYAN_STATUS_FALSE : status;
+    }
+
+    // Another thread might have added the string in the meantime
+    ZYAN_CHECK(ZYCORE_STRING_POOL_ENTER_EXCLUSIVE(pool));
+    status = ZyanHashMapFind(&pool->index, &entry, &value);
+    if (status == ZYAN_STATUS_TRUE)
+    {
+        *id = *(const ZyanU32*)value;
+        status = ZYAN_STATUS_FALSE;
+    } else
+    {
+        if (status == ZYAN_STATUS_FALSE)
+        {
+            status = ZyanStringPoolAdd(pool, &entry, id);
+            if (ZYAN_SUCCESS(status))
+            {
+                status = ZYAN_STATUS_TRUE;
+            }
+        }
+    }
+    ZYAN_CHECK(ZYCORE_STRING_POOL_LEAVE_EXCLUSIVE(pool));
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanStringPoolInit(ZyanStringPool* pool, ZyanUSize block_size)
+{
+    return ZyanStringPoolInitEx(pool, block_size, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanStringPoolInitEx(ZyanStringPool* pool, ZyanUSize block_size,
+    ZyanAllocator* allocator)
+{
+    if (!pool || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(allocator->allocate);
+    ZYAN_ASSERT(allocator->deallocate);
+
+    pool->allocator  = allocator;
+    pool->block_size = block_size ? block_size : ZYAN_STRING_POOL_DEFAULT_BLOCK_SIZE;
+    pool->blocks     = ZYAN_NULL;
+    pool->cursor     = ZYAN_NULL;
+    pool->end        = ZYAN_NULL;
+
+    ZYAN_CHECK(ZyanVectorInitEx(&pool->strings, sizeof(ZyanStringPoolEntry), 0, ZYAN_NULL,
+        allocator, ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD));
+
+    ZyanStatus status = ZyanHashMapInitEx(&pool->index, sizeof(ZyanStringPoolEntry),
+        sizeof(ZyanU32), 0, &ZyanStringPoolEntryHash, &ZyanStringPoolEntryEquals, ZYAN_NULL,
+        allocator);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanVectorDestroy(&pool->strings);
+        return status;
+    }
+
+#ifndef ZYAN_NO_LIBC
+    status = ZyanReadWriteLockInitialize(&pool->lock);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanHashMapDestroy(&pool->index);
+        ZyanVectorDestroy(&pool->strings);
+        return status;
+    }
+#endif
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanStringPoolDestroy(ZyanStringPool* pool)
+{
+    if (!pool)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanHashMapDestroy(&pool->index));
+    ZYAN_CHECK(ZyanVectorDestroy(&pool->strings));
+
+    ZyanStringPoolBlock* block = pool->blocks;
+    while (block)
+    {
+        ZyanStringPoolBlock* const next = block->next;
+        ZYAN_CHECK(pool->allocator->deallocate(pool->allocator, block, 1,
+            sizeof(ZyanStringPoolBlock) + block->capacity));
+        block = next;
+    }
+    pool->blocks = ZYAN_NULL;
+    pool->cursor = ZYAN_NULL;
+    pool->end    = ZYAN_NULL;
+
+#ifndef ZYAN_NO_LIBC
+    ZYAN_CHECK(ZyanReadWriteLockDelete(&pool->lock));
+#endif
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Interning                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanStringPoolIntern(ZyanStringPool* pool, const ZyanStringView* string, ZyanU32* id)
+{
+    if (!pool || !string || !id)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const char* data;
+    ZyanUSize size;
+    ZYAN_CHECK(ZyanStringGetData(&string->string, &data));
+    ZYAN_CHECK(ZyanStringGetSize(&string->string, &size));
+
+    return ZyanStringPoolInternInternal(pool, data, size, id);
+}
+
+ZyanStatus ZyanStringPoolInternBuffer(ZyanStringPool* pool, const char* data, ZyanUSize size,
+    ZyanU32* id)
+{
+    if (!pool || (!data && size) || !id)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanStringPoolInternInternal(pool, data ? data : "", size, id);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Lookup                                                                                         */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanStringPoolFind(ZyanStringPool* pool, const ZyanStringView* string, ZyanU32* id)
+{
+    if (!pool || !string)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanStringPoolEntry entry;
+    ZYAN_CHECK(ZyanStringGetData(&string->string, &entry.data));
+    ZYAN_CHECK(ZyanStringGetSize(&string->string, &entry.size));
+    entry.hash = ZyanHash(entry.data, entry.size, 0);
+
+    const void* value;
+    ZYAN_CHECK(ZYCORE_STRING_POOL_ENTER_SHARED(pool));
+    const ZyanStatus status = ZyanHashMapFind(&pool->index, &entry, &value);
+    if ((status == ZYAN_STATUS_TRUE) && id)
+    {
+        *id = *(const ZyanU32*)value;
+    }
+    ZYAN_CHECK(ZYCORE_STRING_POOL_LEAVE_SHARED(pool));
+
+    return status;
+}
+
+ZyanStatus ZyanStringPoolGetView(ZyanStringPool* pool, ZyanU32 id, ZyanStringView* view)
+{
+    if (!pool || !view)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanStringPoolEntry entry;
+    ZYAN_CHECK(ZYCORE_STRING_POOL_ENTER_SHARED(pool));
+    const ZyanStringPoolEntry* const element =
+        (const ZyanStringPoolEntry*)ZyanVectorGet(&pool->strings, id);
+    if (element)
+    {
+        entry = *element;
+    }
+    ZYAN_CHECK(ZYCORE_STRING_POOL_LEAVE_SHARED(pool));
+
+    if (!element)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    // The characters are zero terminated, which allows viewing empty strings as well
+    return entry.size ? ZyanStringViewInsideBufferEx(view, entry.data, entry.size) :
+        ZyanStringViewInsideBuffer(view, entry.data);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanStringPoolGetSize(ZyanStringPool* pool, ZyanUSize* size)
+{
+    if (!pool || !size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZYCORE_STRING_POOL_ENTER_SHARED(pool));
+    *size = pool->strings.size;
+    ZYAN_CHECK(ZYCORE_STRING_POOL_LEAVE_SHARED(pool));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
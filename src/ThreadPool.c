@@ -0,0 +1,345 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/ThreadPool.h>
+
+#ifndef ZYAN_NO_LIBC
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Executes tasks of the current batch until no unclaimed tasks are left.
+ *
+ * @param   pool    A pointer to the `ZyanThreadPool` instance.
+ *
+ * The calling thread must have entered `pool->lock`. The lock is temporarily left while a task is
+ * executed.
+ */
+static void ZyanThreadPoolExecuteTasks(ZyanThreadPool* pool)
+{
+    while (pool->next_task < pool->task_count)
+    {
+        const ZyanThreadPoolTask task = pool->task;
+        void* const context = pool->context;
+        const ZyanUSize index = pool->next_task++;
+
+        ZyanCriticalSectionLeave(&pool->lock);
+        const ZyanStatus status = task(context, index);
+        ZyanCriticalSectionEnter(&pool->lock);
+
+        if (!ZYAN_SUCCESS(status) && ZYAN_SUCCESS(pool->status))
+        {
+            pool->status = status;
+        }
+        if (!--pool->pending_tasks)
+        {
+            ZyanConditionVariableWakeAll(&pool->work_done);
+        }
+    }
+}
+
+/**
+ * The procedure of the worker threads.
+ *
+ * @param   argument    A pointer to the `ZyanThreadPool` instance.
+ */
+static void ZyanThreadPoolWorker(void* argument)
+{
+    ZyanThreadPool* const pool = (ZyanThreadPool*)argument;
+
+    ZyanCriticalSectionEnter(&pool->lock);
+    for (;;)
+    {
+        while (!pool->shutdown && (pool->next_task >= pool->task_count))
+        {
+            ZyanConditionVariableWait(&pool->work_available, &pool->lock);
+        }
+        if (pool->shutdown)
+        {
+            break;
+        }
+        ZyanThreadPoolExecuteTasks(pool);
+    }
+    ZyanCriticalSectionLeave(&pool->lock);
+}
+
+/**
+ * Signals all worker threads to exit and waits for them to finish.
+ *
+ * @param   pool    A pointer to the `ZyanThreadPool` instance.
+ * @param   count   The number of worker threads that were started.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanThreadPoolJoinWorkers(ZyanThreadPool* pool, ZyanUSize count)
+{
+    ZYAN_CHECK(ZyanCriticalSectionEnter(&pool->lock));
+    pool->shutdown = ZYAN_TRUE;
+    ZYAN_CHECK(ZyanConditionVariableWakeAll(&pool->work_available));
+    ZYAN_CHECK(ZyanCriticalSectionLeave(&pool->lock));
+
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZYAN_CHECK(ZyanThreadJoin(pool->threads[i]));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Releases the synchronization primitives of the given pool.
+ *
+ * @param   pool    A pointer to the `ZyanThreadPool` instance.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanThreadPoolDeleteSynchronization(ZyanThreadPool* pool)
+{
+    ZYAN_CHECK(ZyanConditionVariableDelete(&pool->work_done));
+    ZYAN_CHECK(ZyanConditionVariableDelete(&pool->work_available));
+    ZYAN_CHECK(ZyanCriticalSectionDelete(&pool->lock));
+    ZYAN_CHECK(ZyanCriticalSectionDelete(&pool->run_lock));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor and destructor                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanThreadPoolInit(ZyanThreadPool* pool, ZyanUSize thread_count)
+{
+    return ZyanThreadPoolInitEx(pool, thread_count, ZyanAllocatorDefault());
+}
+
+ZyanStatus ZyanThreadPoolInitEx(ZyanThreadPool* pool, ZyanUSize thread_count,
+    ZyanAllocator* allocator)
+{
+    if (!pool || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!thread_count)
+    {
+        ZYAN_CHECK(ZyanThreadGetProcessorCount(&thread_count));
+        --thread_count;
+    }
+
+    pool->allocator      = allocator;
+    pool->threads        = ZYAN_NULL;
+    pool->thread_count   = 0;
+    pool->task           = ZYAN_NULL;
+    pool->context        = ZYAN_NULL;
+    pool->task_count     = 0;
+    pool->next_task      = 0;
+    pool->pending_tasks  = 0;
+    pool->status         = ZYAN_STATUS_SUCCESS;
+    pool->shutdown       = ZYAN_FALSE;
+
+    ZYAN_CHECK(ZyanCriticalSectionInitialize(&pool->run_lock));
+    ZyanStatus status = ZyanCriticalSectionInitialize(&pool->lock);
+    if (!ZYAN_SUCCESS(status))
+    {
+        goto failure_lock;
+    }
+    status = ZyanConditionVariableInitialize(&pool->work_available);
+    if (!ZYAN_SUCCESS(status))
+    {
+        goto failure_work_available;
+    }
+    status = ZyanConditionVariableInitialize(&pool->work_done);
+    if (!ZYAN_SUCCESS(status))
+    {
+        goto failure_work_done;
+    }
+
+    if (!thread_count)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    status = allocator->allocate(allocator, (void**)&pool->threads,
+        sizeof(ZyanThread), thread_count);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanThreadPoolDeleteSynchronization(pool);
+        return status;
+    }
+
+    for (ZyanUSize i = 0; i < thread_count; ++i)
+    {
+        status = ZyanThreadCreate(&pool->threads[i], &ZyanThreadPoolWorker, pool);
+        if (!ZYAN_SUCCESS(status))
+        {
+            ZyanThreadPoolJoinWorkers(pool, i);
+            ZyanThreadPoolDeleteSynchronization(pool);
+            allocator->deallocate(allocator, pool->threads, sizeof(ZyanThread), thread_count);
+            pool->threads = ZYAN_NULL;
+            return status;
+        }
+    }
+    pool->thread_count = thread_count;
+
+    return ZYAN_STATUS_SUCCESS;
+
+failure_work_done:
+    ZyanConditionVariableDelete(&pool->work_available);
+failure_work_available:
+    ZyanCriticalSectionDelete(&pool->lock);
+failure_lock:
+    ZyanCriticalSectionDelete(&pool->run_lock);
+
+    return status;
+}
+
+ZyanStatus ZyanThreadPoolDestroy(ZyanThreadPool* pool)
+{
+    if (!pool)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanThreadPoolJoinWorkers(pool, pool->thread_count));
+    ZYAN_CHECK(ZyanThreadPoolDeleteSynchronization(pool));
+
+    if (pool->threads)
+    {
+        ZYAN_CHECK(pool->allocator->deallocate(pool->allocator, pool->threads,
+            sizeof(ZyanThread), pool->thread_count));
+        pool->threads = ZYAN_NULL;
+    }
+    pool->thread_count = 0;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Execution                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanThreadPoolRun(ZyanThreadPool* pool, ZyanThreadPoolTask task, void* context,
+    ZyanUSize task_count)
+{
+    if (!pool || !task)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!task_count)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_CHECK(ZyanCriticalSectionEnter(&pool->run_lock));
+    ZyanStatus status = ZyanCriticalSectionEnter(&pool->lock);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanCriticalSectionLeave(&pool->run_lock);
+        return status;
+    }
+
+    pool->task          = task;
+    pool->context       = context;
+    pool->task_count    = task_count;
+    pool->next_task     = 0;
+    pool->pending_tasks = task_count;
+    pool->status        = ZYAN_STATUS_SUCCESS;
+    if (pool->thread_count)
+    {
+        // If the workers can not be woken up, the calling thread executes all tasks on its own
+        status = ZyanConditionVariableWakeAll(&pool->work_available);
+    }
+
+    // The calling thread participates instead of idling until the workers are done
+    ZyanThreadPoolExecuteTasks(pool);
+    ZyanStatus wait_status = ZYAN_STATUS_SUCCESS;
+    while (pool->pending_tasks)
+    {
+        if (ZYAN_SUCCESS(wait_status))
+        {
+            wait_status = ZyanConditionVariableWait(&pool->work_done, &pool->lock);
+            continue;
+        }
+
+        // The workers might still use the `context`, which often lives on the stack of the
+        // caller. Poll until they are done instead, giving them a chance to enter the lock
+        ZyanCriticalSectionLeave(&pool->lock);
+        ZyanCriticalSectionEnter(&pool->lock);
+    }
+    if (ZYAN_SUCCESS(status))
+    {
+        status = ZYAN_SUCCESS(wait_status) ? pool->status : wait_status;
+    }
+    pool->task          = ZYAN_NULL;
+    pool->context       = ZYAN_NULL;
+    pool->task_count    = 0;
+    pool->next_task     = 0;
+
+    // Both locks are always released, even if an error occurred above
+    const ZyanStatus leave_status = ZyanCriticalSectionLeave(&pool->lock);
+    const ZyanStatus leave_run_status = ZyanCriticalSectionLeave(&pool->run_lock);
+    if (ZYAN_SUCCESS(status))
+    {
+        status = ZYAN_SUCCESS(leave_status) ? leave_run_status : leave_status;
+    }
+
+    return status;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Information                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanThreadPoolGetThreadCount(const ZyanThreadPool* pool, ZyanUSize* thread_count)
+{
+    if (!pool || !thread_count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    *thread_count = pool->thread_count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+
+#endif /* ZYAN_NO_LIBC */
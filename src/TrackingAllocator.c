@@ -0,0 +1,435 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+#include <Zycore/LibC.h>
+#include <Zycore/TrackingAllocator.h>
+
+#if defined(ZYAN_MSVC)
+#   include <intrin.h>
+#endif
+
+/* ============================================================================================== */
+/* Internal macros                                                                                */
+/* ============================================================================================== */
+
+/**
+ * Returns a pointer to the header of the given memory `block`.
+ *
+ * @param   block   A pointer to a memory block obtained from the tracking allocator.
+ *
+ * @return  A pointer to the header of the given memory `block`.
+ */
+#define ZYCORE_TRACKING_BLOCK_HEADER(block) \
+    ((ZyanU8*)(block) - ZYAN_TRACKING_HEADER_SIZE)
+
+/**
+ * Returns a reference to the size field of the memory block with the given `header`.
+ *
+ * @param   header  A pointer to the header of a memory block.
+ *
+ * @return  A reference to the size field of the memory block.
+ */
+#define ZYCORE_TRACKING_BLOCK_SIZE(header) \
+    (*(ZyanUSize*)(header))
+
+/* ============================================================================================== */
+/* Internal functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Atomic operations                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Atomically loads the given `value`.
+ *
+ * @param   value   A pointer to the value.
+ *
+ * @return  The current value.
+ */
+static ZyanU64 ZyanTrackingAtomicLoad(const ZyanU64* value)
+{
+#if defined(ZYAN_GNUC)
+    return __atomic_load_n(value, __ATOMIC_RELAXED);
+#elif defined(ZYAN_MSVC)
+    return (ZyanU64)_InterlockedCompareExchange64((volatile __int64*)value, 0, 0);
+#else
+    return *value;
+#endif
+}
+
+/**
+ * Atomically replaces the given `value` with `desired`, if it is equal to `expected`.
+ *
+ * @param   value       A pointer to the value.
+ * @param   expected    A pointer to the expected value. Receives the current value on failure.
+ * @param   desired     The desired value.
+ *
+ * @return  `ZYAN_TRUE`, if the value was replaced or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanTrackingAtomicCompareExchange(ZyanU64* value, ZyanU64* expected,
+    ZyanU64 desired)
+{
+#if defined(ZYAN_GNUC)
+    return __atomic_compare_exchange_n(value, expected, desired, 1, __ATOMIC_RELAXED,
+        __ATOMIC_RELAXED) ? ZYAN_TRUE : ZYAN_FALSE;
+#elif defined(ZYAN_MSVC)
+    const ZyanU64 previous = (ZyanU64)_InterlockedCompareExchange64((volatile __int64*)value,
+        (__int64)desired, (__int64)*expected);
+    if (previous == *expected)
+    {
+        return ZYAN_TRUE;
+    }
+    *expected = previous;
+    return ZYAN_FALSE;
+#else
+    if (*value == *expected)
+    {
+        *value = desired;
+        return ZYAN_TRUE;
+    }
+    *expected = *value;
+    return ZYAN_FALSE;
+#endif
+}
+
+/**
+ * Atomically adds `addend` to the given `value`.
+ *
+ * @param   value   A pointer to the value.
+ * @param   addend  The addend. Subtraction is performed by passing the two's complement.
+ *
+ * @return  The new value.
+ */
+static ZyanU64 ZyanTrackingAtomicAdd(ZyanU64* value, ZyanU64 addend)
+{
+#if defined(ZYAN_GNUC)
+    return __atomic_add_fetch(value, addend, __ATOMIC_RELAXED);
+#else
+    ZyanU64 current = ZyanTrackingAtomicLoad(value);
+    while (!ZyanTrackingAtomicCompareExchange(value, &current, current + addend))
+    {
+        // Retry with the updated value
+    }
+    return current + addend;
+#endif
+}
+
+/**
+ * Atomically stores `desired` to the given `value`.
+ *
+ * @param   value   A pointer to the value.
+ * @param   desired The desired value.
+ */
+static void ZyanTrackingAtomicStore(ZyanU64* value, ZyanU64 desired)
+{
+#if defined(ZYAN_GNUC)
+    __atomic_store_n(value, desired, __ATOMIC_RELAXED);
+#else
+    ZyanU64 current = ZyanTrackingAtomicLoad(value);
+    while (!ZyanTrackingAtomicCompareExchange(value, &current, desired))
+    {
+        // Retry with the updated value
+    }
+#endif
+}
+
+/**
+ * Atomically replaces the given `value` with `candidate`, if `candidate` is greater.
+ *
+ * @param   value       A pointer to the value.
+ * @param   candidate   The candidate value.
+ */
+static void ZyanTrackingAtomicMax(ZyanU64* value, ZyanU64 candidate)
+{
+    ZyanU64 current = ZyanTrackingAtomicLoad(value);
+    while ((current < candidate) &&
+           !ZyanTrackingAtomicCompareExchange(value, &current, candidate))
+    {
+        // Retry with the updated value
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Helper functions                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Returns the histogram bucket for a request of the given `size`.
+ *
+ * @param   size    The size of the request in bytes.
+ *
+ * @return  The index of the histogram bucket.
+ */
+static ZyanUSize ZyanTrackingGetBucket(ZyanUSize size)
+{
+    if (!size)
+    {
+        return 0;
+    }
+
+#if defined(ZYAN_GNUC)
+    const ZyanUSize bucket = 64 - __builtin_clzll((unsigned long long)size);
+#else
+    ZyanUSize bucket = 0;
+    while (size)
+    {
+        size >>= 1;
+        ++bucket;
+    }
+#endif
+
+    return ZYAN_MIN(bucket, ZYAN_TRACKING_HISTOGRAM_SIZE - 1);
+}
+
+/**
+ * Updates the request statistics.
+ *
+ * @param   statistics  A pointer to the `ZyanTrackingStatistics` struct.
+ * @param   size        The size of the request in bytes.
+ */
+static void ZyanTrackingRecordRequest(ZyanTrackingStatistics* statistics, ZyanUSize size)
+{
+    ZYAN_ASSERT(statistics);
+
+    ZyanTrackingAtomicAdd(&statistics->bytes_requested, size);
+    ZyanTrackingAtomicAdd(&statistics->histogram[ZyanTrackingGetBucket(size)], 1);
+}
+
+/**
+ * Updates the number of live bytes and the peak value.
+ *
+ * @param   statistics  A pointer to the `ZyanTrackingStatistics` struct.
+ * @param   old_size    The old size of the memory block or `0`, if the block was allocated.
+ * @param   new_size    The new size of the memory block or `0`, if the block was released.
+ */
+static void ZyanTrackingRecordLive(ZyanTrackingStatistics* statistics, ZyanUSize old_size,
+    ZyanUSize new_size)
+{
+    ZYAN_ASSERT(statistics);
+
+    const ZyanU64 live = ZyanTrackingAtomicAdd(&statistics->bytes_live,
+        (ZyanU64)new_size - (ZyanU64)old_size);
+    if (new_size > old_size)
+    {
+        ZyanTrackingAtomicMax(&statistics->bytes_peak, live);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Allocator interface                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+static ZyanStatus ZyanTrackingAllocatorAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanTrackingAllocator* const tracking = (ZyanTrackingAllocator*)allocator;
+
+    if (n > ((ZyanUSize)-1 - ZYAN_TRACKING_HEADER_SIZE) / element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    const ZyanUSize size = element_size * n;
+
+    void* header;
+    ZYAN_CHECK(tracking->backing->allocate(tracking->backing, &header, 1,
+        ZYAN_TRACKING_HEADER_SIZE + size));
+    ZYCORE_TRACKING_BLOCK_SIZE(header) = size;
+
+    *p = (ZyanU8*)header + ZYAN_TRACKING_HEADER_SIZE;
+
+    ZyanTrackingAtomicAdd(&tracking->statistics.allocation_count, 1);
+    ZyanTrackingRecordRequest(&tracking->statistics, size);
+    ZyanTrackingRecordLive(&tracking->statistics, 0, size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanTrackingAllocatorReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(*p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZyanTrackingAllocator* const tracking = (ZyanTrackingAllocator*)allocator;
+
+    if (n > ((ZyanUSize)-1 - ZYAN_TRACKING_HEADER_SIZE) / element_size)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    const ZyanUSize size = element_size * n;
+
+    void* header = ZYCORE_TRACKING_BLOCK_HEADER(*p);
+    const ZyanUPointer old_address = (ZyanUPointer)header;
+    const ZyanUSize old_size = ZYCORE_TRACKING_BLOCK_SIZE(header);
+
+    ZYAN_CHECK(tracking->backing->reallocate(tracking->backing, &header, 1,
+        ZYAN_TRACKING_HEADER_SIZE + size));
+    ZYCORE_TRACKING_BLOCK_SIZE(header) = size;
+
+    *p = (ZyanU8*)header + ZYAN_TRACKING_HEADER_SIZE;
+
+    ZyanTrackingAtomicAdd(&tracking->statistics.reallocation_count, 1);
+    if ((ZyanUPointer)header != old_address)
+    {
+        ZyanTrackingAtomicAdd(&tracking->statistics.reallocation_move_count, 1);
+        ZyanTrackingAtomicAdd(&tracking->statistics.bytes_copied, ZYAN_MIN(old_size, size));
+    }
+    ZyanTrackingRecordRequest(&tracking->statistics, size);
+    ZyanTrackingRecordLive(&tracking->statistics, old_size, size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+static ZyanStatus ZyanTrackingAllocatorDeallocate(ZyanAllocator* allocator, void* p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    ZYAN_ASSERT(allocator);
+    ZYAN_ASSERT(p);
+    ZYAN_ASSERT(element_size);
+    ZYAN_ASSERT(n);
+
+    ZYAN_UNUSED(element_size);
+    ZYAN_UNUSED(n);
+
+    ZyanTrackingAllocator* const tracking = (ZyanTrackingAllocator*)allocator;
+
+    // Use the size stored in the header to keep `bytes_live` consistent, even if the caller
+    // passes a different element count
+    void* const header = ZYCORE_TRACKING_BLOCK_HEADER(p);
+    const ZyanUSize size = ZYCORE_TRACKING_BLOCK_SIZE(header);
+
+    ZYAN_CHECK(tracking->backing->deallocate(tracking->backing, header, 1,
+        ZYAN_TRACKING_HEADER_SIZE + size));
+
+    ZyanTrackingAtomicAdd(&tracking->statistics.deallocation_count, 1);
+    ZyanTrackingRecordLive(&tracking->statistics, size, 0);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Exported functions                                                                             */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Constructor                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZYAN_REQUIRES_LIBC ZyanStatus ZyanTrackingInit(ZyanTrackingAllocator* tracking)
+{
+    return ZyanTrackingInitEx(tracking, ZyanAllocatorDefault());
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanTrackingInitEx(ZyanTrackingAllocator* tracking, ZyanAllocator* allocator)
+{
+    if (!tracking || !allocator)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_CHECK(ZyanAllocatorInit(&tracking->allocator, &ZyanTrackingAllocatorAllocate,
+        &ZyanTrackingAllocatorReallocate, &ZyanTrackingAllocatorDeallocate));
+
+    tracking->backing = allocator;
+    ZYAN_MEMSET(&tracking->statistics, 0, sizeof(tracking->statistics));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Statistics                                                                                     */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanTrackingGetStatistics(const ZyanTrackingAllocator* tracking,
+    ZyanTrackingStatistics* statistics)
+{
+    if (!tracking || !statistics)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    const ZyanTrackingStatistics* const source = &tracking->statistics;
+
+    statistics->allocation_count        = ZyanTrackingAtomicLoad(&source->allocation_count);
+    statistics->reallocation_count      = ZyanTrackingAtomicLoad(&source->reallocation_count);
+    statistics->reallocation_move_count =
+        ZyanTrackingAtomicLoad(&source->reallocation_move_count);
+    statistics->deallocation_count      = ZyanTrackingAtomicLoad(&source->deallocation_count);
+    statistics->bytes_requested         = ZyanTrackingAtomicLoad(&source->bytes_requested);
+    statistics->bytes_live              = ZyanTrackingAtomicLoad(&source->bytes_live);
+    statistics->bytes_peak              = ZyanTrackingAtomicLoad(&source->bytes_peak);
+    statistics->bytes_copied            = ZyanTrackingAtomicLoad(&source->bytes_copied);
+    for (ZyanUSize i = 0; i < ZYAN_TRACKING_HISTOGRAM_SIZE; ++i)
+    {
+        statistics->histogram[i] = ZyanTrackingAtomicLoad(&source->histogram[i]);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanTrackingReset(ZyanTrackingAllocator* tracking)
+{
+    if (!tracking)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanTrackingStatistics* const statistics = &tracking->statistics;
+
+    ZyanTrackingAtomicStore(&statistics->allocation_count, 0);
+    ZyanTrackingAtomicStore(&statistics->reallocation_count, 0);
+    ZyanTrackingAtomicStore(&statistics->reallocation_move_count, 0);
+    ZyanTrackingAtomicStore(&statistics->deallocation_count, 0);
+    ZyanTrackingAtomicStore(&statistics->bytes_requested, 0);
+    ZyanTrackingAtomicStore(&statistics->bytes_peak,
+        ZyanTrackingAtomicLoad(&statistics->bytes_live));
+    ZyanTrackingAtomicStore(&statistics->bytes_copied, 0);
+    for (ZyanUSize i = 0; i < ZYAN_TRACKING_HISTOGRAM_SIZE; ++i)
+    {
+        ZyanTrackingAtomicStore(&statistics->histogram[i], 0);
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
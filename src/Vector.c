@@ -24,8 +24,22 @@
 
 ***************************************************************************************************/
 
+#include <Zycore/Bitset.h>
 #include <Zycore/LibC.h>
 #include <Zycore/Vector.h>
+#ifndef ZYAN_NO_LIBC
+#   include <Zycore/API/Memory.h>
+#   include <Zycore/ThreadPool.h>
+#endif
+
+// The SIMD code paths are not used in `ZYAN_NO_LIBC` builds, as those commonly target kernel-mode
+// environments in which the vector registers must not be touched without saving them first
+#if !defined(ZYAN_NO_LIBC) && (defined(ZYAN_X86) || defined(ZYAN_X64)) && \
+    (defined(ZYAN_GNUC) || defined(ZYAN_MSVC))
+#   define ZYCORE_VECTOR_HAS_SIMD
+#   include <immintrin.h>
+#   include <Zycore/API/Processor.h>
+#endif
 
 /* ============================================================================================== */
 /* Internal macros                                                                                */
@@ -73,6 +87,129 @@
 /* Helper functions                                                                               */
 /* ---------------------------------------------------------------------------------------------- */
 
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Returns the number of bytes that have to be committed to hold `capacity` elements of a vector
+ * that uses virtual memory.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   capacity    The capacity (number of elements).
+ *
+ * @return  The number of bytes, rounded up to the system page size.
+ */
+static ZyanUSize ZyanVectorGetCommitSize(const ZyanVector* vector, ZyanUSize capacity)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->max_capacity);
+
+    const ZyanUSize page_size = ZyanMemoryGetSystemPageSize();
+    return ZYAN_ALIGN_UP(capacity * vector->element_size, page_size);
+}
+
+/**
+ * Commits or decommits pages of a vector that uses virtual memory.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   capacity    The new capacity.
+ *
+ * @return  A zyan status code.
+ *
+ * The data buffer never moves. Growing commits at least twice the current capacity (limited by
+ * the reserved capacity) to keep the number of system calls low.
+ */
+static ZyanStatus ZyanVectorReallocateVirtual(ZyanVector* vector, ZyanUSize capacity)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->max_capacity);
+
+    if (capacity > vector->max_capacity)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+    if (capacity > vector->capacity)
+    {
+        capacity = ZYAN_MAX(capacity, ZYAN_MIN(vector->capacity * 2, vector->max_capacity));
+    }
+    capacity = ZYAN_MAX(capacity, ZYAN_VECTOR_MIN_CAPACITY);
+
+    const ZyanUSize committed = ZyanVectorGetCommitSize(vector, vector->capacity);
+    const ZyanUSize required  = ZyanVectorGetCommitSize(vector, capacity);
+
+    if (required > committed)
+    {
+        ZYAN_CHECK(ZyanMemoryVirtualCommit((ZyanU8*)vector->data + committed,
+            required - committed, ZYAN_PAGE_READWRITE));
+    }
+    if (required < committed)
+    {
+        ZYAN_CHECK(ZyanMemoryVirtualDecommit((ZyanU8*)vector->data + required,
+            committed - required));
+    }
+    vector->capacity = capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#endif // ZYAN_NO_LIBC
+
+/**
+ * Moves the elements of a vector from its small buffer to a dynamically allocated buffer.
+ *
+ * @param   vector      A pointer to the `ZyanVector` instance.
+ * @param   capacity    The new capacity.
+ *
+ * @return  A zyan status code.
+ *
+ * Requests that do not exceed the capacity of the small buffer are ignored.
+ */
+static ZyanStatus ZyanVectorLeaveSmallBuffer(ZyanVector* vector, ZyanUSize capacity)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->in_small_buffer);
+    ZYAN_ASSERT(vector->allocator);
+    ZYAN_ASSERT(vector->allocator->allocate);
+
+    if (capacity <= vector->capacity)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    void* data;
+    ZYAN_CHECK(vector->allocator->allocate(vector->allocator, &data, vector->element_size,
+        capacity));
+    ZYAN_MEMCPY(data, vector->data, vector->size * vector->element_size);
+
+    vector->in_small_buffer = ZYAN_FALSE;
+    vector->capacity        = capacity;
+    vector->data            = data;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Calculates the new capacity of a vector that has to hold `size` elements.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   size    The number of elements the vector has to hold.
+ *
+ * @return  The new capacity of the vector.
+ */
+static ZyanUSize ZyanVectorCalcCapacity(const ZyanVector* vector, ZyanUSize size)
+{
+    ZYAN_ASSERT(vector);
+
+    if (vector->growth_policy)
+    {
+        ZYAN_ASSERT(vector->growth_policy->calculate);
+        return ZYAN_MAX(size, vector->growth_policy->calculate(vector->growth_policy,
+            vector->element_size, size));
+    }
+
+    ZYAN_ASSERT(vector->growth_factor >= 1);
+    return (ZyanUSize)(size * vector->growth_factor);
+}
+
 /**
  * Reallocates the internal buffer of the vector.
  *
@@ -88,86 +225,978 @@ static ZyanStatus ZyanVectorReallocate(ZyanVector* vector, ZyanUSize capacity)
     ZYAN_ASSERT(vector->element_size);
     ZYAN_ASSERT(vector->data);
 
+#ifndef ZYAN_NO_LIBC
+    if (vector->max_capacity)
+    {
+        return ZyanVectorReallocateVirtual(vector, capacity);
+    }
+#endif // ZYAN_NO_LIBC
+
+    if (vector->in_small_buffer)
+    {
+        return ZyanVectorLeaveSmallBuffer(vector, capacity);
+    }
+
     if (!vector->allocator)
     {
         if (vector->capacity < capacity)
         {
-            return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+            return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+        }
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_ASSERT(vector->allocator);
+    ZYAN_ASSERT(vector->allocator->reallocate);
+
+    if (capacity < ZYAN_VECTOR_MIN_CAPACITY)
+    {
+        if (vector->capacity > ZYAN_VECTOR_MIN_CAPACITY)
+        {
+            capacity = ZYAN_VECTOR_MIN_CAPACITY;
+        } else
+        {
+            return ZYAN_STATUS_SUCCESS;
+        }
+    }
+
+    if (vector->alignment)
+    {
+        ZYAN_CHECK(ZyanAllocatorReallocateAligned(vector->allocator, &vector->data,
+            vector->alignment, vector->element_size, vector->capacity, capacity));
+    } else
+    {
+        ZYAN_CHECK(vector->allocator->reallocate(vector->allocator, &vector->data,
+            vector->element_size, capacity));
+    }
+    vector->capacity = capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Makes sure the vector has room for `count` additional elements, growing it at most once.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   count   The number of elements to append.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanVectorGrowForAppend(ZyanVector* vector, ZyanUSize count)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->element_size);
+
+    if (count > (ZyanUSize)-1 / vector->element_size - vector->size)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+
+    if (ZYCORE_VECTOR_SHOULD_GROW(vector->size + count, vector->capacity))
+    {
+        ZYAN_CHECK(ZyanVectorReallocate(vector,
+            ZYAN_MAX(1, ZyanVectorCalcCapacity(vector, vector->size + count))));
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Shifts all elements starting at the specified `index` by the amount of `count` to the left.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   index   The start index.
+ * @param   count   The amount of shift operations.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanVectorShiftLeft(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+    ZYAN_ASSERT(count > 0);
+    //ZYAN_ASSERT((ZyanISize)count - (ZyanISize)index + 1 >= 0);
+
+    const void* const source = ZYCORE_VECTOR_OFFSET(vector, index + count);
+    void* const dest         = ZYCORE_VECTOR_OFFSET(vector, index);
+    const ZyanUSize size     = (vector->size - index - count) * vector->element_size;
+    ZYAN_MEMMOVE(dest, source, size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * Shifts all elements starting at the specified `index` by the amount of `count` to the right.
+ *
+ * @param   vector  A pointer to the `ZyanVector` instance.
+ * @param   index   The start index.
+ * @param   count   The amount of shift operations.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus ZyanVectorShiftRight(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
+{
+    ZYAN_ASSERT(vector);
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+    ZYAN_ASSERT(count > 0);
+    ZYAN_ASSERT(vector->size + count <= vector->capacity);
+
+    const void* const source = ZYCORE_VECTOR_OFFSET(vector, index);
+    void* const dest         = ZYCORE_VECTOR_OFFSET(vector, index + count);
+    const ZyanUSize size     = (vector->size - index) * vector->element_size;
+    ZYAN_MEMMOVE(dest, source, size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Sorting                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * Partitions with a size less than or equal to this value are sorted using insertion-sort.
+ */
+#define ZYCORE_VECTOR_SORT_INSERTION_THRESHOLD \
+    16
+
+/**
+ * The size of the stack buffer used to hold a temporary element during insertion-sort.
+ */
+#define ZYCORE_VECTOR_SORT_BUFFER_SIZE \
+    64
+
+/**
+ * Copies a single element.
+ *
+ * @param   destination     A pointer to the destination element.
+ * @param   source          A pointer to the source element.
+ * @param   element_size    The size of a single element.
+ *
+ * Common element sizes are copied using fixed size copies that can be inlined by the compiler.
+ */
+static void ZyanVectorCopyElement(void* destination, const void* source,
+    ZyanUSize element_size)
+{
+    switch (element_size)
+    {
+    case 4:
+        ZYAN_MEMCPY(destination, source, 4);
+        break;
+    case 8:
+        ZYAN_MEMCPY(destination, source, 8);
+        break;
+    case 16:
+        ZYAN_MEMCPY(destination, source, 16);
+        break;
+    default:
+        ZYAN_MEMCPY(destination, source, element_size);
+        break;
+    }
+}
+
+/**
+ * Swaps two elements.
+ *
+ * @param   first           A pointer to the first element.
+ * @param   second          A pointer to the second element.
+ * @param   element_size    The size of a single element.
+ */
+static void ZyanVectorSwap(ZyanU8* first, ZyanU8* second, ZyanUSize element_size)
+{
+    ZyanU8 temp[ZYCORE_VECTOR_SORT_BUFFER_SIZE];
+
+    while (element_size > 0)
+    {
+        const ZyanUSize n = ZYAN_MIN(element_size, sizeof(temp));
+        ZyanVectorCopyElement(temp, first, n);
+        ZyanVectorCopyElement(first, second, n);
+        ZyanVectorCopyElement(second, temp, n);
+        first += n;
+        second += n;
+        element_size -= n;
+    }
+}
+
+/**
+ * Sorts a range of elements using insertion-sort.
+ *
+ * @param   data            A pointer to the first element.
+ * @param   count           The number of elements.
+ * @param   element_size    The size of a single element.
+ * @param   comparison      The comparison function to use.
+ */
+static void ZyanVectorInsertionSort(ZyanU8* data, ZyanUSize count, ZyanUSize element_size,
+    ZyanComparison comparison)
+{
+    if (element_size > ZYCORE_VECTOR_SORT_BUFFER_SIZE)
+    {
+        for (ZyanUSize i = 1; i < count; ++i)
+        {
+            for (ZyanU8* p = data + i * element_size;
+                (p > data) && (comparison(p - element_size, p) > 0); p -= element_size)
+            {
+                ZyanVectorSwap(p - element_size, p, element_size);
+            }
+        }
+        return;
+    }
+
+    ZyanU8 temp[ZYCORE_VECTOR_SORT_BUFFER_SIZE];
+    for (ZyanUSize i = 1; i < count; ++i)
+    {
+        ZyanU8* const current = data + i * element_size;
+        if (comparison(current - element_size, current) <= 0)
+        {
+            continue;
+        }
+
+        ZyanVectorCopyElement(temp, current, element_size);
+        ZyanU8* p = current - element_size;
+        while ((p > data) && (comparison(p - element_size, temp) > 0))
+        {
+            p -= element_size;
+        }
+        ZYAN_MEMMOVE(p + element_size, p, (ZyanUSize)(current - p));
+        ZyanVectorCopyElement(p, temp, element_size);
+    }
+}
+
+/**
+ * Restores the heap property for the subtree starting at `root`.
+ *
+ * @param   data            A pointer to the first element.
+ * @param   root            The index of the subtree root.
+ * @param   count           The number of elements in the heap.
+ * @param   element_size    The size of a single element.
+ * @param   comparison      The comparison function to use.
+ */
+static void ZyanVectorSiftDown(ZyanU8* data, ZyanUSize root, ZyanUSize count,
+    ZyanUSize element_size, ZyanComparison comparison)
+{
+    for (;;)
+    {
+        ZyanUSize child = 2 * root + 1;
+        if (child >= count)
+        {
+            return;
+        }
+        if ((child + 1 < count) &&
+            (comparison(data + child * element_size, data + (child + 1) * element_size) < 0))
+        {
+            ++child;
+        }
+        if (comparison(data + root * element_size, data + child * element_size) >= 0)
+        {
+            return;
+        }
+        ZyanVectorSwap(data + root * element_size, data + child * element_size, element_size);
+        root = child;
+    }
+}
+
+/**
+ * Sorts a range of elements using heap-sort.
+ *
+ * @param   data            A pointer to the first element.
+ * @param   count           The number of elements.
+ * @param   element_size    The size of a single element.
+ * @param   comparison      The comparison function to use.
+ */
+static void ZyanVectorHeapSort(ZyanU8* data, ZyanUSize count, ZyanUSize element_size,
+    ZyanComparison comparison)
+{
+    for (ZyanUSize i = count / 2; i > 0; --i)
+    {
+        ZyanVectorSiftDown(data, i - 1, count, element_size, comparison);
+    }
+    for (ZyanUSize i = count - 1; i > 0; --i)
+    {
+        ZyanVectorSwap(data, data + i * element_size, element_size);
+        ZyanVectorSiftDown(data, 0, i, element_size, comparison);
+    }
+}
+
+/**
+ * Sorts a range of elements using introsort.
+ *
+ * @param   data            A pointer to the first element.
+ * @param   count           The number of elements.
+ * @param   element_size    The size of a single element.
+ * @param   comparison      The comparison function to use.
+ * @param   depth           The remaining recursion depth before falling back to heap-sort.
+ *
+ * Quicksort with a median-of-three pivot is used for large partitions. Partitions that exceed the
+ * recursion `depth` are sorted using heap-sort and small partitions using insertion-sort.
+ */
+static void ZyanVectorIntroSort(ZyanU8* data, ZyanUSize count, ZyanUSize element_size,
+    ZyanComparison comparison, ZyanUSize depth)
+{
+    while (count > ZYCORE_VECTOR_SORT_INSERTION_THRESHOLD)
+    {
+        if (!depth)
+        {
+            ZyanVectorHeapSort(data, count, element_size, comparison);
+            return;
+        }
+        --depth;
+
+        // Move the median of the first, middle and last element to the front
+        ZyanU8* const first  = data;
+        ZyanU8* const middle = data + (count / 2) * element_size;
+        ZyanU8* const last   = data + (count - 1) * element_size;
+        if (comparison(first, middle) > 0)
+        {
+            ZyanVectorSwap(first, middle, element_size);
+        }
+        if (comparison(middle, last) > 0)
+        {
+            ZyanVectorSwap(middle, last, element_size);
+            if (comparison(first, middle) > 0)
+            {
+                ZyanVectorSwap(first, middle, element_size);
+            }
+        }
+        ZyanVectorSwap(data, middle, element_size);
+
+        // Hoare partition scheme. Elements equal to the pivot stop both scans, which keeps the
+        // partitions balanced for inputs with many duplicates
+        ZyanUSize i = 0;
+        ZyanUSize j = count;
+        for (;;)
+        {
+            do
+            {
+                ++i;
+            } while ((i < count) && (comparison(data + i * element_size, data) < 0));
+            do
+            {
+                --j;
+            } while (comparison(data + j * element_size, data) > 0);
+            if (i >= j)
+            {
+                break;
+            }
+            ZyanVectorSwap(data + i * element_size, data + j * element_size, element_size);
+        }
+        ZyanVectorSwap(data, data + j * element_size, element_size);
+
+        // Recurse into the smaller partition to bound the stack usage
+        ZyanU8* const right = data + (j + 1) * element_size;
+        const ZyanUSize count_left  = j;
+        const ZyanUSize count_right = count - j - 1;
+        if (count_left < count_right)
+        {
+            ZyanVectorIntroSort(data, count_left, element_size, comparison, depth);
+            data  = right;
+            count = count_right;
+        } else
+        {
+            ZyanVectorIntroSort(right, count_right, element_size, comparison, depth);
+            count = count_left;
+        }
+    }
+
+    ZyanVectorInsertionSort(data, count, element_size, comparison);
+}
+
+/**
+ * Calculates the maximum recursion depth of intro-sort for the given number of elements.
+ *
+ * @param   count   The number of elements.
+ *
+ * @return  Twice the binary logarithm of `count`.
+ */
+static ZyanUSize ZyanVectorCalcSortDepth(ZyanUSize count)
+{
+    ZyanUSize depth = 0;
+    for (ZyanUSize n = count; n > 1; n >>= 1)
+    {
+        depth += 2;
+    }
+
+    return depth;
+}
+
+/**
+ * Reads an integer sort key and maps it to an unsigned value with the same ordering.
+ *
+ * @param   element     A pointer to the key.
+ * @param   key_size    The size of the key in bytes (`1`, `2`, `4` or `8`).
+ * @param   sign_mask   The mask that flips the sign bit of signed keys or `0`.
+ *
+ * @return  The key value.
+ */
+static ZyanU64 ZyanVectorReadSortKey(const ZyanU8* element, ZyanUSize key_size,
+    ZyanU64 sign_mask)
+{
+    switch (key_size)
+    {
+    case 1:
+        return *element ^ sign_mask;
+    case 2:
+    {
+        ZyanU16 value;
+        ZYAN_MEMCPY(&value, element, sizeof(value));
+        return value ^ sign_mask;
+    }
+    case 4:
+    {
+        ZyanU32 value;
+        ZYAN_MEMCPY(&value, element, sizeof(value));
+        return value ^ sign_mask;
+    }
+    case 8:
+    {
+        ZyanU64 value;
+        ZYAN_MEMCPY(&value, element, sizeof(value));
+        return value ^ sign_mask;
+    }
+    default:
+        ZYAN_UNREACHABLE;
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Byte-wise searching                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * The number of elements compared by a single call to a `ZyanVectorMatchFunction`.
+ */
+#define ZYCORE_VECTOR_MATCH_BLOCK_SIZE \
+    64
+
+/**
+ * Defines the `ZyanVectorMatchFunction` function prototype.
+ *
+ * @param   data    A pointer to the first of `ZYCORE_VECTOR_MATCH_BLOCK_SIZE` elements.
+ * @param   element A pointer to the element to search for.
+ *
+ * @return  A mask that has bit `n` set, if the `n`-th element equals `element`.
+ */
+typedef ZyanU64 (*ZyanVectorMatchFunction)(const ZyanU8* data, const void* element);
+
+/**
+ * Returns the number of trailing zero bits of the given non-zero `value`.
+ *
+ * @param   value   The value.
+ *
+ * @return  The number of trailing zero bits.
+ */
+static ZyanUSize ZyanVectorCountTrailingZeros(ZyanU64 value)
+{
+    ZYAN_ASSERT(value);
+
+#if defined(ZYAN_GNUC)
+    return (ZyanUSize)__builtin_ctzll(value);
+#else
+    ZyanUSize count = 0;
+    while (!(value & 1))
+    {
+        value >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/**
+ * Compares two elements byte-wise.
+ *
+ * @param   a               A pointer to the first element.
+ * @param   b               A pointer to the second element.
+ * @param   element_size    The size of a single element.
+ *
+ * @return  `ZYAN_TRUE`, if both elements are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool ZyanVectorEqualBytes(const void* a, const void* b, ZyanUSize element_size)
+{
+    switch (element_size)
+    {
+    case 1:
+        return *(const ZyanU8*)a == *(const ZyanU8*)b;
+    case 2:
+    {
+        ZyanU16 x, y;
+        ZYAN_MEMCPY(&x, a, sizeof(x));
+        ZYAN_MEMCPY(&y, b, sizeof(y));
+        return x == y;
+    }
+    case 4:
+    {
+        ZyanU32 x, y;
+        ZYAN_MEMCPY(&x, a, sizeof(x));
+        ZYAN_MEMCPY(&y, b, sizeof(y));
+        return x == y;
+    }
+    case 8:
+    {
+        ZyanU64 x, y;
+        ZYAN_MEMCPY(&x, a, sizeof(x));
+        ZYAN_MEMCPY(&y, b, sizeof(y));
+        return x == y;
+    }
+    default:
+        return ZYAN_MEMCMP(a, b, element_size) == 0;
+    }
+}
+
+#ifdef ZYCORE_VECTOR_HAS_SIMD
+
+ZYAN_TARGET("sse2")
+static ZyanU64 ZyanVectorMatch8SSE2(const ZyanU8* data, const void* element)
+{
+    const __m128i value = _mm_set1_epi8(*(const char*)element);
+    ZyanU64 mask = 0;
+    for (ZyanUSize i = 0; i < 4; ++i)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(data + i * 16));
+        mask |= (ZyanU64)(ZyanU32)_mm_movemask_epi8(_mm_cmpeq_epi8(v, value)) << (i * 16);
+    }
+    return mask;
+}
+
+ZYAN_TARGET("sse2")
+static ZyanU64 ZyanVectorMatch16SSE2(const ZyanU8* data, const void* element)
+{
+    ZyanU16 raw;
+    ZYAN_MEMCPY(&raw, element, sizeof(raw));
+    const __m128i value = _mm_set1_epi16((short)raw);
+    ZyanU64 mask = 0;
+    for (ZyanUSize i = 0; i < 4; ++i)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(data + i * 32));
+        const __m128i b = _mm_loadu_si128((const __m128i*)(data + i * 32 + 16));
+        const __m128i packed = _mm_packs_epi16(_mm_cmpeq_epi16(a, value),
+            _mm_cmpeq_epi16(b, value));
+        mask |= (ZyanU64)(ZyanU32)_mm_movemask_epi8(packed) << (i * 16);
+    }
+    return mask;
+}
+
+ZYAN_TARGET("sse2")
+static ZyanU64 ZyanVectorMatch32SSE2(const ZyanU8* data, const void* element)
+{
+    ZyanU32 raw;
+    ZYAN_MEMCPY(&raw, element, sizeof(raw));
+    const __m128i value = _mm_set1_epi32((int)raw);
+    ZyanU64 mask = 0;
+    for (ZyanUSize i = 0; i < 16; ++i)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(data + i * 16));
+        const __m128 cmp = _mm_castsi128_ps(_mm_cmpeq_epi32(v, value));
+        mask |= (ZyanU64)(ZyanU32)_mm_movemask_ps(cmp) << (i * 4);
+    }
+    return mask;
+}
+
+ZYAN_TARGET("sse2")
+static ZyanU64 ZyanVectorMatch64SSE2(const ZyanU8* data, const void* element)
+{
+    ZyanU32 raw[2];
+    ZYAN_MEMCPY(raw, element, sizeof(raw));
+    const __m128i value = _mm_set_epi32((int)raw[1], (int)raw[0], (int)raw[1], (int)raw[0]);
+    ZyanU64 mask = 0;
+    for (ZyanUSize i = 0; i < 32; ++i)
+    {
+        // SSE2 lacks a 64-bit compare. Both 32-bit halves have to match
+        const __m128i v = _mm_loadu_si128((const __m128i*)(data + i * 16));
+        const __m128i cmp = _mm_cmpeq_epi32(v, value);
+        const __m128i both = _mm_and_si128(cmp, _mm_shuffle_epi32(cmp, _MM_SHUFFLE(2, 3, 0, 1)));
+        mask |= (ZyanU64)(ZyanU32)_mm_movemask_pd(_mm_castsi128_pd(both)) << (i * 2);
+    }
+    return mask;
+}
+
+ZYAN_TARGET("avx2")
+static ZyanU64 ZyanVectorMatch8AVX2(const ZyanU8* data, const void* element)
+{
+    const __m256i value = _mm256_set1_epi8(*(const char*)element);
+    const __m256i a = _mm256_loadu_si256((const __m256i*)(data));
+    const __m256i b = _mm256_loadu_si256((const __m256i*)(data + 32));
+    return (ZyanU64)(ZyanU32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, value)) |
+        ((ZyanU64)(ZyanU32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(b, value)) << 32);
+}
+
+ZYAN_TARGET("avx2")
+static ZyanU64 ZyanVectorMatch16AVX2(const ZyanU8* data, const void* element)
+{
+    ZyanU16 raw;
+    ZYAN_MEMCPY(&raw, element, sizeof(raw));
+    const __m256i value = _mm256_set1_epi16((short)raw);
+    ZyanU64 mask = 0;
+    for (ZyanUSize i = 0; i < 2; ++i)
+    {
+        const __m256i a = _mm256_loadu_si256((const __m256i*)(data + i * 64));
+        const __m256i b = _mm256_loadu_si256((const __m256i*)(data + i * 64 + 32));
+        // The pack instruction operates on 128-bit lanes, restore the element order afterwards
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(
+            _mm256_cmpeq_epi16(a, value), _mm256_cmpeq_epi16(b, value)), _MM_SHUFFLE(3, 1, 2, 0));
+        mask |= (ZyanU64)(ZyanU32)_mm256_movemask_epi8(packed) << (i * 32);
+    }
+    return mask;
+}
+
+ZYAN_TARGET("avx2")
+static ZyanU64 ZyanVectorMatch32AVX2(const ZyanU8* data, const void* element)
+{
+    ZyanU32 raw;
+    ZYAN_MEMCPY(&raw, element, sizeof(raw));
+    const __m256i value = _mm256_set1_epi32((int)raw);
+    ZyanU64 mask = 0;
+    for (ZyanUSize i = 0; i < 8; ++i)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i * 32));
+        const __m256 cmp = _mm256_castsi256_ps(_mm256_cmpeq_epi32(v, value));
+        mask |= (ZyanU64)(ZyanU32)_mm256_movemask_ps(cmp) << (i * 8);
+    }
+    return mask;
+}
+
+ZYAN_TARGET("avx2")
+static ZyanU64 ZyanVectorMatch64AVX2(const ZyanU8* data, const void* element)
+{
+    ZyanU64 raw;
+    ZYAN_MEMCPY(&raw, element, sizeof(raw));
+    const __m256i value = _mm256_set1_epi64x((long long)raw);
+    ZyanU64 mask = 0;
+    for (ZyanUSize i = 0; i < 16; ++i)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(data + i * 32));
+        const __m256d cmp = _mm256_castsi256_pd(_mm256_cmpeq_epi64(v, value));
+        mask |= (ZyanU64)(ZyanU32)_mm256_movemask_pd(cmp) << (i * 4);
+    }
+    return mask;
+}
+
+#endif // ZYCORE_VECTOR_HAS_SIMD
+
+/**
+ * Returns the fastest `ZyanVectorMatchFunction` for the given element size that is supported by
+ * the current processor.
+ *
+ * @param   element_size    The size of a single element.
+ *
+ * @return  The match function or `ZYAN_NULL`, if the elements have to be compared one by one.
+ */
+static ZyanVectorMatchFunction ZyanVectorGetMatchFunction(ZyanUSize element_size)
+{
+#ifdef ZYCORE_VECTOR_HAS_SIMD
+    if (ZyanProcessorHasFeature(ZYAN_PROCESSOR_FEATURE_AVX2))
+    {
+        switch (element_size)
+        {
+        case 1: return &ZyanVectorMatch8AVX2;
+        case 2: return &ZyanVectorMatch16AVX2;
+        case 4: return &ZyanVectorMatch32AVX2;
+        case 8: return &ZyanVectorMatch64AVX2;
+        default: return ZYAN_NULL;
+        }
+    }
+    if (ZyanProcessorHasFeature(ZYAN_PROCESSOR_FEATURE_SSE2))
+    {
+        switch (element_size)
+        {
+        case 1: return &ZyanVectorMatch8SSE2;
+        case 2: return &ZyanVectorMatch16SSE2;
+        case 4: return &ZyanVectorMatch32SSE2;
+        case 8: return &ZyanVectorMatch64SSE2;
+        default: return ZYAN_NULL;
+        }
+    }
+#else
+    ZYAN_UNUSED(element_size);
+#endif
+
+    return ZYAN_NULL;
+}
+
+/**
+ * Reverses the order of the bits of the given byte.
+ *
+ * @param   value   The byte.
+ *
+ * @return  The byte with reversed bit order.
+ */
+static ZyanU8 ZyanVectorReverseBits(ZyanU8 value)
+{
+    static const ZyanU8 reversed[16] =
+    {
+        0x0, 0x8, 0x4, 0xC, 0x2, 0xA, 0x6, 0xE, 0x1, 0x9, 0x5, 0xD, 0x3, 0xB, 0x7, 0xF
+    };
+
+    return (ZyanU8)((reversed[value & 0x0F] << 4) | reversed[value >> 4]);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Parallel algorithms                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+/**
+ * Defines the `ZyanVectorParallelSortContext` struct.
+ */
+typedef struct ZyanVectorParallelSortContext_
+{
+    /**
+     * The data of the vector.
+     */
+    ZyanU8* data;
+    /**
+     * The scratch buffer (same size as the data of the vector).
+     */
+    ZyanU8* scratch;
+    /**
+     * The size of a single element.
+     */
+    ZyanUSize element_size;
+    /**
+     * The number of elements.
+     */
+    ZyanUSize size;
+    /**
+     * The comparison function.
+     */
+    ZyanComparison comparison;
+    /**
+     * The number of initial runs (a power of two).
+     */
+    ZyanUSize run_count;
+    /**
+     * Signals that the sorted runs have to be copied to the scratch buffer, so that the final
+     * merge pass writes to the data of the vector.
+     */
+    ZyanBool copy_runs;
+    /**
+     * The source buffer of the current merge pass.
+     */
+    const ZyanU8* source;
+    /**
+     * The destination buffer of the current merge pass.
+     */
+    ZyanU8* destination;
+    /**
+     * The number of initial runs that make up each of the two merged halves.
+     */
+    ZyanUSize half_width;
+    /**
+     * The number of parts each merge is split into.
+     */
+    ZyanUSize part_count;
+} ZyanVectorParallelSortContext;
+
+/**
+ * Defines the `ZyanVectorParallelForEachContext` struct.
+ */
+typedef struct ZyanVectorParallelForEachContext_
+{
+    /**
+     * The data of the vector.
+     */
+    ZyanU8* data;
+    /**
+     * The size of a single element.
+     */
+    ZyanUSize element_size;
+    /**
+     * The number of elements.
+     */
+    ZyanUSize size;
+    /**
+     * The number of ranges.
+     */
+    ZyanUSize range_count;
+    /**
+     * The range function.
+     */
+    ZyanVectorRangeFunction function;
+    /**
+     * The user-defined data.
+     */
+    void* user_data;
+} ZyanVectorParallelForEachContext;
+
+/**
+ * Returns the offset of a part, if `size` elements are split into `count` parts of (almost) equal
+ * size.
+ *
+ * @param   size    The total number of elements.
+ * @param   count   The number of parts.
+ * @param   index   The index of the part. Passing `count` returns `size`.
+ *
+ * @return  The offset of the first element of the part.
+ */
+static ZyanUSize ZyanVectorGetPartOffset(ZyanUSize size, ZyanUSize count, ZyanUSize index)
+{
+    return (size / count) * index + (size % count) * index / count;
+}
+
+/**
+ * Determines how many elements of the sorted range `a` are contained in the first `k` elements of
+ * the result of merging `a` with the sorted range `b`.
+ *
+ * @param   a               A pointer to the first range.
+ * @param   count_a         The number of elements in the first range.
+ * @param   b               A pointer to the second range.
+ * @param   count_b         The number of elements in the second range.
+ * @param   k               The number of merged elements.
+ * @param   element_size    The size of a single element.
+ * @param   comparison      The comparison function to use.
+ *
+ * @return  The number of elements taken from `a`.
+ *
+ * Equal elements are taken from `a` first, consistent with `ZyanVectorMerge`.
+ */
+static ZyanUSize ZyanVectorMergeSplit(const ZyanU8* a, ZyanUSize count_a, const ZyanU8* b,
+    ZyanUSize count_b, ZyanUSize k, ZyanUSize element_size, ZyanComparison comparison)
+{
+    ZyanUSize low  = (k > count_b) ? k - count_b : 0;
+    ZyanUSize high = ZYAN_MIN(k, count_a);
+    while (low < high)
+    {
+        const ZyanUSize i = low + (high - low) / 2;
+        if (comparison(a + i * element_size, b + (k - i - 1) * element_size) <= 0)
+        {
+            low = i + 1;
+        } else
+        {
+            high = i;
         }
-        return ZYAN_STATUS_SUCCESS;
     }
 
-    ZYAN_ASSERT(vector->allocator);
-    ZYAN_ASSERT(vector->allocator->reallocate);
+    return low;
+}
 
-    if (capacity < ZYAN_VECTOR_MIN_CAPACITY)
+/**
+ * Merges two sorted ranges.
+ *
+ * @param   a               A pointer to the first range.
+ * @param   count_a         The number of elements in the first range.
+ * @param   b               A pointer to the second range.
+ * @param   count_b         The number of elements in the second range.
+ * @param   destination     A pointer to the destination buffer.
+ * @param   element_size    The size of a single element.
+ * @param   comparison      The comparison function to use.
+ */
+static void ZyanVectorMerge(const ZyanU8* a, ZyanUSize count_a, const ZyanU8* b,
+    ZyanUSize count_b, ZyanU8* destination, ZyanUSize element_size, ZyanComparison comparison)
+{
+    const ZyanU8* const end_a = a + count_a * element_size;
+    const ZyanU8* const end_b = b + count_b * element_size;
+    while ((a < end_a) && (b < end_b))
     {
-        if (vector->capacity > ZYAN_VECTOR_MIN_CAPACITY)
+        if (comparison(b, a) < 0)
         {
-            capacity = ZYAN_VECTOR_MIN_CAPACITY;
+            ZyanVectorCopyElement(destination, b, element_size);
+            b += element_size;
         } else
         {
-            return ZYAN_STATUS_SUCCESS;
+            ZyanVectorCopyElement(destination, a, element_size);
+            a += element_size;
         }
+        destination += element_size;
     }
 
-    vector->capacity = capacity;
-    ZYAN_CHECK(vector->allocator->reallocate(vector->allocator, &vector->data,
-        vector->element_size, vector->capacity));
-
-    return ZYAN_STATUS_SUCCESS;
+    ZYAN_MEMCPY(destination, a, (ZyanUSize)(end_a - a));
+    destination += end_a - a;
+    ZYAN_MEMCPY(destination, b, (ZyanUSize)(end_b - b));
 }
 
 /**
- * Shifts all elements starting at the specified `index` by the amount of `count` to the left.
+ * Sorts a single run of a parallel sort.
  *
- * @param   vector  A pointer to the `ZyanVector` instance.
- * @param   index   The start index.
- * @param   count   The amount of shift operations.
+ * @param   context A pointer to the `ZyanVectorParallelSortContext`.
+ * @param   index   The index of the run.
  *
  * @return  A zyan status code.
  */
-static ZyanStatus ZyanVectorShiftLeft(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
+static ZyanStatus ZyanVectorParallelSortRun(void* context, ZyanUSize index)
 {
-    ZYAN_ASSERT(vector);
-    ZYAN_ASSERT(vector->element_size);
-    ZYAN_ASSERT(vector->data);
-    ZYAN_ASSERT(count > 0);
-    //ZYAN_ASSERT((ZyanISize)count - (ZyanISize)index + 1 >= 0);
+    const ZyanVectorParallelSortContext* const ctx = (const ZyanVectorParallelSortContext*)context;
 
-    const void* const source = ZYCORE_VECTOR_OFFSET(vector, index + count);
-    void* const dest         = ZYCORE_VECTOR_OFFSET(vector, index);
-    const ZyanUSize size     = (vector->size - index - count) * vector->element_size;
-    ZYAN_MEMMOVE(dest, source, size);
+    const ZyanUSize begin = ZyanVectorGetPartOffset(ctx->size, ctx->run_count, index);
+    const ZyanUSize count = ZyanVectorGetPartOffset(ctx->size, ctx->run_count, index + 1) - begin;
+    const ZyanUSize offset = begin * ctx->element_size;
+
+    ZyanVectorIntroSort(ctx->data + offset, count, ctx->element_size, ctx->comparison,
+        ZyanVectorCalcSortDepth(count));
+    if (ctx->copy_runs)
+    {
+        ZYAN_MEMCPY(ctx->scratch + offset, ctx->data + offset, count * ctx->element_size);
+    }
 
     return ZYAN_STATUS_SUCCESS;
 }
 
 /**
- * Shifts all elements starting at the specified `index` by the amount of `count` to the right.
+ * Merges a single part of two runs of a parallel sort.
  *
- * @param   vector  A pointer to the `ZyanVector` instance.
- * @param   index   The start index.
- * @param   count   The amount of shift operations.
+ * @param   context A pointer to the `ZyanVectorParallelSortContext`.
+ * @param   index   The index of the part.
  *
  * @return  A zyan status code.
  */
-static ZyanStatus ZyanVectorShiftRight(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
+static ZyanStatus ZyanVectorParallelSortMerge(void* context, ZyanUSize index)
 {
-    ZYAN_ASSERT(vector);
-    ZYAN_ASSERT(vector->element_size);
-    ZYAN_ASSERT(vector->data);
-    ZYAN_ASSERT(count > 0);
-    ZYAN_ASSERT(vector->size + count <= vector->capacity);
-
-    const void* const source = ZYCORE_VECTOR_OFFSET(vector, index);
-    void* const dest         = ZYCORE_VECTOR_OFFSET(vector, index + count);
-    const ZyanUSize size     = (vector->size - index) * vector->element_size;
-    ZYAN_MEMMOVE(dest, source, size);
+    const ZyanVectorParallelSortContext* const ctx = (const ZyanVectorParallelSortContext*)context;
+    const ZyanUSize element_size = ctx->element_size;
+
+    const ZyanUSize first_run = (index / ctx->part_count) * ctx->half_width * 2;
+    const ZyanUSize part = index % ctx->part_count;
+    const ZyanUSize low  = ZyanVectorGetPartOffset(ctx->size, ctx->run_count, first_run);
+    const ZyanUSize mid  = ZyanVectorGetPartOffset(ctx->size, ctx->run_count,
+        first_run + ctx->half_width);
+    const ZyanUSize high = ZyanVectorGetPartOffset(ctx->size, ctx->run_count,
+        first_run + ctx->half_width * 2);
+
+    const ZyanU8* const a = ctx->source + low * element_size;
+    const ZyanU8* const b = ctx->source + mid * element_size;
+    const ZyanUSize count_a = mid - low;
+    const ZyanUSize count_b = high - mid;
+
+    // Every part produces a fixed slice of the output, so the split points in both inputs are
+    // found using a binary search
+    const ZyanUSize k_begin = ZyanVectorGetPartOffset(high - low, ctx->part_count, part);
+    const ZyanUSize k_end = ZyanVectorGetPartOffset(high - low, ctx->part_count, part + 1);
+    const ZyanUSize i_begin = ZyanVectorMergeSplit(a, count_a, b, count_b, k_begin, element_size,
+        ctx->comparison);
+    const ZyanUSize i_end = ZyanVectorMergeSplit(a, count_a, b, count_b, k_end, element_size,
+        ctx->comparison);
+    const ZyanUSize j_begin = k_begin - i_begin;
+    const ZyanUSize j_end = k_end - i_end;
+
+    ZyanVectorMerge(a + i_begin * element_size, i_end - i_begin, b + j_begin * element_size,
+        j_end - j_begin, ctx->destination + (low + k_begin) * element_size, element_size,
+        ctx->comparison);
 
     return ZYAN_STATUS_SUCCESS;
 }
 
+/**
+ * Invokes the range function for a single range of a parallel for-each.
+ *
+ * @param   context A pointer to the `ZyanVectorParallelForEachContext`.
+ * @param   index   The index of the range.
+ *
+ * @return  The status code returned by the range function.
+ */
+static ZyanStatus ZyanVectorParallelForEachRange(void* context, ZyanUSize index)
+{
+    const ZyanVectorParallelForEachContext* const ctx =
+        (const ZyanVectorParallelForEachContext*)context;
+
+    const ZyanUSize begin = ZyanVectorGetPartOffset(ctx->size, ctx->range_count, index);
+    const ZyanUSize end = ZyanVectorGetPartOffset(ctx->size, ctx->range_count, index + 1);
+
+    return ctx->function(ctx->data + begin * ctx->element_size, begin, end - begin,
+        ctx->user_data);
+}
+
+#endif // ZYAN_NO_LIBC
+
 /* ---------------------------------------------------------------------------------------------- */
 
 /* ============================================================================================== */
@@ -193,7 +1222,33 @@ ZyanStatus ZyanVectorInitEx(ZyanVector* vector, ZyanUSize element_size, ZyanUSiz
     ZyanMemberProcedure destructor, ZyanAllocator* allocator, ZyanU8 growth_factor,
     ZyanU8 shrink_threshold)
 {
-    if (!vector || !element_size || !allocator || (growth_factor < 1))
+    return ZyanVectorInitAlignedEx(vector, element_size, capacity, destructor, allocator,
+        growth_factor, shrink_threshold, 0);
+}
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanVectorInitAligned(ZyanVector* vector, ZyanUSize element_size, ZyanUSize capacity,
+    ZyanMemberProcedure destructor, ZyanUSize alignment)
+{
+    if (!alignment)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorInitAlignedEx(vector, element_size, capacity, destructor,
+        ZyanAllocatorDefault(), ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR,
+        ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD, alignment);
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanVectorInitAlignedEx(ZyanVector* vector, ZyanUSize element_size,
+    ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold, ZyanUSize alignment)
+{
+    if (!vector || !element_size || !allocator || (growth_factor < 1) ||
+        !ZYAN_IS_POWER_OF_2(alignment))
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
@@ -201,14 +1256,24 @@ ZyanStatus ZyanVectorInitEx(ZyanVector* vector, ZyanUSize element_size, ZyanUSiz
     ZYAN_ASSERT(allocator->allocate);
 
     vector->allocator        = allocator;
+    vector->growth_policy    = ZYAN_NULL;
     vector->growth_factor    = growth_factor;
     vector->shrink_threshold = shrink_threshold;
+    vector->in_small_buffer  = ZYAN_FALSE;
     vector->size             = 0;
     vector->capacity         = ZYAN_MAX(ZYAN_VECTOR_MIN_CAPACITY, capacity);
     vector->element_size     = element_size;
+    vector->alignment        = alignment;
+    vector->max_capacity     = 0;
     vector->destructor       = destructor;
     vector->data             = ZYAN_NULL;
 
+    if (alignment)
+    {
+        return ZyanAllocatorAllocateAligned(vector->allocator, &vector->data, alignment,
+            vector->element_size, vector->capacity);
+    }
+
     return allocator->allocate(vector->allocator, &vector->data, vector->element_size,
         vector->capacity);
 }
@@ -222,17 +1287,103 @@ ZyanStatus ZyanVectorInitCustomBuffer(ZyanVector* vector, ZyanUSize element_size
     }
 
     vector->allocator        = ZYAN_NULL;
+    vector->growth_policy    = ZYAN_NULL;
     vector->growth_factor    = 1;
     vector->shrink_threshold = 0;
+    vector->in_small_buffer  = ZYAN_FALSE;
+    vector->size             = 0;
+    vector->capacity         = capacity;
+    vector->element_size     = element_size;
+    vector->alignment        = 0;
+    vector->max_capacity     = 0;
+    vector->destructor       = destructor;
+    vector->data             = buffer;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanVectorInitSmallBuffer(ZyanVector* vector, ZyanUSize element_size, void* buffer,
+    ZyanUSize capacity, ZyanMemberProcedure destructor)
+{
+    return ZyanVectorInitSmallBufferEx(vector, element_size, buffer, capacity, destructor,
+        ZyanAllocatorDefault(), ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR,
+        ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD);
+}
+
+#endif // ZYAN_NO_LIBC
+
+ZyanStatus ZyanVectorInitSmallBufferEx(ZyanVector* vector, ZyanUSize element_size, void* buffer,
+    ZyanUSize capacity, ZyanMemberProcedure destructor, ZyanAllocator* allocator,
+    ZyanU8 growth_factor, ZyanU8 shrink_threshold)
+{
+    if (!vector || !element_size || !buffer || !capacity || !allocator || (growth_factor < 1))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    vector->allocator        = allocator;
+    vector->growth_policy    = ZYAN_NULL;
+    vector->growth_factor    = growth_factor;
+    vector->shrink_threshold = shrink_threshold;
+    vector->in_small_buffer  = ZYAN_TRUE;
     vector->size             = 0;
     vector->capacity         = capacity;
     vector->element_size     = element_size;
+    vector->alignment        = 0;
+    vector->max_capacity     = 0;
     vector->destructor       = destructor;
     vector->data             = buffer;
 
     return ZYAN_STATUS_SUCCESS;
 }
 
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanVectorInitVirtual(ZyanVector* vector, ZyanUSize element_size, ZyanUSize capacity,
+    ZyanUSize max_capacity, ZyanMemberProcedure destructor)
+{
+    if (!vector || !element_size || !max_capacity || (capacity > max_capacity) ||
+        (max_capacity > ((ZyanUSize)-1 - ZyanMemoryGetSystemPageSize()) / element_size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    // The growth factor is applied by `ZyanVectorReallocateVirtual`, which allows it to clamp the
+    // new capacity to the reserved capacity
+    vector->allocator        = ZYAN_NULL;
+    vector->growth_policy    = ZYAN_NULL;
+    vector->growth_factor    = 1;
+    vector->shrink_threshold = 0;
+    vector->in_small_buffer  = ZYAN_FALSE;
+    vector->size             = 0;
+    vector->capacity         = 0;
+    vector->element_size     = element_size;
+    vector->alignment        = 0;
+    vector->max_capacity     = max_capacity;
+    vector->destructor       = destructor;
+    vector->data             = ZYAN_NULL;
+
+    ZYAN_CHECK(ZyanMemoryVirtualReserve(&vector->data,
+        ZyanVectorGetCommitSize(vector, max_capacity)));
+
+    capacity = ZYAN_MAX(ZYAN_VECTOR_MIN_CAPACITY, capacity);
+    const ZyanStatus status = ZyanMemoryVirtualCommit(vector->data,
+        ZyanVectorGetCommitSize(vector, capacity), ZYAN_PAGE_READWRITE);
+    if (!ZYAN_SUCCESS(status))
+    {
+        ZyanMemoryVirtualFree(vector->data, ZyanVectorGetCommitSize(vector, max_capacity));
+        vector->data = ZYAN_NULL;
+        return status;
+    }
+    vector->capacity = capacity;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+#endif // ZYAN_NO_LIBC
+
 ZyanStatus ZyanVectorDestroy(ZyanVector* vector)
 {
     if (!vector)
@@ -251,11 +1402,25 @@ ZyanStatus ZyanVectorDestroy(ZyanVector* vector)
         }
     }
 
-    if (vector->allocator && vector->capacity)
+#ifndef ZYAN_NO_LIBC
+    if (vector->max_capacity)
+    {
+        ZYAN_CHECK(ZyanMemoryVirtualFree(vector->data,
+            ZyanVectorGetCommitSize(vector, vector->max_capacity)));
+    } else
+#endif // ZYAN_NO_LIBC
+    if (vector->allocator && vector->capacity && !vector->in_small_buffer)
     {
-        ZYAN_ASSERT(vector->allocator->deallocate);
-        ZYAN_CHECK(vector->allocator->deallocate(vector->allocator, vector->data,
-            vector->element_size, vector->capacity));
+        if (vector->alignment)
+        {
+            ZYAN_CHECK(ZyanAllocatorDeallocateAligned(vector->allocator, vector->data,
+                vector->alignment, vector->element_size, vector->capacity));
+        } else
+        {
+            ZYAN_ASSERT(vector->allocator->deallocate);
+            ZYAN_CHECK(vector->allocator->deallocate(vector->allocator, vector->data,
+                vector->element_size, vector->capacity));
+        }
     }
 
     vector->data = ZYAN_NULL;
@@ -288,8 +1453,8 @@ ZyanStatus ZyanVectorDuplicateEx(ZyanVector* destination, const ZyanVector* sour
     const ZyanUSize len = source->size;
 
     capacity = ZYAN_MAX(capacity, len);
-    ZYAN_CHECK(ZyanVectorInitEx(destination, source->element_size, capacity, source->destructor,
-        allocator, growth_factor, shrink_threshold));
+    ZYAN_CHECK(ZyanVectorInitAlignedEx(destination, source->element_size, capacity,
+        source->destructor, allocator, growth_factor, shrink_threshold, source->alignment));
     ZYAN_ASSERT(destination->capacity >= len);
 
     ZYAN_MEMCPY(destination->data, source->data, len * source->element_size);
@@ -432,7 +1597,7 @@ ZyanStatus ZyanVectorPushBack(ZyanVector* vector, const void* element)
     if (ZYCORE_VECTOR_SHOULD_GROW(vector->size + 1, vector->capacity))
     {
         ZYAN_CHECK(ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)((vector->size + 1) * vector->growth_factor))));
+            ZYAN_MAX(1, ZyanVectorCalcCapacity(vector, vector->size + 1))));
     }
 
     void* const offset = ZYCORE_VECTOR_OFFSET(vector, vector->size);
@@ -443,6 +1608,69 @@ ZyanStatus ZyanVectorPushBack(ZyanVector* vector, const void* element)
     return ZYAN_STATUS_SUCCESS;
 }
 
+ZyanStatus ZyanVectorPushBackRange(ZyanVector* vector, const void* elements, ZyanUSize count)
+{
+    if (!vector || !elements || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    ZYAN_CHECK(ZyanVectorGrowForAppend(vector, count));
+
+    void* const offset = ZYCORE_VECTOR_OFFSET(vector, vector->size);
+    ZYAN_MEMCPY(offset, elements, count * vector->element_size);
+    vector->size += count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorAppendUninitialized(ZyanVector* vector, ZyanUSize count, void** elements)
+{
+    if (!vector || !count || !elements)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    ZYAN_CHECK(ZyanVectorGrowForAppend(vector, count));
+
+    *elements = ZYCORE_VECTOR_OFFSET(vector, vector->size);
+    vector->size += count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorAppendVector(ZyanVector* destination, const ZyanVector* source)
+{
+    if (!destination || !source || (destination->element_size != source->element_size))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZYAN_ASSERT(destination->element_size);
+    ZYAN_ASSERT(destination->data);
+
+    // Capture the size first, in case `source` and `destination` are the same vector
+    const ZyanUSize count = source->size;
+    if (!count)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_CHECK(ZyanVectorGrowForAppend(destination, count));
+
+    void* const offset = ZYCORE_VECTOR_OFFSET(destination, destination->size);
+    ZYAN_MEMCPY(offset, source->data, count * destination->element_size);
+    destination->size += count;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 ZyanStatus ZyanVectorInsert(ZyanVector* vector, ZyanUSize index, const void* element)
 {
     return ZyanVectorInsertRange(vector, index, element, 1);
@@ -466,7 +1694,7 @@ ZyanStatus ZyanVectorInsertRange(ZyanVector* vector, ZyanUSize index, const void
     if (ZYCORE_VECTOR_SHOULD_GROW(vector->size + count, vector->capacity))
     {
         ZYAN_CHECK(ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)((vector->size + count) * vector->growth_factor))));
+            ZYAN_MAX(1, ZyanVectorCalcCapacity(vector, vector->size + count))));
     }
 
     if (index < vector->size)
@@ -509,7 +1737,7 @@ ZyanStatus ZyanVectorEmplaceEx(ZyanVector* vector, ZyanUSize index, void** eleme
     if (ZYCORE_VECTOR_SHOULD_GROW(vector->size + 1, vector->capacity))
     {
         ZYAN_CHECK(ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)((vector->size + 1) * vector->growth_factor))));
+            ZYAN_MAX(1, ZyanVectorCalcCapacity(vector, vector->size + 1))));
     }
 
     if (index < vector->size)
@@ -520,85 +1748,184 @@ ZyanStatus ZyanVectorEmplaceEx(ZyanVector* vector, ZyanUSize index, void** eleme
     *element = ZYCORE_VECTOR_OFFSET(vector, index);
     if (constructor)
     {
-        ZYAN_CHECK(constructor(*element));
+        ZYAN_CHECK(constructor(*element));
+    }
+
+    ++vector->size;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Utils                                                                                          */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanVectorSwapElements(ZyanVector* vector, ZyanUSize index_first, ZyanUSize index_second)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((index_first >= vector->size) || (index_second >= vector->size))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (vector->size == vector->capacity)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    ZyanU64* const t = ZYCORE_VECTOR_OFFSET(vector, vector->size);
+    ZyanU64* const a = ZYCORE_VECTOR_OFFSET(vector, index_first);
+    ZyanU64* const b = ZYCORE_VECTOR_OFFSET(vector, index_second);
+    ZYAN_MEMCPY(t, a, vector->element_size);
+    ZYAN_MEMCPY(a, b, vector->element_size);
+    ZYAN_MEMCPY(b, t, vector->element_size);
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Deletion                                                                                       */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanVectorDelete(ZyanVector* vector, ZyanUSize index)
+{
+    return ZyanVectorDeleteRange(vector, index, 1);
+}
+
+ZyanStatus ZyanVectorDeleteRange(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
+{
+    if (!vector || !count)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (index + count > vector->size)
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (vector->destructor)
+    {
+        for (ZyanUSize i = index; i < index + count; ++i)
+        {
+            vector->destructor(ZYCORE_VECTOR_OFFSET(vector, i));
+        }
+    }
+
+    if (index + count < vector->size)
+    {
+        ZYAN_CHECK(ZyanVectorShiftLeft(vector, index, count));
+    }
+
+    vector->size -= count;
+    if (ZYCORE_VECTOR_SHOULD_SHRINK(vector->size, vector->capacity, vector->shrink_threshold))
+    {
+        return ZyanVectorReallocate(vector,
+            ZYAN_MAX(1, ZyanVectorCalcCapacity(vector, vector->size)));
     }
 
-    ++vector->size;
-
     return ZYAN_STATUS_SUCCESS;
 }
 
-/* ---------------------------------------------------------------------------------------------- */
-/* Utils                                                                                          */
-/* ---------------------------------------------------------------------------------------------- */
-
-ZyanStatus ZyanVectorSwapElements(ZyanVector* vector, ZyanUSize index_first, ZyanUSize index_second)
+ZyanStatus ZyanVectorDeleteSwapBack(ZyanVector* vector, ZyanUSize index)
 {
     if (!vector)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if ((index_first >= vector->size) || (index_second >= vector->size))
+    if (index >= vector->size)
     {
         return ZYAN_STATUS_OUT_OF_RANGE;
     }
 
-    if (vector->size == vector->capacity)
+    void* const element = ZYCORE_VECTOR_OFFSET(vector, index);
+    if (vector->destructor)
     {
-        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+        vector->destructor(element);
     }
 
-    ZYAN_ASSERT(vector->element_size);
-    ZYAN_ASSERT(vector->data);
+    --vector->size;
+    if (index != vector->size)
+    {
+        ZYAN_MEMCPY(element, ZYCORE_VECTOR_OFFSET(vector, vector->size), vector->element_size);
+    }
 
-    ZyanU64* const t = ZYCORE_VECTOR_OFFSET(vector, vector->size);
-    ZyanU64* const a = ZYCORE_VECTOR_OFFSET(vector, index_first);
-    ZyanU64* const b = ZYCORE_VECTOR_OFFSET(vector, index_second);
-    ZYAN_MEMCPY(t, a, vector->element_size);
-    ZYAN_MEMCPY(a, b, vector->element_size);
-    ZYAN_MEMCPY(b, t, vector->element_size);
+    if (ZYCORE_VECTOR_SHOULD_SHRINK(vector->size, vector->capacity, vector->shrink_threshold))
+    {
+        return ZyanVectorReallocate(vector,
+            ZYAN_MAX(1, ZyanVectorCalcCapacity(vector, vector->size)));
+    }
 
     return ZYAN_STATUS_SUCCESS;
 }
 
-/* ---------------------------------------------------------------------------------------------- */
-/* Deletion                                                                                       */
-/* ---------------------------------------------------------------------------------------------- */
-
-ZyanStatus ZyanVectorDelete(ZyanVector* vector, ZyanUSize index)
-{
-    return ZyanVectorDeleteRange(vector, index, 1);
-}
-
-ZyanStatus ZyanVectorDeleteRange(ZyanVector* vector, ZyanUSize index, ZyanUSize count)
+ZyanStatus ZyanVectorRemoveIf(ZyanVector* vector, ZyanVectorPredicate predicate,
+    void* user_data, ZyanUSize* count)
 {
-    if (!vector || !count)
+    if (!vector || !predicate)
     {
         return ZYAN_STATUS_INVALID_ARGUMENT;
     }
-    if (index + count > vector->size)
+
+    const ZyanUSize element_size = vector->element_size;
+    ZyanU8* const data = (ZyanU8*)vector->data;
+
+    // Skip the leading elements that are kept, as they do not have to be moved
+    ZyanUSize read = 0;
+    while ((read < vector->size) && !predicate(data + read * element_size, user_data))
     {
-        return ZYAN_STATUS_OUT_OF_RANGE;
+        ++read;
+    }
+    if (read == vector->size)
+    {
+        if (count)
+        {
+            *count = 0;
+        }
+        return ZYAN_STATUS_SUCCESS;
     }
 
+    // The element that ended the scan already matched the predicate
     if (vector->destructor)
     {
-        for (ZyanUSize i = index; i < index + count; ++i)
+        vector->destructor(data + read * element_size);
+    }
+    ZyanUSize write = read;
+
+    for (++read; read < vector->size; ++read)
+    {
+        ZyanU8* const element = data + read * element_size;
+        if (predicate(element, user_data))
         {
-            vector->destructor(ZYCORE_VECTOR_OFFSET(vector, i));
+            if (vector->destructor)
+            {
+                vector->destructor(element);
+            }
+            continue;
         }
+        ZYAN_MEMCPY(data + write * element_size, element, element_size);
+        ++write;
     }
 
-    if (index + count < vector->size)
+    if (count)
     {
-        ZYAN_CHECK(ZyanVectorShiftLeft(vector, index, count));
+        *count = vector->size - write;
+    }
+    if (write == vector->size)
+    {
+        return ZYAN_STATUS_SUCCESS;
     }
 
-    vector->size -= count;
+    vector->size = write;
     if (ZYCORE_VECTOR_SHOULD_SHRINK(vector->size, vector->capacity, vector->shrink_threshold))
     {
         return ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)(vector->size * vector->growth_factor)));
+            ZYAN_MAX(1, ZyanVectorCalcCapacity(vector, vector->size)));
     }
 
     return ZYAN_STATUS_SUCCESS;
@@ -624,7 +1951,7 @@ ZyanStatus ZyanVectorPopBack(ZyanVector* vector)
     if (ZYCORE_VECTOR_SHOULD_SHRINK(vector->size, vector->capacity, vector->shrink_threshold))
     {
         return ZyanVectorReallocate(vector,
-            ZYAN_MAX(1, (ZyanUSize)(vector->size * vector->growth_factor)));
+            ZYAN_MAX(1, ZyanVectorCalcCapacity(vector, vector->size)));
     }
 
     return ZYAN_STATUS_SUCCESS;
@@ -684,6 +2011,115 @@ ZyanStatus ZyanVectorFindEx(const ZyanVector* vector, const void* element, ZyanI
     return ZYAN_STATUS_FALSE;
 }
 
+ZyanStatus ZyanVectorFindBytes(const ZyanVector* vector, const void* element,
+    ZyanISize* found_index)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorFindBytesEx(vector, element, found_index, 0, vector->size);
+}
+
+ZyanStatus ZyanVectorFindBytesEx(const ZyanVector* vector, const void* element,
+    ZyanISize* found_index, ZyanUSize index, ZyanUSize count)
+{
+    if (!vector || !element || !found_index)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((index > vector->size) || (count > vector->size - index))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+
+    const ZyanUSize element_size = vector->element_size;
+    const ZyanU8* const data = (const ZyanU8*)ZYCORE_VECTOR_OFFSET(vector, index);
+    ZyanUSize i = 0;
+
+    const ZyanVectorMatchFunction match = ZyanVectorGetMatchFunction(element_size);
+    if (match)
+    {
+        for (; i + ZYCORE_VECTOR_MATCH_BLOCK_SIZE <= count; i += ZYCORE_VECTOR_MATCH_BLOCK_SIZE)
+        {
+            const ZyanU64 mask = match(data + i * element_size, element);
+            if (mask)
+            {
+                *found_index = (ZyanISize)(index + i + ZyanVectorCountTrailingZeros(mask));
+                return ZYAN_STATUS_TRUE;
+            }
+        }
+    }
+    for (; i < count; ++i)
+    {
+        if (ZyanVectorEqualBytes(data + i * element_size, element, element_size))
+        {
+            *found_index = (ZyanISize)(index + i);
+            return ZYAN_STATUS_TRUE;
+        }
+    }
+
+    *found_index = -1;
+    return ZYAN_STATUS_FALSE;
+}
+
+ZyanStatus ZyanVectorFindAllBytes(const ZyanVector* vector, const void* element,
+    ZyanBitset* matches)
+{
+    if (!vector || !element || !matches)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (matches->size < vector->size)
+    {
+        return ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+
+    ZYAN_CHECK(ZyanBitsetResetAll(matches));
+
+    const ZyanUSize element_size = vector->element_size;
+    const ZyanUSize count = vector->size;
+    const ZyanU8* const data = (const ZyanU8*)vector->data;
+    ZyanU8* const bits = (ZyanU8*)matches->bits.data;
+    ZyanU64 found = 0;
+    ZyanUSize i = 0;
+
+    // The bitset stores the bit for index `0` in the most significant bit of the first byte,
+    // while the match masks are ordered from the least significant bit
+    const ZyanVectorMatchFunction match = ZyanVectorGetMatchFunction(element_size);
+    if (match)
+    {
+        for (; i + ZYCORE_VECTOR_MATCH_BLOCK_SIZE <= count; i += ZYCORE_VECTOR_MATCH_BLOCK_SIZE)
+        {
+            const ZyanU64 mask = match(data + i * element_size, element);
+            if (!mask)
+            {
+                continue;
+            }
+            found |= mask;
+            for (ZyanUSize j = 0; j < 8; ++j)
+            {
+                bits[i / 8 + j] = ZyanVectorReverseBits((ZyanU8)(mask >> (j * 8)));
+            }
+        }
+    }
+    for (; i < count; ++i)
+    {
+        if (ZyanVectorEqualBytes(data + i * element_size, element, element_size))
+        {
+            bits[i / 8] |= (ZyanU8)(0x80 >> (i % 8));
+            found = 1;
+        }
+    }
+
+    return found ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+}
+
 ZyanStatus ZyanVectorBinarySearch(const ZyanVector* vector, const void* element,
     ZyanUSize* found_index, ZyanComparison comparison)
 {
@@ -740,6 +2176,260 @@ ZyanStatus ZyanVectorBinarySearchEx(const ZyanVector* vector, const void* elemen
     return status;
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* Sorting                                                                                        */
+/* ---------------------------------------------------------------------------------------------- */
+
+ZyanStatus ZyanVectorSort(ZyanVector* vector, ZyanComparison comparison)
+{
+    if (!vector)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    return ZyanVectorSortEx(vector, comparison, 0, vector->size);
+}
+
+ZyanStatus ZyanVectorSortEx(ZyanVector* vector, ZyanComparison comparison, ZyanUSize index,
+    ZyanUSize count)
+{
+    if (!vector || !comparison)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if ((index > vector->size) || (count > vector->size - index))
+    {
+        return ZYAN_STATUS_OUT_OF_RANGE;
+    }
+
+    if (count < 2)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    ZyanVectorIntroSort((ZyanU8*)ZYCORE_VECTOR_OFFSET(vector, index), count,
+        vector->element_size, comparison, ZyanVectorCalcSortDepth(count));
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+ZyanStatus ZyanVectorSortByKey(ZyanVector* vector, ZyanUSize key_offset, ZyanUSize key_size,
+    ZyanBool key_is_signed)
+{
+    if (!vector || ((key_size != 1) && (key_size != 2) && (key_size != 4) && (key_size != 8)) ||
+        (key_offset > vector->element_size) || (key_size > vector->element_size - key_offset))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (vector->size < 2)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    ZyanAllocator* allocator = vector->allocator;
+    if (!allocator)
+    {
+#ifndef ZYAN_NO_LIBC
+        allocator = ZyanAllocatorDefault();
+#else
+        return ZYAN_STATUS_INVALID_OPERATION;
+#endif
+    }
+
+    // The scratch memory holds one histogram per key byte, followed by the temporary element buffer
+    const ZyanUSize element_size = vector->element_size;
+    const ZyanUSize size = vector->size;
+    const ZyanUSize histogram_size = key_size * 256 * sizeof(ZyanUSize);
+    if (size > ((ZyanUSize)-1 - histogram_size) / element_size)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    const ZyanUSize scratch_size = histogram_size + size * element_size;
+    void* scratch;
+    ZYAN_CHECK(allocator->allocate(allocator, &scratch, 1, scratch_size));
+
+    ZyanUSize* const histograms = (ZyanUSize*)scratch;
+    ZYAN_MEMSET(histograms, 0, histogram_size);
+
+    const ZyanU64 sign_mask = key_is_signed ? ((ZyanU64)1 << (key_size * 8 - 1)) : 0;
+
+    // Build the histograms for all key bytes in a single pass
+    const ZyanU8* element = (const ZyanU8*)vector->data + key_offset;
+    for (ZyanUSize i = 0; i < size; ++i, element += element_size)
+    {
+        const ZyanU64 key = ZyanVectorReadSortKey(element, key_size, sign_mask);
+        for (ZyanUSize b = 0; b < key_size; ++b)
+        {
+            ++histograms[b * 256 + ((key >> (b * 8)) & 0xFF)];
+        }
+    }
+
+    ZyanU8* source = (ZyanU8*)vector->data;
+    ZyanU8* destination = (ZyanU8*)scratch + histogram_size;
+    for (ZyanUSize b = 0; b < key_size; ++b)
+    {
+        ZyanUSize* const histogram = histograms + b * 256;
+
+        // Skip passes in which all keys share the same byte value
+        const ZyanU64 first_key = ZyanVectorReadSortKey(source + key_offset, key_size, sign_mask);
+        if (histogram[(first_key >> (b * 8)) & 0xFF] == size)
+        {
+            continue;
+        }
+
+        ZyanUSize offset = 0;
+        for (ZyanUSize i = 0; i < 256; ++i)
+        {
+            const ZyanUSize n = histogram[i];
+            histogram[i] = offset;
+            offset += n;
+        }
+
+        const ZyanU8* current = source;
+        for (ZyanUSize i = 0; i < size; ++i, current += element_size)
+        {
+            const ZyanU64 key = ZyanVectorReadSortKey(current + key_offset, key_size, sign_mask);
+            const ZyanUSize position = histogram[(key >> (b * 8)) & 0xFF]++;
+            ZyanVectorCopyElement(destination + position * element_size, current, element_size);
+        }
+
+        ZyanU8* const temp = source;
+        source = destination;
+        destination = temp;
+    }
+
+    if (source != vector->data)
+    {
+        ZYAN_MEMCPY(vector->data, source, size * element_size);
+    }
+
+    return allocator->deallocate(allocator, scratch, 1, scratch_size);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Parallel algorithms                                                                            */
+/* ---------------------------------------------------------------------------------------------- */
+
+#ifndef ZYAN_NO_LIBC
+
+ZyanStatus ZyanVectorParallelSort(ZyanVector* vector, ZyanThreadPool* pool,
+    ZyanComparison comparison)
+{
+    if (!vector || !pool || !comparison)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    ZyanUSize thread_count;
+    ZYAN_CHECK(ZyanThreadPoolGetThreadCount(pool, &thread_count));
+    if (!thread_count || (vector->size < ZYAN_VECTOR_PARALLEL_SORT_THRESHOLD))
+    {
+        return ZyanVectorSort(vector, comparison);
+    }
+
+    ZYAN_ASSERT(vector->element_size);
+    ZYAN_ASSERT(vector->data);
+
+    ZyanAllocator* const allocator =
+        vector->allocator ? vector->allocator : ZyanAllocatorDefault();
+
+    // Use a power of two number of runs, so that every merge pass halves the number of runs
+    ZyanUSize run_count = 1;
+    ZyanUSize pass_count = 0;
+    while (run_count < thread_count + 1)
+    {
+        run_count *= 2;
+        ++pass_count;
+    }
+
+    const ZyanUSize scratch_size = vector->size * vector->element_size;
+    void* scratch;
+    ZYAN_CHECK(allocator->allocate(allocator, &scratch, 1, scratch_size));
+
+    ZyanVectorParallelSortContext context;
+    context.data         = (ZyanU8*)vector->data;
+    context.scratch      = (ZyanU8*)scratch;
+    context.element_size = vector->element_size;
+    context.size         = vector->size;
+    context.comparison   = comparison;
+    context.run_count    = run_count;
+    context.copy_runs    = (pass_count % 2) ? ZYAN_TRUE : ZYAN_FALSE;
+    context.source       = context.copy_runs ? context.scratch : context.data;
+    context.destination  = context.copy_runs ? context.data : context.scratch;
+
+    ZyanStatus status = ZyanThreadPoolRun(pool, &ZyanVectorParallelSortRun, &context, run_count);
+
+    for (ZyanUSize half_width = 1; ZYAN_SUCCESS(status) && (half_width < run_count);
+        half_width *= 2)
+    {
+        // Split the merges into about two parts per thread, to keep all threads busy even if
+        // there are less merges than threads
+        const ZyanUSize merge_count = run_count / (half_width * 2);
+        const ZyanUSize part_count = (2 * (thread_count + 1) + merge_count - 1) / merge_count;
+
+        context.half_width = half_width;
+        context.part_count = part_count;
+        status = ZyanThreadPoolRun(pool, &ZyanVectorParallelSortMerge, &context,
+            merge_count * part_count);
+
+        const ZyanU8* const temp = context.source;
+        context.source = context.destination;
+        context.destination = (ZyanU8*)temp;
+    }
+
+    const ZyanStatus deallocate_status =
+        allocator->deallocate(allocator, scratch, 1, scratch_size);
+    ZYAN_CHECK(status);
+
+    return deallocate_status;
+}
+
+ZyanStatus ZyanVectorParallelForEach(ZyanVector* vector, ZyanThreadPool* pool,
+    ZyanUSize grain_size, ZyanVectorRangeFunction function, void* user_data)
+{
+    if (!vector || !pool || !function)
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+
+    if (!vector->size)
+    {
+        return ZYAN_STATUS_SUCCESS;
+    }
+    if (!grain_size)
+    {
+        grain_size = ZYAN_VECTOR_DEFAULT_PARALLEL_GRAIN_SIZE;
+    }
+
+    ZyanUSize thread_count;
+    ZYAN_CHECK(ZyanThreadPoolGetThreadCount(pool, &thread_count));
+    if (!thread_count || (vector->size / grain_size < 2))
+    {
+        return function(vector->data, 0, vector->size, user_data);
+    }
+
+    // Use a few ranges per thread, so that threads finishing early can pick up more work
+    ZyanVectorParallelForEachContext context;
+    context.data         = (ZyanU8*)vector->data;
+    context.element_size = vector->element_size;
+    context.size         = vector->size;
+    context.range_count  = ZYAN_MIN(vector->size / grain_size, (thread_count + 1) * 4);
+    context.function     = function;
+    context.user_data    = user_data;
+
+    return ZyanThreadPoolRun(pool, &ZyanVectorParallelForEachRange, &context,
+        context.range_count);
+}
+
+#endif // ZYAN_NO_LIBC
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Memory management                                                                              */
 /* ---------------------------------------------------------------------------------------------- */
@@ -771,8 +2461,7 @@ ZyanStatus ZyanVectorResizeEx(ZyanVector* vector, ZyanUSize size, const void* in
     if (ZYCORE_VECTOR_SHOULD_GROW(size, vector->capacity) ||
         ZYCORE_VECTOR_SHOULD_SHRINK(size, vector->capacity, vector->shrink_threshold))
     {
-        ZYAN_ASSERT(vector->growth_factor >= 1);
-        ZYAN_CHECK(ZyanVectorReallocate(vector, (ZyanUSize)(size * vector->growth_factor)));
+        ZYAN_CHECK(ZyanVectorReallocate(vector, ZyanVectorCalcCapacity(vector, size)));
     }
 
     if (initializer && (size > vector->size))
@@ -813,6 +2502,22 @@ ZyanStatus ZyanVectorShrinkToFit(ZyanVector* vector)
     return ZyanVectorReallocate(vector, vector->size);
 }
 
+ZyanStatus ZyanVectorSetGrowthPolicy(ZyanVector* vector, const ZyanGrowthPolicy* policy)
+{
+    if (!vector || (policy && !policy->calculate))
+    {
+        return ZYAN_STATUS_INVALID_ARGUMENT;
+    }
+    if (!vector->allocator)
+    {
+        return ZYAN_STATUS_INVALID_OPERATION;
+    }
+
+    vector->growth_policy = policy;
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
 /* ---------------------------------------------------------------------------------------------- */
 /* Information                                                                                    */
 /* ---------------------------------------------------------------------------------------------- */
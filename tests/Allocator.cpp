@@ -0,0 +1,1120 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the custom `ZyanAllocator` implementations.
+ */
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include <time.h>
+#include <gtest/gtest.h>
+#include <Zycore/API/Memory.h>
+#include <Zycore/ArenaAllocator.h>
+#include <Zycore/CachingAllocator.h>
+#include <Zycore/HugePageAllocator.h>
+#include <Zycore/List.h>
+#include <Zycore/PoolAllocator.h>
+#include <Zycore/String.h>
+#include <Zycore/TrackingAllocator.h>
+#include <Zycore/Vector.h>
+#include "Benchmark.h"
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Aligned allocation                                                                             */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Allocates, grows, shrinks and releases aligned memory blocks with various alignments
+ *          using the given `allocator`.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ */
+static void TestAlignedAllocation(ZyanAllocator* allocator)
+{
+    for (ZyanUSize alignment = 1; alignment <= 4096; alignment *= 2)
+    {
+        ZyanU32* p;
+        ASSERT_EQ(ZyanAllocatorAllocateAligned(allocator, reinterpret_cast<void**>(&p),
+            alignment, sizeof(ZyanU32), 16), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(reinterpret_cast<ZyanUPointer>(p) % alignment, 0u);
+        for (ZyanU32 i = 0; i < 16; ++i)
+        {
+            p[i] = i;
+        }
+
+        ZyanUSize n = 16;
+        for (ZyanUSize new_n : { 1000, 100000, 8 })
+        {
+            ASSERT_EQ(ZyanAllocatorReallocateAligned(allocator, reinterpret_cast<void**>(&p),
+                alignment, sizeof(ZyanU32), n, new_n), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(reinterpret_cast<ZyanUPointer>(p) % alignment, 0u);
+            for (ZyanU32 i = 0; i < 8; ++i)
+            {
+                ASSERT_EQ(p[i], i);
+            }
+            n = new_n;
+        }
+
+        ASSERT_EQ(ZyanAllocatorDeallocateAligned(allocator, p, alignment, sizeof(ZyanU32), n),
+            ZYAN_STATUS_SUCCESS);
+    }
+}
+
+/**
+ * @brief   A `ZyanAllocator` that forwards to the default allocator and fails all (re-)allocations
+ *          while `fail` is set.
+ */
+struct FailingAllocator
+{
+    ZyanAllocator allocator;
+    bool fail;
+};
+
+/**
+ * @brief   The `allocate` callback of `FailingAllocator`.
+ */
+static ZyanStatus FailingAllocatorAllocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    if (reinterpret_cast<FailingAllocator*>(allocator)->fail)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    return ZyanAllocatorDefault()->allocate(allocator, p, element_size, n);
+}
+
+/**
+ * @brief   The `reallocate` callback of `FailingAllocator`.
+ */
+static ZyanStatus FailingAllocatorReallocate(ZyanAllocator* allocator, void** p,
+    ZyanUSize element_size, ZyanUSize n)
+{
+    if (reinterpret_cast<FailingAllocator*>(allocator)->fail)
+    {
+        return ZYAN_STATUS_NOT_ENOUGH_MEMORY;
+    }
+    return ZyanAllocatorDefault()->reallocate(allocator, p, element_size, n);
+}
+
+/**
+ * @brief   Checks that a failed aligned reallocation leaves the original memory block untouched.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   alignment   The alignment.
+ * @param   n           The number of elements to request. The reallocation must fail.
+ */
+static void TestFailedAlignedReallocation(ZyanAllocator* allocator, ZyanUSize alignment,
+    ZyanUSize n)
+{
+    ZyanU32* p;
+    ASSERT_EQ(ZyanAllocatorAllocateAligned(allocator, reinterpret_cast<void**>(&p), alignment,
+        sizeof(ZyanU32), 16), ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0; i < 16; ++i)
+    {
+        p[i] = i;
+    }
+
+    ZyanU32* const original = p;
+    EXPECT_EQ(ZyanAllocatorReallocateAligned(allocator, reinterpret_cast<void**>(&p), alignment,
+        sizeof(ZyanU32), 16, n), ZYAN_STATUS_NOT_ENOUGH_MEMORY);
+    ASSERT_EQ(p, original);
+    for (ZyanU32 i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(p[i], i);
+    }
+
+    EXPECT_EQ(ZyanAllocatorDeallocateAligned(allocator, p, alignment, sizeof(ZyanU32), 16),
+        ZYAN_STATUS_SUCCESS);
+}
+
+TEST(AlignedAllocationTest, InvalidArguments)
+{
+    void* p;
+    EXPECT_EQ(ZyanAllocatorAllocateAligned(ZyanAllocatorDefault(), &p, 0, 1, 1),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanAllocatorAllocateAligned(ZyanAllocatorDefault(), &p, 24, 1, 1),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+
+    ZyanAllocator allocator;
+    EXPECT_EQ(ZyanAllocatorInitEx(&allocator, ZyanAllocatorDefault()->allocate,
+        ZyanAllocatorDefault()->reallocate, ZyanAllocatorDefault()->deallocate,
+        ZyanAllocatorDefault()->aligned_allocate, nullptr, nullptr),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(AlignedAllocationTest, DefaultAllocator)
+{
+    TestAlignedAllocation(ZyanAllocatorDefault());
+}
+
+TEST(AlignedAllocationTest, Emulated)
+{
+    // Uses the default allocator without native support for aligned allocations
+    ZyanAllocator allocator;
+    ASSERT_EQ(ZyanAllocatorInit(&allocator, ZyanAllocatorDefault()->allocate,
+        ZyanAllocatorDefault()->reallocate, ZyanAllocatorDefault()->deallocate),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(allocator.aligned_allocate, nullptr);
+    TestAlignedAllocation(&allocator);
+
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 0), ZYAN_STATUS_SUCCESS);
+    TestAlignedAllocation(&arena.allocator);
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(AlignedAllocationTest, FailedReallocation)
+{
+    // Emulated aligned allocations on top of a failing allocator
+    FailingAllocator failing;
+    ASSERT_EQ(ZyanAllocatorInit(&failing.allocator, &FailingAllocatorAllocate,
+        &FailingAllocatorReallocate, ZyanAllocatorDefault()->deallocate), ZYAN_STATUS_SUCCESS);
+    failing.fail = false;
+    for (ZyanUSize alignment = 1; alignment <= 4096; alignment *= 2)
+    {
+        ZyanU32* p;
+        ASSERT_EQ(ZyanAllocatorAllocateAligned(&failing.allocator, reinterpret_cast<void**>(&p),
+            alignment, sizeof(ZyanU32), 16), ZYAN_STATUS_SUCCESS);
+        p[15] = 15;
+        failing.fail = true;
+        ZyanU32* const original = p;
+        EXPECT_EQ(ZyanAllocatorReallocateAligned(&failing.allocator, reinterpret_cast<void**>(&p),
+            alignment, sizeof(ZyanU32), 16, 1000), ZYAN_STATUS_NOT_ENOUGH_MEMORY);
+        EXPECT_EQ(p, original);
+        EXPECT_EQ(p[15], 15u);
+        failing.fail = false;
+        EXPECT_EQ(ZyanAllocatorDeallocateAligned(&failing.allocator, p, alignment,
+            sizeof(ZyanU32), 16), ZYAN_STATUS_SUCCESS);
+    }
+
+#if defined(__SANITIZE_ADDRESS__)
+    // AddressSanitizer aborts on allocation requests that can never be satisfied
+    GTEST_SKIP();
+#else
+    // The default allocator fails requests that exceed the address space
+    const ZyanUSize n = (ZyanUSize)-1 / sizeof(ZyanU32);
+    for (ZyanUSize alignment = 1; alignment <= 4096; alignment *= 2)
+    {
+        TestFailedAlignedReallocation(ZyanAllocatorDefault(), alignment, n);
+    }
+#endif
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* ArenaAllocator                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(ArenaAllocatorTest, InitAndDestroy)
+{
+    ZyanArenaAllocator arena;
+
+    EXPECT_EQ(ZyanArenaInitEx(nullptr, 0, ZyanAllocatorDefault()), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanArenaInitEx(&arena, 0, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    ASSERT_EQ(ZyanArenaInit(&arena, 0), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(arena.chunk_size, static_cast<ZyanUSize>(ZYAN_ARENA_DEFAULT_CHUNK_SIZE));
+    EXPECT_EQ(arena.head, ZYAN_NULL);
+
+    ZyanUSize capacity;
+    EXPECT_EQ(ZyanArenaGetCapacity(&arena, &capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(capacity, static_cast<ZyanUSize>(0));
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ArenaAllocatorTest, Allocate)
+{
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 1024), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &arena.allocator;
+
+    void* a;
+    void* b;
+    ASSERT_EQ(allocator->allocate(allocator, &a, sizeof(ZyanU32), 3), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->allocate(allocator, &b, sizeof(ZyanU8), 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(reinterpret_cast<ZyanUPointer>(a) % ZYAN_ARENA_ALIGNMENT, 0u);
+    EXPECT_EQ(reinterpret_cast<ZyanUPointer>(b) % ZYAN_ARENA_ALIGNMENT, 0u);
+    EXPECT_GT(static_cast<ZyanU8*>(b), static_cast<ZyanU8*>(a) + sizeof(ZyanU32) * 3);
+
+    // Oversized allocations receive a dedicated chunk
+    void* c;
+    ASSERT_EQ(allocator->allocate(allocator, &c, 1, 4096), ZYAN_STATUS_SUCCESS);
+    memset(c, 0xCC, 4096);
+    ZyanUSize capacity;
+    EXPECT_EQ(ZyanArenaGetCapacity(&arena, &capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_GE(capacity, static_cast<ZyanUSize>(1024 + 4096));
+
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ArenaAllocatorTest, ReallocateInPlace)
+{
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 1024), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &arena.allocator;
+
+    void* a;
+    ASSERT_EQ(allocator->allocate(allocator, &a, sizeof(ZyanU32), 4), ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0; i < 4; ++i)
+    {
+        static_cast<ZyanU32*>(a)[i] = i;
+    }
+
+    // The last block grows in place
+    void* const old = a;
+    ASSERT_EQ(allocator->reallocate(allocator, &a, sizeof(ZyanU32), 64), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(a, old);
+
+    // Other blocks are copied
+    void* b;
+    ASSERT_EQ(allocator->allocate(allocator, &b, sizeof(ZyanU32), 1), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->reallocate(allocator, &a, sizeof(ZyanU32), 128), ZYAN_STATUS_SUCCESS);
+    EXPECT_NE(a, old);
+    for (ZyanU32 i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(static_cast<ZyanU32*>(a)[i], i);
+    }
+
+    // Shrinking never moves the block
+    void* const current = b;
+    ASSERT_EQ(allocator->reallocate(allocator, &b, sizeof(ZyanU8), 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(b, current);
+
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ArenaAllocatorTest, DeallocateLast)
+{
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 1024), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &arena.allocator;
+
+    void* a;
+    void* b;
+    ASSERT_EQ(allocator->allocate(allocator, &a, 1, 32), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->deallocate(allocator, a, 1, 32), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->allocate(allocator, &b, 1, 32), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(a, b);
+
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ArenaAllocatorTest, Reset)
+{
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 256), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &arena.allocator;
+
+    void* first;
+    ASSERT_EQ(allocator->allocate(allocator, &first, 1, 64), ZYAN_STATUS_SUCCESS);
+    for (int i = 0; i < 64; ++i)
+    {
+        void* p;
+        ASSERT_EQ(allocator->allocate(allocator, &p, 1, 64), ZYAN_STATUS_SUCCESS);
+    }
+    ZyanUSize capacity_before;
+    EXPECT_EQ(ZyanArenaGetCapacity(&arena, &capacity_before), ZYAN_STATUS_SUCCESS);
+
+    // Chunks are reused after a reset
+    ASSERT_EQ(ZyanArenaReset(&arena), ZYAN_STATUS_SUCCESS);
+    void* p;
+    ASSERT_EQ(allocator->allocate(allocator, &p, 1, 64), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(p, first);
+    for (int i = 0; i < 64; ++i)
+    {
+        ASSERT_EQ(allocator->allocate(allocator, &p, 1, 64), ZYAN_STATUS_SUCCESS);
+    }
+    ZyanUSize capacity_after;
+    EXPECT_EQ(ZyanArenaGetCapacity(&arena, &capacity_after), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(capacity_before, capacity_after);
+
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ArenaAllocatorTest, CustomBuffer)
+{
+    alignas(16) ZyanU8 buffer[256];
+    ZyanArenaAllocator arena;
+    EXPECT_EQ(ZyanArenaInitCustomBuffer(&arena, buffer, 4), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanArenaInitCustomBuffer(&arena, buffer, sizeof(buffer)), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &arena.allocator;
+
+    void* p;
+    ASSERT_EQ(allocator->allocate(allocator, &p, 1, 128), ZYAN_STATUS_SUCCESS);
+    EXPECT_GE(static_cast<ZyanU8*>(p), buffer);
+    EXPECT_LE(static_cast<ZyanU8*>(p) + 128, buffer + sizeof(buffer));
+    EXPECT_EQ(allocator->allocate(allocator, &p, 1, 128), ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+
+    ASSERT_EQ(ZyanArenaReset(&arena), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(allocator->allocate(allocator, &p, 1, 128), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(ArenaAllocatorTest, Containers)
+{
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 0), ZYAN_STATUS_SUCCESS);
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInitEx(&vector, sizeof(ZyanU64), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &arena.allocator,
+        ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD),
+        ZYAN_STATUS_SUCCESS);
+    ZyanString string;
+    ASSERT_EQ(ZyanStringInitEx(&string, 0, &arena.allocator, ZYAN_STRING_DEFAULT_GROWTH_FACTOR,
+        ZYAN_STRING_DEFAULT_SHRINK_THRESHOLD), ZYAN_STATUS_SUCCESS);
+
+    ZyanStringView view;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&view, "x"), ZYAN_STATUS_SUCCESS);
+    for (ZyanU64 i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanStringAppend(&string, &view), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanU64 i = 0; i < 1000; ++i)
+    {
+        const ZyanU64* value;
+        ASSERT_EQ(ZyanVectorGetPointer(&vector, static_cast<ZyanUSize>(i),
+            reinterpret_cast<const void**>(&value)), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(*value, i);
+    }
+    ZyanUSize size;
+    ASSERT_EQ(ZyanStringGetSize(&string, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, static_cast<ZyanUSize>(1000));
+
+    EXPECT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* PoolAllocator                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(PoolAllocatorTest, InitAndDestroy)
+{
+    ZyanPoolAllocator pool;
+
+    EXPECT_EQ(ZyanPoolInit(&pool, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanPoolInitEx(&pool, 16, 0, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    ASSERT_EQ(ZyanPoolInit(&pool, 3), ZYAN_STATUS_SUCCESS);
+    ZyanUSize block_size;
+    EXPECT_EQ(ZyanPoolGetBlockSize(&pool, &block_size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(block_size, sizeof(void*));
+    EXPECT_EQ(ZyanPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(PoolAllocatorTest, AllocateAndRecycle)
+{
+    ZyanPoolAllocator pool;
+    ASSERT_EQ(ZyanPoolInitEx(&pool, 24, 256, ZyanAllocatorDefault()), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &pool.allocator;
+
+    // Blocks are carved sequentially from the current slab
+    void* a;
+    void* b;
+    ASSERT_EQ(allocator->allocate(allocator, &a, 24, 1), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->allocate(allocator, &b, 8, 3), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(static_cast<ZyanU8*>(b), static_cast<ZyanU8*>(a) + 24);
+    EXPECT_EQ(allocator->allocate(allocator, &b, 1, 25), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(allocator->reallocate(allocator, &a, 1, 25), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    // Freed blocks are reused in LIFO order
+    ASSERT_EQ(allocator->deallocate(allocator, a, 24, 1), ZYAN_STATUS_SUCCESS);
+    void* c;
+    ASSERT_EQ(allocator->allocate(allocator, &c, 24, 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(a, c);
+
+    // The pool grows without bounds
+    std::vector<void*> blocks(1000);
+    for (auto& block : blocks)
+    {
+        ASSERT_EQ(allocator->allocate(allocator, &block, 24, 1), ZYAN_STATUS_SUCCESS);
+        memset(block, 0xCC, 24);
+    }
+    for (auto block : blocks)
+    {
+        ASSERT_EQ(allocator->deallocate(allocator, block, 24, 1), ZYAN_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(ZyanPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(PoolAllocatorTest, List)
+{
+    ZyanPoolAllocator pool;
+    ASSERT_EQ(ZyanPoolInit(&pool, ZYAN_LIST_NODE_SIZE(sizeof(ZyanU64))), ZYAN_STATUS_SUCCESS);
+
+    ZyanList list;
+    ASSERT_EQ(ZyanListInitEx(&list, sizeof(ZyanU64),
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &pool.allocator), ZYAN_STATUS_SUCCESS);
+    for (ZyanU64 i = 0; i < 10000; ++i)
+    {
+        ASSERT_EQ(ZyanListPushBack(&list, &i), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanU64 i = 0; i < 5000; ++i)
+    {
+        ASSERT_EQ(ZyanListPopFront(&list), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanU64 i = 10000; i < 15000; ++i)
+    {
+        ASSERT_EQ(ZyanListPushBack(&list, &i), ZYAN_STATUS_SUCCESS);
+    }
+
+    const ZyanListNode* node;
+    ASSERT_EQ(ZyanListGetHeadNode(&list, &node), ZYAN_STATUS_SUCCESS);
+    for (ZyanU64 i = 5000; i < 15000; ++i)
+    {
+        ASSERT_NE(node, nullptr);
+        EXPECT_EQ(ZYAN_LIST_GET(ZyanU64, node), i);
+        ASSERT_EQ(ZyanListGetNextNode(&node), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(node, nullptr);
+
+    EXPECT_EQ(ZyanListDestroy(&list), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* CachingAllocator                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(CachingAllocatorTest, AllocateAndRecycle)
+{
+    ZyanCachingAllocator caching;
+    ASSERT_EQ(ZyanCachingInit(&caching), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &caching.allocator;
+
+    for (ZyanUSize size = 1; size <= 2 * ZYAN_CACHING_MAX_BLOCK_SIZE; size += 7)
+    {
+        void* p;
+        ASSERT_EQ(allocator->allocate(allocator, &p, 1, size), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(reinterpret_cast<ZyanUPointer>(p) % ZYAN_CACHING_ALIGNMENT, 0u);
+        memset(p, 0xCC, size);
+        ASSERT_EQ(allocator->deallocate(allocator, p, 1, size), ZYAN_STATUS_SUCCESS);
+    }
+
+    // Recently released blocks are reused first
+    void* a;
+    void* b;
+    ASSERT_EQ(allocator->allocate(allocator, &a, sizeof(ZyanU64), 4), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->deallocate(allocator, a, sizeof(ZyanU64), 4), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->allocate(allocator, &b, sizeof(ZyanU64), 4), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(a, b);
+    ASSERT_EQ(allocator->deallocate(allocator, b, sizeof(ZyanU64), 4), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanCachingFlush(&caching), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanCachingDestroy(&caching), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(CachingAllocatorTest, Reallocate)
+{
+    ZyanCachingAllocator caching;
+    ASSERT_EQ(ZyanCachingInit(&caching), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &caching.allocator;
+
+    void* p;
+    ASSERT_EQ(allocator->allocate(allocator, &p, sizeof(ZyanU32), 1), ZYAN_STATUS_SUCCESS);
+    static_cast<ZyanU32*>(p)[0] = 0;
+    for (ZyanU32 i = 1; i < 100000; i = i * 3 / 2 + 1)
+    {
+        ASSERT_EQ(allocator->reallocate(allocator, &p, sizeof(ZyanU32), i + 1),
+            ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(static_cast<ZyanU32*>(p)[0], 0u);
+    }
+    ASSERT_EQ(allocator->reallocate(allocator, &p, sizeof(ZyanU32), 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(static_cast<ZyanU32*>(p)[0], 0u);
+    ASSERT_EQ(allocator->deallocate(allocator, p, sizeof(ZyanU32), 1), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanCachingDestroy(&caching), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(CachingAllocatorTest, CrossThread)
+{
+    ZyanCachingAllocator caching;
+    ASSERT_EQ(ZyanCachingInit(&caching), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &caching.allocator;
+
+    // Blocks allocated by the producer are released by the consumer
+    std::vector<void*> blocks(10000);
+    std::thread producer([&]()
+    {
+        for (ZyanUSize i = 0; i < blocks.size(); ++i)
+        {
+            ASSERT_EQ(allocator->allocate(allocator, &blocks[i], 1, 8 + i % 512),
+                ZYAN_STATUS_SUCCESS);
+            memset(blocks[i], static_cast<int>(i), 8 + i % 512);
+        }
+    });
+    producer.join();
+
+    std::thread consumer([&]()
+    {
+        for (ZyanUSize i = 0; i < blocks.size(); ++i)
+        {
+            ASSERT_EQ(static_cast<ZyanU8*>(blocks[i])[0], static_cast<ZyanU8>(i));
+            ASSERT_EQ(allocator->deallocate(allocator, blocks[i], 1, 8 + i % 512),
+                ZYAN_STATUS_SUCCESS);
+        }
+    });
+    consumer.join();
+
+    // The released blocks are available to other threads
+    for (ZyanUSize i = 0; i < blocks.size(); ++i)
+    {
+        ASSERT_EQ(allocator->allocate(allocator, &blocks[i], 1, 8 + i % 512),
+            ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanUSize i = 0; i < blocks.size(); ++i)
+    {
+        ASSERT_EQ(allocator->deallocate(allocator, blocks[i], 1, 8 + i % 512),
+            ZYAN_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(ZyanCachingDestroy(&caching), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* TrackingAllocator                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(TrackingAllocatorTest, Statistics)
+{
+    ZyanTrackingAllocator tracking;
+
+    EXPECT_EQ(ZyanTrackingInitEx(&tracking, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanTrackingInit(&tracking), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &tracking.allocator;
+
+    void* a;
+    void* b;
+    ASSERT_EQ(allocator->allocate(allocator, &a, 4, 25), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->allocate(allocator, &b, 1, 3), ZYAN_STATUS_SUCCESS);
+    memset(a, 0xAB, 100);
+    ASSERT_EQ(allocator->reallocate(allocator, &a, 4, 1000), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(static_cast<ZyanU8*>(a)[99], 0xAB);
+    ASSERT_EQ(allocator->deallocate(allocator, b, 1, 3), ZYAN_STATUS_SUCCESS);
+
+    ZyanTrackingStatistics statistics;
+    EXPECT_EQ(ZyanTrackingGetStatistics(nullptr, &statistics), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanTrackingGetStatistics(&tracking, &statistics), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(statistics.allocation_count, 2u);
+    EXPECT_EQ(statistics.reallocation_count, 1u);
+    EXPECT_EQ(statistics.deallocation_count, 1u);
+    EXPECT_EQ(statistics.bytes_requested, 4103u);
+    EXPECT_EQ(statistics.bytes_live, 4000u);
+    EXPECT_EQ(statistics.bytes_peak, 4003u);
+    EXPECT_LE(statistics.reallocation_move_count, 1u);
+    EXPECT_EQ(statistics.bytes_copied, statistics.reallocation_move_count * 100);
+    EXPECT_EQ(statistics.histogram[2], 1u);  // 3
+    EXPECT_EQ(statistics.histogram[7], 1u);  // 100
+    EXPECT_EQ(statistics.histogram[12], 1u); // 4000
+
+    // Resetting keeps track of the memory blocks that are still alive
+    ASSERT_EQ(ZyanTrackingReset(&tracking), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->deallocate(allocator, a, 4, 1000), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanTrackingGetStatistics(&tracking, &statistics), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(statistics.allocation_count, 0u);
+    EXPECT_EQ(statistics.deallocation_count, 1u);
+    EXPECT_EQ(statistics.bytes_live, 0u);
+    EXPECT_EQ(statistics.bytes_peak, 4000u);
+    for (ZyanUSize i = 0; i < ZYAN_TRACKING_HISTOGRAM_SIZE; ++i)
+    {
+        EXPECT_EQ(statistics.histogram[i], 0u);
+    }
+}
+
+TEST(TrackingAllocatorTest, ReallocationMoves)
+{
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 4096), ZYAN_STATUS_SUCCESS);
+    ZyanTrackingAllocator tracking;
+    ASSERT_EQ(ZyanTrackingInitEx(&tracking, &arena.allocator), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &tracking.allocator;
+
+    // The arena grows the most recent block in place
+    void* a;
+    void* b;
+    ASSERT_EQ(allocator->allocate(allocator, &a, 1, 64), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->reallocate(allocator, &a, 1, 128), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->allocate(allocator, &b, 1, 16), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(allocator->reallocate(allocator, &a, 1, 256), ZYAN_STATUS_SUCCESS);
+
+    ZyanTrackingStatistics statistics;
+    ASSERT_EQ(ZyanTrackingGetStatistics(&tracking, &statistics), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(statistics.reallocation_count, 2u);
+    EXPECT_EQ(statistics.reallocation_move_count, 1u);
+    EXPECT_EQ(statistics.bytes_copied, 128u);
+    EXPECT_EQ(statistics.bytes_live, 272u);
+
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(TrackingAllocatorTest, Containers)
+{
+    ZyanTrackingAllocator tracking;
+    ASSERT_EQ(ZyanTrackingInit(&tracking), ZYAN_STATUS_SUCCESS);
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInitEx(&vector, sizeof(ZyanU32), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &tracking.allocator,
+        ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD),
+        ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+
+    ZyanTrackingStatistics statistics;
+    ASSERT_EQ(ZyanTrackingGetStatistics(&tracking, &statistics), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(statistics.allocation_count, 1u);
+    EXPECT_GT(statistics.reallocation_count, 0u);
+    EXPECT_LT(statistics.reallocation_count, 16u);
+    EXPECT_EQ(statistics.bytes_live, vector.capacity * sizeof(ZyanU32));
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanTrackingGetStatistics(&tracking, &statistics), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(statistics.deallocation_count, 1u);
+    EXPECT_EQ(statistics.bytes_live, 0u);
+}
+
+TEST(TrackingAllocatorTest, Threads)
+{
+    ZyanTrackingAllocator tracking;
+    ASSERT_EQ(ZyanTrackingInit(&tracking), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &tracking.allocator;
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.emplace_back([allocator]()
+        {
+            for (int j = 0; j < 10000; ++j)
+            {
+                void* p;
+                ASSERT_EQ(allocator->allocate(allocator, &p, 1, 32), ZYAN_STATUS_SUCCESS);
+                ASSERT_EQ(allocator->deallocate(allocator, p, 1, 32), ZYAN_STATUS_SUCCESS);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ZyanTrackingStatistics statistics;
+    ASSERT_EQ(ZyanTrackingGetStatistics(&tracking, &statistics), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(statistics.allocation_count, 40000u);
+    EXPECT_EQ(statistics.deallocation_count, 40000u);
+    EXPECT_EQ(statistics.bytes_requested, 40000u * 32);
+    EXPECT_EQ(statistics.histogram[6], 40000u);
+    EXPECT_EQ(statistics.bytes_live, 0u);
+    EXPECT_GE(statistics.bytes_peak, 32u);
+    EXPECT_LE(statistics.bytes_peak, 4u * 32);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* HugePageAllocator                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(HugePageAllocatorTest, VirtualAllocHuge)
+{
+    const ZyanU32 huge_page_size = ZyanMemoryGetSystemHugePageSize();
+    const ZyanUSize size = huge_page_size ? 2 * huge_page_size : 4096;
+
+    void* p;
+    ZyanU32 page_size;
+    EXPECT_EQ(ZyanMemoryVirtualAllocHuge(nullptr, size, ZYAN_PAGE_READWRITE, &page_size),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanMemoryVirtualAllocHuge(&p, size, ZYAN_PAGE_READWRITE, &page_size),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_TRUE((page_size == huge_page_size) || (page_size == ZyanMemoryGetSystemPageSize()));
+    EXPECT_EQ(reinterpret_cast<ZyanUPointer>(p) % page_size, 0u);
+
+    memset(p, 0xCD, size);
+    EXPECT_EQ(static_cast<ZyanU8*>(p)[size - 1], 0xCD);
+    EXPECT_EQ(ZyanMemoryVirtualFree(p, size), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HugePageAllocatorTest, Threshold)
+{
+    ZyanHugePageAllocator huge;
+    EXPECT_EQ(ZyanHugePageInitEx(&huge, 0, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanHugePageInit(&huge, 64 * 1024), ZYAN_STATUS_SUCCESS);
+    ZyanAllocator* const allocator = &huge.allocator;
+
+    ZyanU32 page_size;
+    ASSERT_EQ(ZyanHugePageGetPageSize(&huge, &page_size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(page_size, ZyanMemoryGetSystemHugePageSize());
+
+    // The block moves between the backing allocator and a huge page region in both directions
+    void* p;
+    ASSERT_EQ(allocator->allocate(allocator, &p, 1, 1000), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(reinterpret_cast<ZyanUPointer>(p) % ZYAN_HUGE_PAGE_ALIGNMENT, 0u);
+    memset(p, 0x11, 1000);
+    ASSERT_EQ(allocator->reallocate(allocator, &p, 1, 1024 * 1024), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(static_cast<ZyanU8*>(p)[999], 0x11);
+    memset(p, 0x22, 1024 * 1024);
+    const void* const before = p;
+    ASSERT_EQ(allocator->reallocate(allocator, &p, 1, 512 * 1024), ZYAN_STATUS_SUCCESS);
+    if (page_size)
+    {
+        EXPECT_EQ(p, before);
+    }
+    ASSERT_EQ(allocator->reallocate(allocator, &p, 1, 3 * 1024 * 1024), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(static_cast<ZyanU8*>(p)[512 * 1024 - 1], 0x22);
+    ASSERT_EQ(allocator->reallocate(allocator, &p, 1, 100), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(static_cast<ZyanU8*>(p)[99], 0x22);
+    ASSERT_EQ(allocator->deallocate(allocator, p, 1, 100), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HugePageAllocatorTest, Containers)
+{
+    ZyanHugePageAllocator huge;
+    ASSERT_EQ(ZyanHugePageInit(&huge, 0), ZYAN_STATUS_SUCCESS);
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInitEx(&vector, sizeof(ZyanU32), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), &huge.allocator,
+        ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD),
+        ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0; i < 2000000; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanU32 i = 0; i < 2000000; i += 997)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU32, &vector, i), i);
+    }
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* ArenaAllocator                                                                                 */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Builds `count` short-lived vectors of `ZyanU32` elements using the given `allocator`.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   count       The number of vectors.
+ */
+static void BuildVectors(ZyanAllocator* allocator, ZyanUSize count)
+{
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ZyanVector vector;
+        ASSERT_EQ(ZyanVectorInitEx(&vector, sizeof(ZyanU32), 0,
+            reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), allocator,
+            ZYAN_VECTOR_DEFAULT_GROWTH_FACTOR, ZYAN_VECTOR_DEFAULT_SHRINK_THRESHOLD),
+            ZYAN_STATUS_SUCCESS);
+        for (ZyanU32 j = 0; j < 64; ++j)
+        {
+            ASSERT_EQ(ZyanVectorPushBack(&vector, &j), ZYAN_STATUS_SUCCESS);
+        }
+        ASSERT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+/**
+ * @brief   Allocates `count` small memory blocks using the given `allocator` and releases them
+ *          afterwards.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   blocks      A buffer that receives the allocated blocks.
+ */
+static void AllocateBlocks(ZyanAllocator* allocator, std::vector<void*>& blocks)
+{
+    for (ZyanUSize i = 0; i < blocks.size(); ++i)
+    {
+        ASSERT_EQ(allocator->allocate(allocator, &blocks[i], 1, 16 + (i & 63)),
+            ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanUSize i = 0; i < blocks.size(); ++i)
+    {
+        ASSERT_EQ(allocator->deallocate(allocator, blocks[i], 1, 16 + (i & 63)),
+            ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(AllocatorBenchmark, DISABLED_ArenaVsDefault)
+{
+    std::vector<void*> blocks(100000);
+    static const ZyanUSize rounds = 50;
+
+    Benchmark("default allocator (small blocks)", [&]()
+    {
+        for (ZyanUSize i = 0; i < rounds; ++i)
+        {
+            AllocateBlocks(ZyanAllocatorDefault(), blocks);
+        }
+    });
+
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 0), ZYAN_STATUS_SUCCESS);
+    Benchmark("arena allocator (small blocks)", [&]()
+    {
+        for (ZyanUSize i = 0; i < rounds; ++i)
+        {
+            AllocateBlocks(&arena.allocator, blocks);
+            ASSERT_EQ(ZyanArenaReset(&arena), ZYAN_STATUS_SUCCESS);
+        }
+    });
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(AllocatorBenchmark, DISABLED_ArenaVsDefaultVector)
+{
+    static const ZyanUSize count = 1000000;
+
+    Benchmark("default allocator (vectors)", [&]()
+    {
+        BuildVectors(ZyanAllocatorDefault(), count);
+    });
+
+    ZyanArenaAllocator arena;
+    ASSERT_EQ(ZyanArenaInit(&arena, 0), ZYAN_STATUS_SUCCESS);
+    Benchmark("arena allocator (vectors)", [&]()
+    {
+        for (ZyanUSize i = 0; i < count / 1000; ++i)
+        {
+            BuildVectors(&arena.allocator, 1000);
+            ASSERT_EQ(ZyanArenaReset(&arena), ZYAN_STATUS_SUCCESS);
+        }
+    });
+    EXPECT_EQ(ZyanArenaDestroy(&arena), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* PoolAllocator                                                                                  */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Fills a list of `ZyanU64` values using the given `allocator`, iterates it and pops all
+ *          elements afterwards.
+ *
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ * @param   count       The number of list elements.
+ */
+static void BuildList(ZyanAllocator* allocator, ZyanU64 count)
+{
+    ZyanList list;
+    ASSERT_EQ(ZyanListInitEx(&list, sizeof(ZyanU64),
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), allocator), ZYAN_STATUS_SUCCESS);
+    for (ZyanU64 i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(ZyanListPushBack(&list, &i), ZYAN_STATUS_SUCCESS);
+    }
+
+    ZyanU64 sum = 0;
+    const ZyanListNode* node;
+    ASSERT_EQ(ZyanListGetHeadNode(&list, &node), ZYAN_STATUS_SUCCESS);
+    while (node)
+    {
+        sum += ZYAN_LIST_GET(ZyanU64, node);
+        ASSERT_EQ(ZyanListGetNextNode(&node), ZYAN_STATUS_SUCCESS);
+    }
+    ASSERT_EQ(sum, count * (count - 1) / 2);
+
+    while (count--)
+    {
+        ASSERT_EQ(ZyanListPopBack(&list), ZYAN_STATUS_SUCCESS);
+    }
+    ASSERT_EQ(ZyanListDestroy(&list), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(AllocatorBenchmark, DISABLED_PoolVsDefault)
+{
+    static const ZyanU64 count = 1000000;
+
+    Benchmark("default allocator (list)", [&]()
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            BuildList(ZyanAllocatorDefault(), count);
+        }
+    });
+
+    ZyanPoolAllocator pool;
+    ASSERT_EQ(ZyanPoolInit(&pool, ZYAN_LIST_NODE_SIZE(sizeof(ZyanU64))), ZYAN_STATUS_SUCCESS);
+    Benchmark("pool allocator (list)", [&]()
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            BuildList(&pool.allocator, count);
+        }
+    });
+    EXPECT_EQ(ZyanPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* CachingAllocator                                                                               */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Runs an alloc/free workload on `thread_count` threads concurrently.
+ *
+ * @param   allocator       A pointer to the `ZyanAllocator` instance.
+ * @param   thread_count    The number of threads.
+ */
+static void RunThreadedWorkload(ZyanAllocator* allocator, unsigned thread_count)
+{
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([allocator]()
+        {
+            std::vector<void*> blocks(256);
+            for (ZyanUSize round = 0; round < 2000; ++round)
+            {
+                for (ZyanUSize i = 0; i < blocks.size(); ++i)
+                {
+                    ASSERT_EQ(allocator->allocate(allocator, &blocks[i], 1, 16 + (i * 40) % 1024),
+                        ZYAN_STATUS_SUCCESS);
+                }
+                for (ZyanUSize i = 0; i < blocks.size(); ++i)
+                {
+                    ASSERT_EQ(allocator->deallocate(allocator, blocks[i], 1,
+                        16 + (i * 40) % 1024), ZYAN_STATUS_SUCCESS);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+TEST(AllocatorBenchmark, DISABLED_CachingVsDefault)
+{
+    const unsigned thread_count = ZYAN_MAX(1u, std::thread::hardware_concurrency());
+
+    ZyanCachingAllocator caching;
+    ASSERT_EQ(ZyanCachingInit(&caching), ZYAN_STATUS_SUCCESS);
+
+    for (unsigned threads = 1; threads <= thread_count; threads *= 2)
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "default allocator (%u threads)", threads);
+        Benchmark(name, [&]()
+        {
+            RunThreadedWorkload(ZyanAllocatorDefault(), threads);
+        });
+        std::snprintf(name, sizeof(name), "caching allocator (%u threads)", threads);
+        Benchmark(name, [&]()
+        {
+            RunThreadedWorkload(&caching.allocator, threads);
+        });
+    }
+
+    EXPECT_EQ(ZyanCachingDestroy(&caching), ZYAN_STATUS_SUCCESS);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ---------------------------------------------------------------------------------------------- */
+/* HugePageAllocator                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+/**
+ * @brief   Reads random elements of a 1 GiB vector that is allocated by the given `allocator`.
+ *
+ * @param   name        The name of the benchmark.
+ * @param   allocator   A pointer to the `ZyanAllocator` instance.
+ */
+static void RunRandomAccess(const char* name, ZyanAllocator* allocator)
+{
+    static const ZyanUSize count = 128 * 1024 * 1024;
+    static const ZyanUSize accesses = 50000000;
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInitEx(&vector, sizeof(ZyanU64), count,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), allocator, 1, 0), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorResize(&vector, count), ZYAN_STATUS_SUCCESS);
+    ZyanU64* const data = static_cast<ZyanU64*>(vector.data);
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        data[i] = i;
+    }
+
+    ZyanU64 sum = 0;
+    Benchmark(name, [&]()
+    {
+        ZyanU64 state = 88172645463325252ull;
+        for (ZyanUSize i = 0; i < accesses; ++i)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            sum += data[state & (count - 1)];
+        }
+    });
+    EXPECT_NE(sum, 0u);
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(AllocatorBenchmark, DISABLED_HugePageRandomAccess)
+{
+    RunRandomAccess("default allocator (random access)", ZyanAllocatorDefault());
+
+    ZyanHugePageAllocator huge;
+    ASSERT_EQ(ZyanHugePageInit(&huge, 0), ZYAN_STATUS_SUCCESS);
+    ZyanU32 page_size;
+    ASSERT_EQ(ZyanHugePageGetPageSize(&huge, &page_size), ZYAN_STATUS_SUCCESS);
+    std::printf("huge page size: %u KiB\n", page_size / 1024);
+    RunRandomAccess("huge page allocator (random access)", &huge.allocator);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    time_t t;
+    srand(static_cast<unsigned>(time(&t)));
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,79 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanBitset` implementation.
+ */
+
+#include <gtest/gtest.h>
+#include <Zycore/Bitset.h>
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(BitsetTest, PartialBytes)
+{
+    // Bit counts that are not a multiple of 8 need an additional (partially used) byte
+    for (ZyanUSize count = 1; count <= 64; ++count)
+    {
+        ZyanBitset bitset;
+        ASSERT_EQ(ZyanBitsetInit(&bitset, count), ZYAN_STATUS_SUCCESS);
+
+        ZyanUSize size;
+        ASSERT_EQ(ZyanBitsetGetSizeBytes(&bitset, &size), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(size, (count + 7) / 8);
+
+        ASSERT_EQ(ZyanBitsetSet(&bitset, count - 1), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanBitsetTest(&bitset, count - 1), ZYAN_STATUS_TRUE);
+        ZyanUSize bits;
+        ASSERT_EQ(ZyanBitsetCount(&bitset, &bits), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(bits, static_cast<ZyanUSize>(1));
+
+        EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+    }
+
+    // A buffer of 2 bytes is large enough for 9 bits
+    ZyanU8 buffer[2] = { 0, 0 };
+    ZyanBitset bitset;
+    ASSERT_EQ(ZyanBitsetInitBuffer(&bitset, 9, buffer, sizeof(buffer)), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanBitsetSet(&bitset, 8), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(buffer[1], 0x80);
+    EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,296 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the hash functions.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <unordered_set>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/Hash.h>
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns a buffer filled with pseudo-random bytes.
+ *
+ * @param   size    The size of the buffer.
+ *
+ * @return  The buffer.
+ */
+static std::vector<ZyanU8> RandomBytes(std::size_t size)
+{
+    std::mt19937 gen(1337);
+    std::vector<ZyanU8> result(size);
+    for (auto& byte : result)
+    {
+        byte = static_cast<ZyanU8>(gen());
+    }
+    return result;
+}
+
+/**
+ * @brief   The FNV-1a hash function for comparison.
+ *
+ * @param   data    A pointer to the data.
+ * @param   size    The size of the data in bytes.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 Fnv1a(const ZyanU8* data, ZyanUSize size)
+{
+    ZyanU64 hash = 14695981039346656037ULL;
+    for (ZyanUSize i = 0; i < size; ++i)
+    {
+        hash = (hash ^ data[i]) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(HashTest, Distinct)
+{
+    // All prefixes of a buffer must produce different hash values, including the empty one
+    const auto data = RandomBytes(1024);
+    std::unordered_set<ZyanU64> hashes;
+    for (std::size_t size = 0; size <= data.size(); ++size)
+    {
+        EXPECT_TRUE(hashes.insert(ZyanHash(data.data(), size, 0)).second) << size;
+    }
+
+    // Flipping any bit changes the hash value
+    auto copy = data;
+    const ZyanU64 expected = ZyanHash(copy.data(), 100, 0);
+    for (std::size_t bit = 0; bit < 100 * 8; ++bit)
+    {
+        copy[bit / 8] ^= static_cast<ZyanU8>(1 << (bit % 8));
+        EXPECT_NE(ZyanHash(copy.data(), 100, 0), expected) << bit;
+        copy[bit / 8] ^= static_cast<ZyanU8>(1 << (bit % 8));
+    }
+
+    // The seed changes the hash value
+    EXPECT_NE(ZyanHash(data.data(), 0, 0), ZyanHash(data.data(), 0, 1));
+    EXPECT_NE(ZyanHash(data.data(), 100, 0), ZyanHash(data.data(), 100, 1));
+    EXPECT_EQ(ZyanHash(nullptr, 0, 0), ZyanHash(data.data(), 0, 0));
+}
+
+TEST(HashTest, Incremental)
+{
+    const auto data = RandomBytes(1024);
+    std::mt19937 gen(42);
+
+    for (std::size_t size = 0; size <= 300; ++size)
+    {
+        const ZyanU64 expected = ZyanHash(data.data(), size, 1234);
+
+        // Random chunks
+        ZyanHashState state;
+        ASSERT_EQ(ZyanHashInit(&state, 1234), ZYAN_STATUS_SUCCESS);
+        for (std::size_t offset = 0; offset < size;)
+        {
+            const std::size_t count = std::min<std::size_t>(size - offset, gen() % 70);
+            ASSERT_EQ(ZyanHashUpdate(&state, data.data() + offset, count), ZYAN_STATUS_SUCCESS);
+            offset += count;
+        }
+        ZyanU64 hash;
+        ASSERT_EQ(ZyanHashFinalize(&state, &hash), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(hash, expected) << size;
+
+        // Byte by byte, finalizing in between
+        ASSERT_EQ(ZyanHashInit(&state, 1234), ZYAN_STATUS_SUCCESS);
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            ASSERT_EQ(ZyanHashUpdate(&state, data.data() + i, 1), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanHashFinalize(&state, &hash), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(hash, ZyanHash(data.data(), i + 1, 1234));
+        }
+    }
+
+    // A single large update followed by a small one
+    ZyanHashState state;
+    ASSERT_EQ(ZyanHashInit(&state, 0), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanHashUpdate(&state, data.data(), 1000), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanHashUpdate(&state, data.data() + 1000, 24), ZYAN_STATUS_SUCCESS);
+    ZyanU64 hash;
+    ASSERT_EQ(ZyanHashFinalize(&state, &hash), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(hash, ZyanHash(data.data(), 1024, 0));
+
+    EXPECT_EQ(ZyanHashUpdate(&state, nullptr, 1), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanHashUpdate(&state, nullptr, 0), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HashTest, CaseInsensitive)
+{
+    auto data = RandomBytes(1024);
+    auto folded = data;
+    for (auto& byte : folded)
+    {
+        byte |= 0x20;
+    }
+
+    for (std::size_t size = 0; size <= 200; ++size)
+    {
+        const ZyanU64 expected = ZyanHash(folded.data(), size, 7);
+        ASSERT_EQ(ZyanHashI(data.data(), size, 7), expected) << size;
+
+        // Case-insensitive and case-sensitive updates can be mixed
+        ZyanHashState state;
+        ASSERT_EQ(ZyanHashInit(&state, 7), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanHashUpdateI(&state, data.data(), size / 2), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanHashUpdate(&state, folded.data() + size / 2, size - size / 2),
+            ZYAN_STATUS_SUCCESS);
+        ZyanU64 hash;
+        ASSERT_EQ(ZyanHashFinalize(&state, &hash), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(hash, expected) << size;
+    }
+    ZyanHashState state;
+    ASSERT_EQ(ZyanHashInit(&state, 7), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanHashUpdateI(&state, data.data(), 1000), ZYAN_STATUS_SUCCESS);
+    ZyanU64 hash;
+    ASSERT_EQ(ZyanHashFinalize(&state, &hash), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(hash, ZyanHash(folded.data(), 1000, 7));
+}
+
+TEST(HashTest, String)
+{
+    ZyanStringView a;
+    ZyanStringView b;
+    ZyanStringView c;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&a, "VPBROADCASTMW2D zmm1, k1"), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&b, "vpbroadcastmw2d ZMM1, K1"), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&c, "vpbroadcastmw2d zmm2, k1"), ZYAN_STATUS_SUCCESS);
+
+    ZyanU64 ha;
+    ZyanU64 hb;
+    ZyanU64 hc;
+    ASSERT_EQ(ZyanHashString(&a, 0, &ha), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanHashString(&b, 0, &hb), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ha, ZyanHash("VPBROADCASTMW2D zmm1, k1", 24, 0));
+    EXPECT_NE(ha, hb);
+
+    // Strings that are equal according to `ZyanStringCompareI` have the same hash value
+    ZyanI32 result;
+    ASSERT_EQ(ZyanStringCompareI(&a, &b, &result), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(ZyanStringCompareI(&a, &c, &result), ZYAN_STATUS_FALSE);
+    ASSERT_EQ(ZyanHashStringI(&a, 0, &ha), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanHashStringI(&b, 0, &hb), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanHashStringI(&c, 0, &hc), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ha, hb);
+    EXPECT_NE(ha, hc);
+
+    EXPECT_EQ(ZyanHashString(nullptr, 0, &ha), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanHashStringI(&a, 0, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(HashTest, Mixers)
+{
+    std::unordered_set<ZyanU32> hashes32;
+    std::unordered_set<ZyanU64> hashes64;
+    for (ZyanU32 i = 0; i < 100000; ++i)
+    {
+        EXPECT_TRUE(hashes32.insert(ZyanHashU32(i)).second);
+        EXPECT_TRUE(hashes64.insert(ZyanHashU64(static_cast<ZyanU64>(i) << 40)).second);
+    }
+
+    // Sequential inputs are spread across all bits
+    ZyanU64 ones = 0;
+    for (ZyanU64 i = 0; i < 64; ++i)
+    {
+        ones |= ZyanHashU64(i);
+    }
+    EXPECT_EQ(ones, ~static_cast<ZyanU64>(0));
+
+    EXPECT_NE(ZyanHashCombine(ZyanHashU64(1), ZyanHashU64(2)),
+        ZyanHashCombine(ZyanHashU64(2), ZyanHashU64(1)));
+}
+
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+TEST(HashBenchmark, DISABLED_Throughput)
+{
+    static const std::size_t sizes[] = { 8, 16, 32, 64, 256, 1024, 4096, 65536, 1048576 };
+    static const std::size_t total = 256 * 1024 * 1024;
+
+    const auto data = RandomBytes(1048576 + 64);
+    for (const auto size : sizes)
+    {
+        const std::size_t iterations = total / size;
+
+        ZyanU64 checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            checksum += ZyanHash(data.data() + (i & 63), size, 0);
+        }
+        auto end = std::chrono::steady_clock::now();
+        const double zyan = std::chrono::duration<double>(end - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            checksum += ZyanHashI(data.data() + (i & 63), size, 0);
+        }
+        end = std::chrono::steady_clock::now();
+        const double zyan_i = std::chrono::duration<double>(end - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < iterations; ++i)
+        {
+            checksum += Fnv1a(data.data() + (i & 63), size);
+        }
+        end = std::chrono::steady_clock::now();
+        const double fnv = std::chrono::duration<double>(end - start).count();
+
+        const double gb = static_cast<double>(iterations * size) / 1e9;
+        std::printf("%8zu bytes: ZyanHash %7.2f GB/s, ZyanHashI %7.2f GB/s, FNV-1a %7.2f GB/s "
+            "(%016llx)\n", size, gb / zyan, gb / zyan_i, gb / fnv,
+            static_cast<unsigned long long>(checksum));
+    }
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
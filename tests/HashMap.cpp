@@ -0,0 +1,524 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanHashMap` implementation.
+ */
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/HashMap.h>
+#include "Benchmark.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Checks that the hash map contains the same entries as the given reference.
+ *
+ * @param   map         A pointer to the `ZyanHashMap` instance.
+ * @param   expected    The expected entries.
+ */
+static void ExpectContents(const ZyanHashMap* map,
+    const std::unordered_map<ZyanU64, ZyanU32>& expected)
+{
+    ZyanUSize size;
+    ASSERT_EQ(ZyanHashMapGetSize(map, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, expected.size());
+
+    for (const auto& entry : expected)
+    {
+        const void* value;
+        ASSERT_EQ(ZyanHashMapFind(map, &entry.first, &value), ZYAN_STATUS_TRUE);
+        ASSERT_EQ(*static_cast<const ZyanU32*>(value), entry.second);
+    }
+
+    // Every entry must be visited exactly once
+    std::unordered_map<ZyanU64, ZyanU32> visited;
+    ZyanUSize iterator = 0;
+    const void* key;
+    void* value;
+    while (ZyanHashMapIterate(map, &iterator, &key, &value) == ZYAN_STATUS_TRUE)
+    {
+        ASSERT_TRUE(visited.emplace(*static_cast<const ZyanU64*>(key),
+            *static_cast<const ZyanU32*>(value)).second);
+    }
+    ASSERT_EQ(visited, expected);
+}
+
+/**
+ * @brief   A hash function for `const char*` keys.
+ *
+ * @param   key A pointer to the key.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 HashCString(const void* key)
+{
+    ZyanU64 hash = 14695981039346656037ULL;
+    for (const char* c = *static_cast<const char* const*>(key); *c; ++c)
+    {
+        hash = (hash ^ static_cast<ZyanU8>(*c)) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief   An equality function for `const char*` keys.
+ *
+ * @param   left    A pointer to the first key.
+ * @param   right   A pointer to the second key.
+ *
+ * @return  `ZYAN_TRUE`, if the strings are equal or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool EqualsCString(const void* left, const void* right)
+{
+    return std::strcmp(*static_cast<const char* const*>(left),
+        *static_cast<const char* const*>(right)) ? ZYAN_FALSE : ZYAN_TRUE;
+}
+
+/**
+ * @brief   A hash function that maps all keys to the same value.
+ *
+ * @param   key A pointer to the key.
+ *
+ * @return  The hash value.
+ */
+static ZyanU64 HashConstant(const void* key)
+{
+    ZYAN_UNUSED(key);
+    return 42;
+}
+
+/**
+ * @brief   The keys passed to `RecordEntry`.
+ */
+static std::vector<ZyanU64> destroyed_keys;
+
+/**
+ * @brief   A destructor that records the keys of the destroyed entries.
+ *
+ * @param   key     A pointer to the key of the entry.
+ * @param   value   A pointer to the value of the entry.
+ */
+static void RecordEntry(void* key, void* value)
+{
+    EXPECT_EQ(*static_cast<ZyanU64*>(key) * 2, *static_cast<ZyanU64*>(value));
+    destroyed_keys.push_back(*static_cast<ZyanU64*>(key));
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(HashMapTest, InitAndDestroy)
+{
+    ZyanHashMap map;
+    EXPECT_EQ(ZyanHashMapInit(nullptr, 8, 8, 0, nullptr, nullptr, nullptr),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanHashMapInit(&map, 0, 8, 0, nullptr, nullptr, nullptr),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanHashMapInitEx(&map, 8, 8, 0, nullptr, nullptr, nullptr, nullptr),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+
+    ASSERT_EQ(ZyanHashMapInit(&map, sizeof(ZyanU64), sizeof(ZyanU32), 1000, nullptr, nullptr,
+        nullptr), ZYAN_STATUS_SUCCESS);
+    ZyanUSize value;
+    ASSERT_EQ(ZyanHashMapGetCapacity(&map, &value), ZYAN_STATUS_SUCCESS);
+    EXPECT_GE(value, static_cast<ZyanUSize>(1000));
+    ASSERT_EQ(ZyanHashMapGetSize(&map, &value), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(value, static_cast<ZyanUSize>(0));
+
+    // Entries are laid out like a struct
+    EXPECT_EQ(map.value_offset, static_cast<ZyanUSize>(8));
+    EXPECT_EQ(map.entry_size, static_cast<ZyanUSize>(16));
+
+    ZyanUSize iterator = 0;
+    EXPECT_EQ(ZyanHashMapIterate(&map, &iterator, nullptr, nullptr), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HashMapTest, InsertFindErase)
+{
+    ZyanHashMap map;
+    ASSERT_EQ(ZyanHashMapInit(&map, sizeof(ZyanU64), sizeof(ZyanU32), 0, nullptr, nullptr,
+        nullptr), ZYAN_STATUS_SUCCESS);
+
+    std::unordered_map<ZyanU64, ZyanU32> reference;
+    std::mt19937 gen(1337);
+
+    // Small key range to get lots of replacements and failed lookups
+    std::uniform_int_distribution<ZyanU64> key_dist(0, 5000);
+    for (ZyanU32 i = 0; i < 50000; ++i)
+    {
+        const ZyanU64 key = key_dist(gen);
+        switch (gen() % 4)
+        {
+        case 0:
+        case 1:
+        {
+            const ZyanStatus expected = reference.count(key) ?
+                ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE;
+            ASSERT_EQ(ZyanHashMapInsert(&map, &key, &i), expected);
+            reference[key] = i;
+            break;
+        }
+        case 2:
+        {
+            const ZyanStatus expected = reference.erase(key) ?
+                ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+            ASSERT_EQ(ZyanHashMapErase(&map, &key), expected);
+            break;
+        }
+        case 3:
+        {
+            const void* value;
+            const auto it = reference.find(key);
+            if (it == reference.end())
+            {
+                ASSERT_EQ(ZyanHashMapFind(&map, &key, &value), ZYAN_STATUS_FALSE);
+            } else
+            {
+                ASSERT_EQ(ZyanHashMapFind(&map, &key, &value), ZYAN_STATUS_TRUE);
+                ASSERT_EQ(*static_cast<const ZyanU32*>(value), it->second);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+
+        if (!(i % 5000))
+        {
+            ASSERT_NO_FATAL_FAILURE(ExpectContents(&map, reference));
+        }
+    }
+    ASSERT_NO_FATAL_FAILURE(ExpectContents(&map, reference));
+
+    // Reserving keeps the entries
+    ZyanUSize capacity;
+    ASSERT_EQ(ZyanHashMapReserve(&map, 100000), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanHashMapGetCapacity(&map, &capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_GE(capacity, static_cast<ZyanUSize>(100000));
+    ASSERT_NO_FATAL_FAILURE(ExpectContents(&map, reference));
+
+    ASSERT_EQ(ZyanHashMapClear(&map), ZYAN_STATUS_SUCCESS);
+    reference.clear();
+    ASSERT_NO_FATAL_FAILURE(ExpectContents(&map, reference));
+
+    EXPECT_EQ(ZyanHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HashMapTest, Emplace)
+{
+    static const char* const words[] =
+    {
+        "mov", "add", "mov", "jmp", "push", "mov", "add", "pop", "push", "mov"
+    };
+
+    // String keys with custom callbacks and a word counter as value
+    ZyanHashMap map;
+    ASSERT_EQ(ZyanHashMapInit(&map, sizeof(const char*), sizeof(ZyanUSize), 0, &HashCString,
+        &EqualsCString, nullptr), ZYAN_STATUS_SUCCESS);
+
+    for (const char* word : words)
+    {
+        // Use a copy to make sure the strings are compared by value
+        const std::string copy = word;
+        const char* key = copy.c_str();
+        void* value;
+        const ZyanStatus status = ZyanHashMapEmplace(&map, &key, &value);
+        ASSERT_TRUE((status == ZYAN_STATUS_TRUE) || (status == ZYAN_STATUS_FALSE));
+        if (status == ZYAN_STATUS_TRUE)
+        {
+            // The stored key has to point to a string that outlives the hash map
+            *static_cast<const char**>(const_cast<void*>(
+                static_cast<const void*>(static_cast<ZyanU8*>(value) - map.value_offset))) = word;
+            *static_cast<ZyanUSize*>(value) = 0;
+        }
+        ++*static_cast<ZyanUSize*>(value);
+    }
+
+    static const std::pair<const char*, ZyanUSize> expected[] =
+    {
+        { "mov", 4 }, { "add", 2 }, { "jmp", 1 }, { "push", 2 }, { "pop", 1 }
+    };
+    ZyanUSize size;
+    ASSERT_EQ(ZyanHashMapGetSize(&map, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, ZYAN_ARRAY_LENGTH(expected));
+    for (const auto& entry : expected)
+    {
+        const void* value;
+        ASSERT_EQ(ZyanHashMapFind(&map, &entry.first, &value), ZYAN_STATUS_TRUE);
+        EXPECT_EQ(*static_cast<const ZyanUSize*>(value), entry.second);
+    }
+    const char* const missing = "nop";
+    EXPECT_EQ(ZyanHashMapFind(&map, &missing, nullptr), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HashMapTest, HashSet)
+{
+    ZyanHashMap set;
+    ASSERT_EQ(ZyanHashMapInit(&set, sizeof(ZyanU16), 0, 0, nullptr, nullptr, nullptr),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(set.entry_size, sizeof(ZyanU16));
+
+    for (ZyanU16 i = 0; i < 1000; ++i)
+    {
+        const ZyanU16 key = i % 100;
+        ASSERT_EQ(ZyanHashMapInsert(&set, &key, nullptr),
+            (i < 100) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+    }
+    ZyanUSize size;
+    ASSERT_EQ(ZyanHashMapGetSize(&set, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, static_cast<ZyanUSize>(100));
+
+    EXPECT_EQ(ZyanHashMapDestroy(&set), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HashMapTest, Collisions)
+{
+    ZyanHashMap map;
+    ASSERT_EQ(ZyanHashMapInit(&map, sizeof(ZyanU64), sizeof(ZyanU32), 0, &HashConstant, nullptr,
+        nullptr), ZYAN_STATUS_SUCCESS);
+
+    std::unordered_map<ZyanU64, ZyanU32> reference;
+    for (ZyanU32 i = 0; i < 200; ++i)
+    {
+        const ZyanU64 key = i * 7919;
+        ASSERT_EQ(ZyanHashMapInsert(&map, &key, &i), ZYAN_STATUS_TRUE);
+        reference[key] = i;
+    }
+    for (ZyanU64 i = 0; i < 200; i += 3)
+    {
+        const ZyanU64 key = i * 7919;
+        ASSERT_EQ(ZyanHashMapErase(&map, &key), ZYAN_STATUS_TRUE);
+        reference.erase(key);
+    }
+    ASSERT_NO_FATAL_FAILURE(ExpectContents(&map, reference));
+
+    // The probe distance is limited, so a hash function that maps all keys to the same value
+    // eventually fails instead of growing without bounds
+    ZyanStatus status = ZYAN_STATUS_SUCCESS;
+    for (ZyanU32 i = 200; (i < 1000) && ZYAN_SUCCESS(status); ++i)
+    {
+        const ZyanU64 key = i * 7919;
+        status = ZyanHashMapInsert(&map, &key, &i);
+    }
+    EXPECT_EQ(status, ZYAN_STATUS_INVALID_OPERATION);
+
+    EXPECT_EQ(ZyanHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HashMapTest, CustomBuffer)
+{
+    ZyanHashMap map;
+    alignas(ZyanU64) ZyanU8 buffer[1000];
+    EXPECT_EQ(ZyanHashMapInitCustomBuffer(&map, sizeof(ZyanU64), sizeof(ZyanU32), nullptr,
+        nullptr, buffer, 16, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanHashMapInitCustomBuffer(&map, sizeof(ZyanU64), sizeof(ZyanU32), nullptr,
+        nullptr, buffer, sizeof(buffer), nullptr), ZYAN_STATUS_SUCCESS);
+
+    // 1000 bytes fit 58 slots of 17 bytes, of which 32 are used
+    ZyanUSize capacity;
+    ASSERT_EQ(ZyanHashMapGetCapacity(&map, &capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(capacity, static_cast<ZyanUSize>(28));
+    EXPECT_EQ(ZyanHashMapReserve(&map, capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanHashMapReserve(&map, capacity + 1), ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+
+    std::unordered_map<ZyanU64, ZyanU32> reference;
+    for (ZyanU32 i = 0; i < capacity; ++i)
+    {
+        const ZyanU64 key = i * 0x100000000;
+        ASSERT_EQ(ZyanHashMapInsert(&map, &key, &i), ZYAN_STATUS_TRUE);
+        reference[key] = i;
+    }
+    const ZyanU64 key = 1;
+    const ZyanU32 value = 1;
+    EXPECT_EQ(ZyanHashMapInsert(&map, &key, &value), ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+    ASSERT_NO_FATAL_FAILURE(ExpectContents(&map, reference));
+
+    EXPECT_EQ(ZyanHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(HashMapTest, Destructor)
+{
+    ZyanHashMap map;
+    ASSERT_EQ(ZyanHashMapInit(&map, sizeof(ZyanU64), sizeof(ZyanU64), 0, nullptr, nullptr,
+        &RecordEntry), ZYAN_STATUS_SUCCESS);
+
+    destroyed_keys.clear();
+    for (ZyanU64 i = 0; i < 100; ++i)
+    {
+        const ZyanU64 value = i * 2;
+        ASSERT_EQ(ZyanHashMapInsert(&map, &i, &value), ZYAN_STATUS_TRUE);
+    }
+    EXPECT_TRUE(destroyed_keys.empty());
+
+    // Replacing an entry destroys the old one
+    const ZyanU64 key = 5;
+    const ZyanU64 value = 10;
+    ASSERT_EQ(ZyanHashMapInsert(&map, &key, &value), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(destroyed_keys, std::vector<ZyanU64>({ 5 }));
+
+    destroyed_keys.clear();
+    ASSERT_EQ(ZyanHashMapErase(&map, &key), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(ZyanHashMapErase(&map, &key), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(destroyed_keys, std::vector<ZyanU64>({ 5 }));
+
+    destroyed_keys.clear();
+    EXPECT_EQ(ZyanHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(destroyed_keys.size(), static_cast<std::size_t>(99));
+}
+
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+TEST(HashMapBenchmark, DISABLED_UnorderedMap)
+{
+    static const ZyanUSize count = 1000000;
+
+    std::mt19937_64 gen(1337);
+    std::vector<ZyanU64> keys(count);
+    std::vector<ZyanU64> missing(count);
+    for (auto& key : keys)
+    {
+        key = gen();
+    }
+    for (auto& key : missing)
+    {
+        key = gen();
+    }
+
+    ZyanU64 checksum_std = 0;
+    ZyanU64 checksum_zyan = 0;
+    {
+        std::unordered_map<ZyanU64, ZyanU64> map;
+        Benchmark("std::unordered_map insert", [&]()
+        {
+            for (ZyanUSize i = 0; i < count; ++i)
+            {
+                map[keys[i]] = i;
+            }
+        });
+        Benchmark("std::unordered_map find (hit)", [&]()
+        {
+            for (const auto key : keys)
+            {
+                checksum_std += map.find(key)->second;
+            }
+        });
+        Benchmark("std::unordered_map find (miss)", [&]()
+        {
+            for (const auto key : missing)
+            {
+                checksum_std += map.count(key);
+            }
+        });
+        Benchmark("std::unordered_map iterate", [&]()
+        {
+            for (const auto& entry : map)
+            {
+                checksum_std += entry.second;
+            }
+        });
+        Benchmark("std::unordered_map erase", [&]()
+        {
+            for (const auto key : keys)
+            {
+                map.erase(key);
+            }
+        });
+    }
+    {
+        ZyanHashMap map;
+        ASSERT_EQ(ZyanHashMapInit(&map, sizeof(ZyanU64), sizeof(ZyanU64), 0, nullptr, nullptr,
+            nullptr), ZYAN_STATUS_SUCCESS);
+        Benchmark("ZyanHashMapInsert", [&]()
+        {
+            for (ZyanU64 i = 0; i < count; ++i)
+            {
+                ZyanHashMapInsert(&map, &keys[i], &i);
+            }
+        });
+        Benchmark("ZyanHashMapFind (hit)", [&]()
+        {
+            for (const auto key : keys)
+            {
+                const void* value;
+                ZyanHashMapFind(&map, &key, &value);
+                checksum_zyan += *static_cast<const ZyanU64*>(value);
+            }
+        });
+        Benchmark("ZyanHashMapFind (miss)", [&]()
+        {
+            for (const auto key : missing)
+            {
+                checksum_zyan += (ZyanHashMapFind(&map, &key, nullptr) == ZYAN_STATUS_TRUE);
+            }
+        });
+        Benchmark("ZyanHashMapIterate", [&]()
+        {
+            ZyanUSize iterator = 0;
+            void* value;
+            while (ZyanHashMapIterate(&map, &iterator, nullptr, &value) == ZYAN_STATUS_TRUE)
+            {
+                checksum_zyan += *static_cast<const ZyanU64*>(value);
+            }
+        });
+        Benchmark("ZyanHashMapErase", [&]()
+        {
+            for (const auto key : keys)
+            {
+                ZyanHashMapErase(&map, &key);
+            }
+        });
+        EXPECT_EQ(ZyanHashMapDestroy(&map), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(checksum_std, checksum_zyan);
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
@@ -0,0 +1,374 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanRingBuffer` implementation.
+ */
+
+#include <cstdio>
+#include <deque>
+#include <random>
+#include <vector>
+#include <time.h>
+#include <gtest/gtest.h>
+#include <Zycore/RingBuffer.h>
+#include <Zycore/Vector.h>
+#include "Benchmark.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Checks that the ring buffer contains the same elements as the given reference.
+ *
+ * @param   buffer      A pointer to the `ZyanRingBuffer` instance.
+ * @param   expected    The expected elements.
+ */
+static void ExpectContents(const ZyanRingBuffer* buffer, const std::deque<ZyanU32>& expected)
+{
+    ZyanUSize size;
+    ASSERT_EQ(ZyanRingBufferGetSize(buffer, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(size, expected.size());
+    for (ZyanUSize i = 0; i < size; ++i)
+    {
+        ASSERT_EQ(*static_cast<const ZyanU32*>(ZyanRingBufferGet(buffer, i)), expected[i]);
+    }
+    ASSERT_EQ(ZyanRingBufferGet(buffer, size), nullptr);
+
+    // The spans must cover the same elements in order
+    const void* first;
+    const void* second;
+    ZyanUSize first_count;
+    ZyanUSize second_count;
+    ASSERT_EQ(ZyanRingBufferGetSpans(buffer, &first, &first_count, &second, &second_count),
+        ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(first_count + second_count, size);
+    ASSERT_EQ(first == nullptr, first_count == 0);
+    ASSERT_EQ(second == nullptr, second_count == 0);
+    for (ZyanUSize i = 0; i < first_count; ++i)
+    {
+        ASSERT_EQ(static_cast<const ZyanU32*>(first)[i], expected[i]);
+    }
+    for (ZyanUSize i = 0; i < second_count; ++i)
+    {
+        ASSERT_EQ(static_cast<const ZyanU32*>(second)[i], expected[first_count + i]);
+    }
+}
+
+/**
+ * @brief   Counts the number of destructor invocations.
+ */
+static ZyanUSize destructor_calls = 0;
+
+/**
+ * @brief   A destructor callback that counts its invocations.
+ *
+ * @param   object  A pointer to the object.
+ */
+static void CountingDestructor(void* object)
+{
+    ZYAN_UNUSED(object);
+    ++destructor_calls;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(RingBufferTest, InitAndDestroy)
+{
+    ZyanRingBuffer buffer;
+    ASSERT_EQ(ZyanRingBufferInit(&buffer, sizeof(ZyanU32), 0, nullptr), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(buffer.size, static_cast<ZyanUSize>(0));
+    EXPECT_EQ(buffer.capacity, static_cast<ZyanUSize>(ZYAN_RING_BUFFER_MIN_CAPACITY));
+    EXPECT_EQ(ZyanRingBufferDestroy(&buffer), ZYAN_STATUS_SUCCESS);
+
+    ASSERT_EQ(ZyanRingBufferInitEx(&buffer, sizeof(ZyanU32), 16, nullptr,
+        ZyanAllocatorDefault(), 1, 0), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(buffer.capacity, static_cast<ZyanUSize>(16));
+    EXPECT_EQ(ZyanRingBufferDestroy(&buffer), ZYAN_STATUS_SUCCESS);
+
+    // Edge cases
+    EXPECT_EQ(ZyanRingBufferInit(nullptr, sizeof(ZyanU32), 0, nullptr),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanRingBufferInit(&buffer, 0, 0, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanRingBufferInitEx(&buffer, sizeof(ZyanU32), 0, nullptr, nullptr, 2, 4),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanRingBufferInitEx(&buffer, sizeof(ZyanU32), 0, nullptr,
+        ZyanAllocatorDefault(), 0, 4), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(RingBufferTest, PushPop)
+{
+    std::mt19937 rng(1337);
+
+    ZyanRingBuffer buffer;
+    ASSERT_EQ(ZyanRingBufferInit(&buffer, sizeof(ZyanU32), 4, nullptr), ZYAN_STATUS_SUCCESS);
+    std::deque<ZyanU32> expected;
+
+    ZyanU32 next = 0;
+    std::vector<ZyanU32> values(32);
+    for (ZyanUSize i = 0; i < 5000; ++i)
+    {
+        // Keep the number of pushes slightly ahead of the number of pops, to exercise growing
+        // as well as shrinking
+        const ZyanUSize count = 1 + rng() % values.size();
+        switch (rng() % 9)
+        {
+        case 0:
+        case 1:
+            for (ZyanUSize j = 0; j < count; ++j)
+            {
+                values[j] = next++;
+            }
+            ASSERT_EQ(ZyanRingBufferPushBackRange(&buffer, values.data(), count),
+                ZYAN_STATUS_SUCCESS);
+            expected.insert(expected.end(), values.begin(), values.begin() + count);
+            break;
+        case 2:
+        case 3:
+            for (ZyanUSize j = 0; j < count; ++j)
+            {
+                values[j] = next++;
+            }
+            ASSERT_EQ(ZyanRingBufferPushFrontRange(&buffer, values.data(), count),
+                ZYAN_STATUS_SUCCESS);
+            expected.insert(expected.begin(), values.begin(), values.begin() + count);
+            break;
+        case 4:
+            values[0] = next++;
+            ASSERT_EQ(ZyanRingBufferPushBack(&buffer, &values[0]), ZYAN_STATUS_SUCCESS);
+            expected.push_back(values[0]);
+            values[0] = next++;
+            ASSERT_EQ(ZyanRingBufferPushFront(&buffer, &values[0]), ZYAN_STATUS_SUCCESS);
+            expected.push_front(values[0]);
+            break;
+        case 5:
+        case 6:
+            if (count > expected.size())
+            {
+                EXPECT_EQ(ZyanRingBufferPopFrontRange(&buffer, values.data(), count),
+                    ZYAN_STATUS_OUT_OF_RANGE);
+                break;
+            }
+            ASSERT_EQ(ZyanRingBufferPopFrontRange(&buffer, values.data(), count),
+                ZYAN_STATUS_SUCCESS);
+            for (ZyanUSize j = 0; j < count; ++j)
+            {
+                ASSERT_EQ(values[j], expected.front());
+                expected.pop_front();
+            }
+            break;
+        case 7:
+            if (count > expected.size())
+            {
+                EXPECT_EQ(ZyanRingBufferPopBackRange(&buffer, values.data(), count),
+                    ZYAN_STATUS_OUT_OF_RANGE);
+                break;
+            }
+            ASSERT_EQ(ZyanRingBufferPopBackRange(&buffer, values.data(), count),
+                ZYAN_STATUS_SUCCESS);
+            for (ZyanUSize j = 0; j < count; ++j)
+            {
+                ASSERT_EQ(values[j], expected[expected.size() - count + j]);
+            }
+            expected.erase(expected.end() - count, expected.end());
+            break;
+        case 8:
+            if (expected.empty())
+            {
+                EXPECT_EQ(ZyanRingBufferPopFront(&buffer, nullptr), ZYAN_STATUS_OUT_OF_RANGE);
+                EXPECT_EQ(ZyanRingBufferPopBack(&buffer, nullptr), ZYAN_STATUS_OUT_OF_RANGE);
+                break;
+            }
+            ASSERT_EQ(ZyanRingBufferPopFront(&buffer, nullptr), ZYAN_STATUS_SUCCESS);
+            expected.pop_front();
+            if (!expected.empty())
+            {
+                ASSERT_EQ(ZyanRingBufferPopBack(&buffer, nullptr), ZYAN_STATUS_SUCCESS);
+                expected.pop_back();
+            }
+            break;
+        }
+        ExpectContents(&buffer, expected);
+        ASSERT_FALSE(HasFatalFailure());
+    }
+
+    ZyanUSize capacity;
+    ASSERT_EQ(ZyanRingBufferShrinkToFit(&buffer), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRingBufferGetCapacity(&buffer, &capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(capacity, ZYAN_MAX(expected.size(), static_cast<ZyanUSize>(1)));
+    ExpectContents(&buffer, expected);
+
+    ASSERT_EQ(ZyanRingBufferReserve(&buffer, expected.size() + 1000), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRingBufferGetCapacity(&buffer, &capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(capacity, expected.size() + 1000);
+    ExpectContents(&buffer, expected);
+
+    ASSERT_EQ(ZyanRingBufferClear(&buffer), ZYAN_STATUS_SUCCESS);
+    ExpectContents(&buffer, std::deque<ZyanU32>());
+
+    // Edge cases
+    EXPECT_EQ(ZyanRingBufferPushBackRange(&buffer, values.data(), 0),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanRingBufferPushFront(&buffer, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanRingBufferPopFrontRange(&buffer, nullptr, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    EXPECT_EQ(ZyanRingBufferDestroy(&buffer), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(RingBufferTest, CustomBuffer)
+{
+    ZyanU32 storage[8];
+    ZyanRingBuffer buffer;
+    ASSERT_EQ(ZyanRingBufferInitCustomBuffer(&buffer, sizeof(ZyanU32), storage,
+        ZYAN_ARRAY_LENGTH(storage), nullptr), ZYAN_STATUS_SUCCESS);
+
+    // Move the head to the middle of the buffer, so that the elements wrap around
+    std::deque<ZyanU32> expected;
+    const ZyanU32 values[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    ASSERT_EQ(ZyanRingBufferPushBackRange(&buffer, values, 5), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRingBufferPopFrontRange(&buffer, nullptr, 5), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRingBufferPushBackRange(&buffer, values, 6), ZYAN_STATUS_SUCCESS);
+    expected.insert(expected.end(), values, values + 6);
+    ExpectContents(&buffer, expected);
+
+    ASSERT_EQ(ZyanRingBufferPushFrontRange(&buffer, values + 6, 2), ZYAN_STATUS_SUCCESS);
+    expected.insert(expected.begin(), values + 6, values + 8);
+    ExpectContents(&buffer, expected);
+
+    // The buffer is full now
+    EXPECT_EQ(ZyanRingBufferPushBack(&buffer, values), ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+    EXPECT_EQ(ZyanRingBufferPushFront(&buffer, values), ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+    EXPECT_EQ(ZyanRingBufferReserve(&buffer, 9), ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+    ExpectContents(&buffer, expected);
+
+    ZyanU32 element;
+    ASSERT_EQ(ZyanRingBufferPopBack(&buffer, &element), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(element, expected.back());
+    expected.pop_back();
+    ExpectContents(&buffer, expected);
+    EXPECT_EQ(buffer.capacity, ZYAN_ARRAY_LENGTH(storage));
+}
+
+TEST(RingBufferTest, Destructor)
+{
+    ZyanRingBuffer buffer;
+    ASSERT_EQ(ZyanRingBufferInit(&buffer, sizeof(ZyanU32), 0, &CountingDestructor),
+        ZYAN_STATUS_SUCCESS);
+
+    destructor_calls = 0;
+    const ZyanU32 values[10] = { 0 };
+    ASSERT_EQ(ZyanRingBufferPushBackRange(&buffer, values, 10), ZYAN_STATUS_SUCCESS);
+
+    // Elements that are moved out of the ring buffer are not destroyed
+    ZyanU32 removed[2];
+    ASSERT_EQ(ZyanRingBufferPopFrontRange(&buffer, removed, 2), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(destructor_calls, static_cast<ZyanUSize>(0));
+
+    ASSERT_EQ(ZyanRingBufferPopFrontRange(&buffer, nullptr, 2), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(destructor_calls, static_cast<ZyanUSize>(2));
+    ASSERT_EQ(ZyanRingBufferPopBack(&buffer, nullptr), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(destructor_calls, static_cast<ZyanUSize>(3));
+
+    EXPECT_EQ(ZyanRingBufferDestroy(&buffer), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(destructor_calls, static_cast<ZyanUSize>(8));
+}
+
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+TEST(RingBufferBenchmark, DISABLED_Queue)
+{
+    static const ZyanUSize queue_lengths[] = { 16, 1000, 100000 };
+    static const ZyanUSize operations = 200000;
+
+    for (const auto length : queue_lengths)
+    {
+        char name[64];
+
+        // FIFO queue on top of a vector: push to the back, pop from the front
+        ZyanVector vector;
+        ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), length,
+            reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+        ZyanU64 checksum_vector = 0;
+        snprintf(name, sizeof(name), "ZyanVector (%zu queued)", length);
+        Benchmark(name, [&]()
+        {
+            for (ZyanU64 i = 0; i < length; ++i)
+            {
+                ZyanVectorPushBack(&vector, &i);
+            }
+            for (ZyanU64 i = 0; i < operations; ++i)
+            {
+                checksum_vector += *static_cast<const ZyanU64*>(ZyanVectorGet(&vector, 0));
+                ZyanVectorDelete(&vector, 0);
+                ZyanVectorPushBack(&vector, &i);
+            }
+        });
+        EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+
+        ZyanRingBuffer buffer;
+        ASSERT_EQ(ZyanRingBufferInit(&buffer, sizeof(ZyanU64), length, nullptr),
+            ZYAN_STATUS_SUCCESS);
+        ZyanU64 checksum_buffer = 0;
+        snprintf(name, sizeof(name), "ZyanRingBuffer (%zu queued)", length);
+        Benchmark(name, [&]()
+        {
+            for (ZyanU64 i = 0; i < length; ++i)
+            {
+                ZyanRingBufferPushBack(&buffer, &i);
+            }
+            for (ZyanU64 i = 0; i < operations; ++i)
+            {
+                ZyanU64 value;
+                ZyanRingBufferPopFront(&buffer, &value);
+                checksum_buffer += value;
+                ZyanRingBufferPushBack(&buffer, &i);
+            }
+        });
+        EXPECT_EQ(checksum_vector, checksum_buffer);
+        EXPECT_EQ(ZyanRingBufferDestroy(&buffer), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    time_t t;
+    srand(static_cast<unsigned>(time(&t)));
+
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
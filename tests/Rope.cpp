@@ -0,0 +1,377 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanRope` implementation.
+ */
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <gtest/gtest.h>
+#include <Zycore/Rope.h>
+#include <Zycore/TrackingAllocator.h>
+#include "Benchmark.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Returns a view for the given string.
+ *
+ * @param   string  The string.
+ *
+ * @return  The view.
+ */
+static ZyanStringView View(const std::string& string)
+{
+    ZyanStringView view;
+    EXPECT_EQ(string.empty() ? ZyanStringViewInsideBuffer(&view, "") :
+        ZyanStringViewInsideBufferEx(&view, string.data(), string.size()), ZYAN_STATUS_SUCCESS);
+    return view;
+}
+
+/**
+ * @brief   Returns a view for the given C-style string.
+ *
+ * @param   string  The C-style string.
+ *
+ * @return  The view.
+ */
+static ZyanStringView View(const char* string)
+{
+    ZyanStringView view;
+    EXPECT_EQ(ZyanStringViewInsideBuffer(&view, string), ZYAN_STATUS_SUCCESS);
+    return view;
+}
+
+/**
+ * @brief   Returns the content of the given rope by iterating over its chunks.
+ *
+ * @param   rope    A pointer to the `ZyanRope` instance.
+ *
+ * @return  The content of the rope.
+ */
+static std::string Content(const ZyanRope* rope)
+{
+    std::string result;
+    ZyanRopeCursor cursor;
+    EXPECT_EQ(ZyanRopeCursorInit(&cursor, rope, 0), ZYAN_STATUS_SUCCESS);
+    const char* data;
+    ZyanUSize size;
+    while (ZyanRopeCursorNextChunk(&cursor, &data, &size) == ZYAN_STATUS_TRUE)
+    {
+        EXPECT_GT(size, static_cast<ZyanUSize>(0));
+        EXPECT_LE(size, static_cast<ZyanUSize>(ZYAN_ROPE_CHUNK_SIZE));
+        result.append(data, size);
+    }
+    return result;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(RopeTest, Basic)
+{
+    ZyanRope rope;
+    ASSERT_EQ(ZyanRopeInit(&rope), ZYAN_STATUS_SUCCESS);
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanRopeGetSize(&rope, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, static_cast<ZyanUSize>(0));
+
+    ZyanStringView view = View("world");
+    ASSERT_EQ(ZyanRopeAppend(&rope, &view), ZYAN_STATUS_SUCCESS);
+    view = View("Hello ");
+    ASSERT_EQ(ZyanRopeInsert(&rope, 0, &view), ZYAN_STATUS_SUCCESS);
+    view = View("!");
+    ASSERT_EQ(ZyanRopeInsert(&rope, 11, &view), ZYAN_STATUS_SUCCESS);
+    view = View("");
+    ASSERT_EQ(ZyanRopeInsert(&rope, 5, &view), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(Content(&rope), "Hello world!");
+
+    char c;
+    ASSERT_EQ(ZyanRopeGetChar(&rope, 6, &c), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(c, 'w');
+    EXPECT_EQ(ZyanRopeGetChar(&rope, 12, &c), ZYAN_STATUS_OUT_OF_RANGE);
+
+    ASSERT_EQ(ZyanRopeDelete(&rope, 5, 6), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRopeDelete(&rope, 0, 0), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(Content(&rope), "Hello!");
+
+    // Conversion from and to `ZyanString`
+    ZyanString string;
+    ASSERT_EQ(ZyanStringInit(&string, 0), ZYAN_STATUS_SUCCESS);
+    view = View(", rope");
+    ASSERT_EQ(ZyanStringAppend(&string, &view), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRopeInsert(&rope, 5, ZYAN_STRING_TO_VIEW(&string)), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStringClear(&string), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRopeGetSize(&rope, &size), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRopeCopy(&rope, 0, size, &string), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRopeCopy(&rope, 7, 4, &string), ZYAN_STATUS_SUCCESS);
+    const char* data;
+    ASSERT_EQ(ZyanStringGetData(&string, &data), ZYAN_STATUS_SUCCESS);
+    EXPECT_STREQ(data, "Hello, rope!rope");
+    EXPECT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+
+    ASSERT_EQ(ZyanRopeClear(&rope), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRopeGetSize(&rope, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, static_cast<ZyanUSize>(0));
+    EXPECT_EQ(Content(&rope), "");
+
+    EXPECT_EQ(ZyanRopeDestroy(&rope), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(RopeTest, InvalidArguments)
+{
+    ZyanRope rope;
+    EXPECT_EQ(ZyanRopeInitEx(nullptr, ZyanAllocatorDefault()), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanRopeInitEx(&rope, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanRopeInit(&rope), ZYAN_STATUS_SUCCESS);
+
+    const ZyanStringView view = View("abc");
+    EXPECT_EQ(ZyanRopeInsert(&rope, 0, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanRopeInsert(&rope, 1, &view), ZYAN_STATUS_OUT_OF_RANGE);
+    ASSERT_EQ(ZyanRopeAppend(&rope, &view), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanRopeDelete(&rope, 4, 0), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanRopeDelete(&rope, 1, 3), ZYAN_STATUS_OUT_OF_RANGE);
+
+    ZyanString string;
+    ASSERT_EQ(ZyanStringInit(&string, 0), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanRopeCopy(&rope, 2, 2, &string), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanRopeCopy(&rope, 0, 1, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+
+    // Fixed capacity strings are not resized
+    char buffer[3];
+    ASSERT_EQ(ZyanStringInitCustomBuffer(&string, buffer, sizeof(buffer)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanRopeCopy(&rope, 0, 3, &string), ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+    EXPECT_EQ(ZyanRopeCopy(&rope, 0, 2, &string), ZYAN_STATUS_SUCCESS);
+
+    ZyanRopeCursor cursor;
+    EXPECT_EQ(ZyanRopeCursorInit(&cursor, &rope, 4), ZYAN_STATUS_OUT_OF_RANGE);
+    ASSERT_EQ(ZyanRopeCursorInit(&cursor, &rope, 3), ZYAN_STATUS_SUCCESS);
+    char c;
+    EXPECT_EQ(ZyanRopeCursorNext(&cursor, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanRopeCursorNext(&cursor, &c), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanRopeDestroy(&rope), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(RopeTest, Cursor)
+{
+    std::string text;
+    for (int i = 0; i < 10000; ++i)
+    {
+        text += static_cast<char>('a' + i % 26);
+    }
+
+    ZyanRope rope;
+    ASSERT_EQ(ZyanRopeInit(&rope), ZYAN_STATUS_SUCCESS);
+    const ZyanStringView view = View(text);
+    ASSERT_EQ(ZyanRopeAppend(&rope, &view), ZYAN_STATUS_SUCCESS);
+
+    ZyanRopeCursor cursor;
+    ASSERT_EQ(ZyanRopeCursorInit(&cursor, &rope, 1500), ZYAN_STATUS_SUCCESS);
+    std::string result;
+    char c;
+    while (ZyanRopeCursorNext(&cursor, &c) == ZYAN_STATUS_TRUE)
+    {
+        result += c;
+    }
+    EXPECT_EQ(result, text.substr(1500));
+    ZyanUSize position;
+    ASSERT_EQ(ZyanRopeCursorGetPosition(&cursor, &position), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(position, text.size());
+
+    // Mixed character and chunk access
+    ASSERT_EQ(ZyanRopeCursorInit(&cursor, &rope, 0), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanRopeCursorNext(&cursor, &c), ZYAN_STATUS_TRUE);
+    const char* data;
+    ZyanUSize size;
+    ASSERT_EQ(ZyanRopeCursorNextChunk(&cursor, &data, &size), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(std::string(1, c) + std::string(data, size), text.substr(0, size + 1));
+    ASSERT_EQ(ZyanRopeCursorGetPosition(&cursor, &position), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(position, size + 1);
+
+    ZyanUSize count;
+    ASSERT_EQ(ZyanRopeGetNodeCount(&rope, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, static_cast<ZyanUSize>((text.size() + ZYAN_ROPE_CHUNK_SIZE - 1) /
+        ZYAN_ROPE_CHUNK_SIZE));
+
+    EXPECT_EQ(ZyanRopeDestroy(&rope), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(RopeTest, Random)
+{
+    ZyanTrackingAllocator tracking;
+    ASSERT_EQ(ZyanTrackingInit(&tracking), ZYAN_STATUS_SUCCESS);
+
+    ZyanRope rope;
+    ASSERT_EQ(ZyanRopeInitEx(&rope, &tracking.allocator), ZYAN_STATUS_SUCCESS);
+
+    std::mt19937 gen(1337);
+    std::string reference;
+    for (int i = 0; i < 20000; ++i)
+    {
+        const auto op = gen() % 8;
+        if (op < 4)
+        {
+            // Mostly small inserts, sometimes large ones that span multiple nodes
+            const std::size_t length = (op == 0) ? gen() % 5000 : gen() % 40;
+            std::string text;
+            for (std::size_t j = 0; j < length; ++j)
+            {
+                text += static_cast<char>('!' + gen() % 90);
+            }
+            const std::size_t index = gen() % (reference.size() + 1);
+            const ZyanStringView view = View(text);
+            ASSERT_EQ(ZyanRopeInsert(&rope, index, &view), ZYAN_STATUS_SUCCESS);
+            reference.insert(index, text);
+        } else
+        {
+            const std::size_t index = gen() % (reference.size() + 1);
+            const std::size_t max = reference.size() - index;
+            const std::size_t count = (op == 4) ? gen() % (max + 1) :
+                std::min<std::size_t>(gen() % 60, max);
+            ASSERT_EQ(ZyanRopeDelete(&rope, index, count), ZYAN_STATUS_SUCCESS);
+            reference.erase(index, count);
+        }
+
+        ZyanUSize size;
+        ASSERT_EQ(ZyanRopeGetSize(&rope, &size), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(size, reference.size());
+        if (i % 500 == 0)
+        {
+            ASSERT_EQ(Content(&rope), reference);
+            if (!reference.empty())
+            {
+                const std::size_t index = gen() % reference.size();
+                char c;
+                ASSERT_EQ(ZyanRopeGetChar(&rope, index, &c), ZYAN_STATUS_SUCCESS);
+                ASSERT_EQ(c, reference[index]);
+
+                const std::size_t count = gen() % (reference.size() - index + 1);
+                ZyanString string;
+                ASSERT_EQ(ZyanStringInit(&string, 0), ZYAN_STATUS_SUCCESS);
+                ASSERT_EQ(ZyanRopeCopy(&rope, index, count, &string), ZYAN_STATUS_SUCCESS);
+                const char* data;
+                ASSERT_EQ(ZyanStringGetData(&string, &data), ZYAN_STATUS_SUCCESS);
+                ASSERT_EQ(std::string(data), reference.substr(index, count));
+                ASSERT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+            }
+        }
+    }
+    ASSERT_EQ(Content(&rope), reference);
+
+    // Adjacent nodes are combined, so the rope never degenerates into tiny nodes
+    ZyanUSize count;
+    ASSERT_EQ(ZyanRopeGetNodeCount(&rope, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_LE(count, 4 * reference.size() / ZYAN_ROPE_CHUNK_SIZE + 1);
+
+    EXPECT_EQ(ZyanRopeDestroy(&rope), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(tracking.statistics.bytes_live, static_cast<ZyanU64>(0));
+}
+
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+TEST(RopeBenchmark, DISABLED_RandomEdits)
+{
+    static const std::size_t document_size = 50 * 1024 * 1024;
+
+    std::mt19937 gen(1337);
+    std::string document;
+    static const char* const words[] = { "mov", "rax", "rbx", "push", "call", "qword", "ptr" };
+    while (document.size() < document_size)
+    {
+        document += words[gen() % 7];
+        document += (gen() % 8) ? ' ' : '\n';
+    }
+    const std::string annotation = "; annotation";
+
+    ZyanRope rope;
+    ASSERT_EQ(ZyanRopeInit(&rope), ZYAN_STATUS_SUCCESS);
+    const ZyanStringView view = View(document);
+    Benchmark("ZyanRope load 50 MB", [&]()
+    {
+        ASSERT_EQ(ZyanRopeAppend(&rope, &view), ZYAN_STATUS_SUCCESS);
+    });
+
+    // Alternating inserts and deletes at random positions
+    const ZyanStringView edit = View(annotation);
+    static const std::size_t rope_edits = 1000000;
+    Benchmark("ZyanRope 1M random edits", [&]()
+    {
+        for (std::size_t i = 0; i < rope_edits / 2; ++i)
+        {
+            ASSERT_EQ(ZyanRopeInsert(&rope, gen() % document_size, &edit), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanRopeDelete(&rope, gen() % document_size, annotation.size()),
+                ZYAN_STATUS_SUCCESS);
+        }
+    });
+    ZyanUSize count;
+    ASSERT_EQ(ZyanRopeGetNodeCount(&rope, &count), ZYAN_STATUS_SUCCESS);
+    std::printf("%-40s %10zu\n", "nodes", static_cast<std::size_t>(count));
+
+    ZyanString string;
+    ASSERT_EQ(ZyanStringInit(&string, document.size()), ZYAN_STATUS_SUCCESS);
+    Benchmark("ZyanRope copy to ZyanString", [&]()
+    {
+        ASSERT_EQ(ZyanRopeCopy(&rope, 0, document.size(), &string), ZYAN_STATUS_SUCCESS);
+    });
+    EXPECT_EQ(ZyanRopeDestroy(&rope), ZYAN_STATUS_SUCCESS);
+
+    // Same edits on a flat string, which has to move the tail of the buffer every time
+    static const std::size_t string_edits = 1000;
+    Benchmark("ZyanString 1K random edits", [&]()
+    {
+        for (std::size_t i = 0; i < string_edits / 2; ++i)
+        {
+            ASSERT_EQ(ZyanStringInsert(&string, gen() % document_size, &edit),
+                ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanStringDelete(&string, gen() % document_size, annotation.size()),
+                ZYAN_STATUS_SUCCESS);
+        }
+    });
+    EXPECT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
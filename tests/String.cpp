@@ -29,8 +29,14 @@
  * @brief   Tests the `ZyanString` implementation.
  */
 
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <string>
 #include <gtest/gtest.h>
 #include <Zycore/String.h>
+#include <Zycore/TrackingAllocator.h>
+#include "Benchmark.h"
 
 /* ============================================================================================== */
 /* Enums and types                                                                                */
@@ -42,20 +48,631 @@
 /* Helper functions                                                                               */
 /* ============================================================================================== */
 
+/**
+ * @brief   Searches for `needle` in `haystack[begin, end)` one character at a time.
+ *
+ * @param   haystack            The string to search in.
+ * @param   needle              The sub-string to search for.
+ * @param   begin               The index of the first character to search in.
+ * @param   end                 The index after the last character to search in.
+ * @param   case_insensitive    `true` to ignore bit `0x20` of all characters.
+ * @param   reverse             `true` to search for the last occurrence.
+ *
+ * @return  The index of the occurrence or `-1`, if the needle was not found.
+ */
+static ZyanISize ReferencePos(const std::string& haystack, const std::string& needle,
+    std::size_t begin, std::size_t end, bool case_insensitive, bool reverse)
+{
+    const char mask = case_insensitive ? 0x20 : 0x00;
+    ZyanISize result = -1;
+    for (std::size_t i = begin; needle.size() && (i + needle.size() <= end); ++i)
+    {
+        std::size_t j = 0;
+        while ((j < needle.size()) && ((haystack[i + j] | mask) == (needle[j] | mask)))
+        {
+            ++j;
+        }
+        if (j == needle.size())
+        {
+            result = static_cast<ZyanISize>(i);
+            if (!reverse)
+            {
+                break;
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief   Compares two strings of equal length like `ZyanStringCompareI`.
+ *
+ * @param   a   The first string.
+ * @param   b   The second string.
+ *
+ * @return  The comparison result.
+ */
+static ZyanI32 ReferenceCompareI(const std::string& a, const std::string& b)
+{
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        if ((a[i] == b[i]) || ((a[i] ^ 32) == b[i]))
+        {
+            continue;
+        }
+        return ((a[i] | 32) < (b[i] | 32)) ? -1 : 1;
+    }
+    return 0;
+}
 
+/**
+ * @brief   Returns a random string that contains many letters and all characters next to the
+ *          ranges of letters.
+ *
+ * @param   gen     The random number generator.
+ * @param   size    The size of the string.
+ *
+ * @return  The string.
+ */
+static std::string RandomCaseString(std::mt19937& gen, std::size_t size)
+{
+    static const char specials[] = { '@', '[', '`', '{', '\x00', '\x7F', '\x80', '\xC1', '\xDA',
+        '\xE1', '\xFA', '\xFF' };
+    std::string result;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        const auto r = gen() % 4;
+        result += (r == 0) ? specials[gen() % sizeof(specials)] :
+            static_cast<char>(((r == 1) ? 'A' : 'a') + gen() % 26);
+    }
+    return result;
+}
 
 /* ============================================================================================== */
 /* Tests                                                                                          */
 /* ============================================================================================== */
 
 /* ---------------------------------------------------------------------------------------------- */
-/*                                                                                                */
+/* Memory management                                                                              */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(StringTest, GrowthPolicy)
+{
+    ZyanString string;
+    ASSERT_EQ(ZyanStringInit(&string, 0), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanStringSetGrowthPolicy(nullptr, ZyanGrowthPolicySizeClass()),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanStringSetGrowthPolicy(&string, ZyanGrowthPolicySizeClass()),
+        ZYAN_STATUS_SUCCESS);
+
+    ZyanStringView view;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&view, "abc"), ZYAN_STATUS_SUCCESS);
+    for (int i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(ZyanStringAppend(&string, &view), ZYAN_STATUS_SUCCESS);
+
+        // All capacities match a size-class of the policy
+        ZyanUSize capacity;
+        ASSERT_EQ(ZyanStringGetCapacity(&string, &capacity), ZYAN_STATUS_SUCCESS);
+        const ZyanUSize bytes = capacity + 1;
+        ASSERT_TRUE((bytes <= 128) ? (bytes % 16 == 0) : (bytes <= 4096) ? (bytes % 32 == 0) :
+            (bytes % 4096 == 0));
+    }
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanStringGetSize(&string, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, static_cast<ZyanUSize>(3000));
+    EXPECT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+
+    char buffer[16];
+    ASSERT_EQ(ZyanStringInitCustomBuffer(&string, buffer, sizeof(buffer)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanStringSetGrowthPolicy(&string, ZyanGrowthPolicySizeClass()),
+        ZYAN_STATUS_INVALID_OPERATION);
+}
+
+TEST(StringTest, InlineStorage)
+{
+    ZyanTrackingAllocator tracking;
+    ASSERT_EQ(ZyanTrackingInit(&tracking), ZYAN_STATUS_SUCCESS);
+
+    // Short strings never touch the allocator
+    ZyanString string;
+    ASSERT_EQ(ZyanStringInitEx(&string, 0, &tracking.allocator, ZYAN_STRING_DEFAULT_GROWTH_FACTOR,
+        ZYAN_STRING_DEFAULT_SHRINK_THRESHOLD), ZYAN_STATUS_SUCCESS);
+    EXPECT_TRUE(string.flags & ZYAN_STRING_IS_INLINE);
+    ZyanUSize capacity;
+    ASSERT_EQ(ZyanStringGetCapacity(&string, &capacity), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(capacity, ZYAN_STRING_INLINE_SIZE(&string) - 1);
+    ASSERT_GE(capacity, static_cast<ZyanUSize>(20));
+
+    ZyanStringView view;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&view, "0123456789"), ZYAN_STATUS_SUCCESS);
+    std::string expected;
+    while (expected.size() + 10 <= capacity)
+    {
+        ASSERT_EQ(ZyanStringAppend(&string, &view), ZYAN_STATUS_SUCCESS);
+        expected += "0123456789";
+    }
+    ASSERT_EQ(ZyanStringInsertEx(&string, 1, &view, 2, 3), ZYAN_STATUS_SUCCESS);
+    expected.insert(1, "234");
+    ASSERT_EQ(ZyanStringDelete(&string, 5, 4), ZYAN_STATUS_SUCCESS);
+    expected.erase(5, 4);
+    ASSERT_EQ(ZyanStringSetChar(&string, 0, 'x'), ZYAN_STATUS_SUCCESS);
+    expected[0] = 'x';
+    ASSERT_EQ(ZyanStringToUpperCase(&string), ZYAN_STATUS_SUCCESS);
+    expected[0] = 'X';
+    ASSERT_EQ(ZyanStringShrinkToFit(&string), ZYAN_STATUS_SUCCESS);
+    EXPECT_TRUE(string.flags & ZYAN_STRING_IS_INLINE);
+
+    const char* data;
+    ASSERT_EQ(ZyanStringGetData(&string, &data), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(std::string(data), expected);
+    ZyanStringView other;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&other, expected.c_str()), ZYAN_STATUS_SUCCESS);
+    ZyanI32 result;
+    EXPECT_EQ(ZyanStringCompare(ZYAN_STRING_TO_VIEW(&string), &other, &result),
+        ZYAN_STATUS_TRUE);
+
+    // Inline strings can be moved in memory
+    ZyanString moved;
+    std::memcpy(&moved, &string, sizeof(ZyanString));
+    std::memset(&string, 0xCC, sizeof(ZyanString));
+    ASSERT_EQ(ZyanStringGetData(&moved, &data), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(std::string(data), expected);
+
+    ZyanVector strings;
+    ASSERT_EQ(ZyanVectorInit(&strings, sizeof(ZyanString), 1, nullptr), ZYAN_STATUS_SUCCESS);
+    for (int i = 0; i < 100; ++i)
+    {
+        const std::string text = std::to_string(i);
+        ZyanStringView number;
+        ASSERT_EQ(ZyanStringViewInsideBuffer(&number, text.c_str()), ZYAN_STATUS_SUCCESS);
+        ZyanString element;
+        ASSERT_EQ(ZyanStringDuplicateEx(&element, &number, 0, &tracking.allocator,
+            ZYAN_STRING_DEFAULT_GROWTH_FACTOR, ZYAN_STRING_DEFAULT_SHRINK_THRESHOLD),
+            ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanVectorPushBack(&strings, &element), ZYAN_STATUS_SUCCESS);
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto element = static_cast<ZyanString*>(ZyanVectorGetMutable(&strings, i));
+        ASSERT_EQ(ZyanStringGetData(element, &data), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(std::string(data), std::to_string(i));
+        EXPECT_EQ(ZyanStringDestroy(element), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(ZyanVectorDestroy(&strings), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(tracking.statistics.allocation_count, static_cast<ZyanU64>(0));
+
+    // The string moves to the allocator once it outgrows the inline storage
+    while (expected.size() <= capacity)
+    {
+        ASSERT_EQ(ZyanStringAppend(&moved, &view), ZYAN_STATUS_SUCCESS);
+        expected += "0123456789";
+    }
+    EXPECT_FALSE(moved.flags & ZYAN_STRING_IS_INLINE);
+    EXPECT_EQ(tracking.statistics.allocation_count, static_cast<ZyanU64>(1));
+    ASSERT_EQ(ZyanStringGetData(&moved, &data), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(std::string(data), expected);
+    ASSERT_EQ(ZyanStringTruncate(&moved, 4), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStringGetData(&moved, &data), ZYAN_STATUS_SUCCESS);
+    EXPECT_STREQ(data, expected.substr(0, 4).c_str());
+    EXPECT_EQ(ZyanStringDestroy(&moved), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(tracking.statistics.bytes_live, static_cast<ZyanU64>(0));
+
+    // Larger initial capacities are allocated right away
+    ASSERT_EQ(ZyanStringInitEx(&string, capacity + 1, &tracking.allocator,
+        ZYAN_STRING_DEFAULT_GROWTH_FACTOR, ZYAN_STRING_DEFAULT_SHRINK_THRESHOLD),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_FALSE(string.flags & ZYAN_STRING_IS_INLINE);
+    EXPECT_EQ(tracking.statistics.allocation_count, static_cast<ZyanU64>(2));
+    EXPECT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(tracking.statistics.bytes_live, static_cast<ZyanU64>(0));
+
+    EXPECT_EQ(ZyanStringInitEx(&string, 0, nullptr, ZYAN_STRING_DEFAULT_GROWTH_FACTOR,
+        ZYAN_STRING_DEFAULT_SHRINK_THRESHOLD), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Comparing                                                                                      */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(StringTest, CompareI)
+{
+    std::mt19937 gen(1337);
+    for (std::size_t size = 0; size < 200; ++size)
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            const std::string a = RandomCaseString(gen, size);
+            std::string b = a;
+            for (std::size_t j = 0; j < size; ++j)
+            {
+                // Swap the case of most letters and change a few other characters
+                if (gen() % 2)
+                {
+                    b[j] ^= 32;
+                }
+                if (gen() % (4 * size + 1) == 0)
+                {
+                    b[j] = RandomCaseString(gen, 1)[0];
+                }
+            }
+
+            ZyanStringView v1, v2;
+            ASSERT_EQ(size ? ZyanStringViewInsideBufferEx(&v1, a.data(), size) :
+                ZyanStringViewInsideBuffer(&v1, ""), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(size ? ZyanStringViewInsideBufferEx(&v2, b.data(), size) :
+                ZyanStringViewInsideBuffer(&v2, ""), ZYAN_STATUS_SUCCESS);
+
+            const ZyanI32 expected = ReferenceCompareI(a, b);
+            ZyanI32 result;
+            ASSERT_EQ(ZyanStringCompareI(&v1, &v2, &result),
+                expected ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE);
+            ASSERT_EQ(result, expected);
+            ASSERT_EQ(ZyanStringCompareI(&v2, &v1, &result),
+                expected ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE);
+            ASSERT_EQ(result, -expected);
+        }
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Case conversion                                                                                */
+/* ---------------------------------------------------------------------------------------------- */
+
+TEST(StringTest, CaseConversion)
+{
+    std::mt19937 gen(1337);
+    for (std::size_t size = 1; size < 200; ++size)
+    {
+        const std::string text = RandomCaseString(gen, size);
+        const std::size_t index = gen() % size;
+        const std::size_t count = gen() % (size - index + 1);
+
+        std::string lower = text;
+        std::string upper = text;
+        for (std::size_t i = index; i < index + count; ++i)
+        {
+            if ((lower[i] >= 'A') && (lower[i] <= 'Z'))
+            {
+                lower[i] |= 32;
+            }
+            if ((upper[i] >= 'a') && (upper[i] <= 'z'))
+            {
+                upper[i] &= ~32;
+            }
+        }
+
+        ZyanStringView view;
+        ASSERT_EQ(ZyanStringViewInsideBufferEx(&view, text.data(), size), ZYAN_STATUS_SUCCESS);
+        ZyanString string;
+        ASSERT_EQ(ZyanStringDuplicate(&string, &view, 0), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanStringToLowerCaseEx(&string, index, count), ZYAN_STATUS_SUCCESS);
+        const char* data;
+        ASSERT_EQ(ZyanStringGetData(&string, &data), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(std::string(data, size), lower);
+        ASSERT_EQ(data[size], '\0');
+        ASSERT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+
+        ASSERT_EQ(ZyanStringDuplicate(&string, &view, 0), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanStringToUpperCaseEx(&string, index, count), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanStringGetData(&string, &data), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(std::string(data, size), upper);
+        EXPECT_EQ(ZyanStringToUpperCaseEx(&string, index, size - index + 1),
+            ZYAN_STATUS_OUT_OF_RANGE);
+        ASSERT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+/* ---------------------------------------------------------------------------------------------- */
+/* Searching                                                                                      */
 /* ---------------------------------------------------------------------------------------------- */
 
+TEST(StringTest, Pos)
+{
+    ZyanStringView haystack, needle;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&haystack, "mov rax, [rbx]; MOV RAX, rcx"),
+        ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&needle, "rax"), ZYAN_STATUS_SUCCESS);
+
+    ZyanISize index;
+    EXPECT_EQ(ZyanStringLPos(&haystack, &needle, &index), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(index, 4);
+    EXPECT_EQ(ZyanStringRPos(&haystack, &needle, &index), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(index, 4);
+    EXPECT_EQ(ZyanStringRPosI(&haystack, &needle, &index), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(index, 20);
+    EXPECT_EQ(ZyanStringLPosIEx(&haystack, &needle, &index, 5, 23), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(index, 20);
 
+    // The needle has to be completely inside of the range
+    EXPECT_EQ(ZyanStringLPosEx(&haystack, &needle, &index, 0, 6), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(index, -1);
+    EXPECT_EQ(ZyanStringLPosEx(&haystack, &needle, &index, 0, 7), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(ZyanStringRPosEx(&haystack, &needle, &index, 7, 3), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(index, 4);
+    EXPECT_EQ(ZyanStringRPosEx(&haystack, &needle, &index, 7, 2), ZYAN_STATUS_FALSE);
+
+    EXPECT_EQ(ZyanStringLPosEx(&haystack, &needle, &index, 1, 28), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanStringRPosEx(&haystack, &needle, &index, 29, 1), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanStringRPosEx(&haystack, &needle, &index, 10, 11), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanStringLPos(&haystack, nullptr, &index), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    // Empty needles are never found
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&needle, ""), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanStringLPos(&haystack, &needle, &index), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(ZyanStringRPos(&haystack, &needle, &index), ZYAN_STATUS_FALSE);
+}
+
+TEST(StringTest, PosRandom)
+{
+    // Small alphabets produce many partial matches and periodic needles. Needle lengths cover
+    // both the character filter and the Two-Way algorithm
+    std::mt19937 gen(1337);
+    for (int iteration = 0; iteration < 3000; ++iteration)
+    {
+        static const char* const alphabets[] = { "ab", "aAbB", "abcxyz" };
+        const char* alphabet = alphabets[iteration % 3];
+        const std::size_t alphabet_size = std::strlen(alphabet);
+        std::uniform_int_distribution<std::size_t> letter(0, alphabet_size - 1);
+
+        const std::size_t haystack_size = 1 + gen() % 400;
+        std::string haystack;
+        for (std::size_t i = 0; i < haystack_size; ++i)
+        {
+            haystack += alphabet[letter(gen)];
+        }
+        const std::size_t needle_size = 1 + gen() % ((iteration % 2) ? 8 : 150);
+        std::string needle;
+        if (needle_size <= haystack_size && (gen() % 2))
+        {
+            // Pick a needle that occurs at least once
+            needle = haystack.substr(gen() % (haystack_size - needle_size + 1), needle_size);
+        } else
+        {
+            for (std::size_t i = 0; i < needle_size; ++i)
+            {
+                needle += alphabet[letter(gen)];
+            }
+        }
+
+        ZyanStringView h, n;
+        ASSERT_EQ(ZyanStringViewInsideBufferEx(&h, haystack.data(), haystack.size()),
+            ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanStringViewInsideBufferEx(&n, needle.data(), needle.size()),
+            ZYAN_STATUS_SUCCESS);
+
+        const std::size_t begin = gen() % haystack_size;
+        const std::size_t count = gen() % (haystack_size - begin + 1);
+        const std::size_t end = begin + count;
+
+        ZyanISize index;
+        for (int variant = 0; variant < 4; ++variant)
+        {
+            const bool case_insensitive = variant & 1;
+            const bool reverse = variant & 2;
+            ZyanStatus status;
+            if (reverse)
+            {
+                status = case_insensitive ? ZyanStringRPosIEx(&h, &n, &index, end, count) :
+                    ZyanStringRPosEx(&h, &n, &index, end, count);
+            } else
+            {
+                status = case_insensitive ? ZyanStringLPosIEx(&h, &n, &index, begin, count) :
+                    ZyanStringLPosEx(&h, &n, &index, begin, count);
+            }
+            const ZyanISize expected =
+                ReferencePos(haystack, needle, begin, end, case_insensitive, reverse);
+            ASSERT_EQ(index, expected) << haystack << " / " << needle << " [" << begin << ", "
+                << end << ") variant " << variant;
+            ASSERT_EQ(status, (expected < 0) ? ZYAN_STATUS_FALSE : ZYAN_STATUS_TRUE);
+        }
+    }
+}
 
 /* ---------------------------------------------------------------------------------------------- */
 
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+TEST(StringBenchmark, DISABLED_Pos)
+{
+    static const std::size_t haystack_sizes[] = { 64, 4096, 1024 * 1024, 64 * 1024 * 1024 };
+    static const std::size_t needle_sizes[] = { 1, 4, 16, 64, 256 };
+    static const std::size_t total = 256 * 1024 * 1024;
+
+    // Text-like haystack, the needle only occurs at the very end (digits never match the text,
+    // not even in case-insensitive mode)
+    std::mt19937 gen(1337);
+    std::string text;
+    static const char* const words[] = { "mov", "rax", "rbx", "push", "call", "qword", "ptr" };
+    while (text.size() < haystack_sizes[3])
+    {
+        text += words[gen() % 7];
+        text += (gen() % 8) ? ' ' : '\n';
+    }
+
+    char name[64];
+    for (const auto needle_size : needle_sizes)
+    {
+        std::string needle;
+        for (std::size_t i = 0; i < needle_size; ++i)
+        {
+            needle += static_cast<char>('0' + (i * 7) % 10);
+        }
+        for (const auto haystack_size : haystack_sizes)
+        {
+            if (needle_size > haystack_size)
+            {
+                continue;
+            }
+            std::string haystack = text.substr(0, haystack_size - needle_size) + needle;
+            ZyanStringView h, n;
+            ZyanStringViewInsideBufferEx(&h, haystack.data(), haystack.size());
+            ZyanStringViewInsideBufferEx(&n, needle.data(), needle.size());
+
+            const std::size_t iterations = ZYAN_MAX(total / haystack_size, 1);
+            ZyanISize checksum = 0;
+            std::snprintf(name, sizeof(name), "LPos  %9zu / %3zu", haystack_size, needle_size);
+            Benchmark(name, [&]()
+            {
+                for (std::size_t i = 0; i < iterations; ++i)
+                {
+                    ZyanISize index;
+                    ZyanStringLPos(&h, &n, &index);
+                    checksum += index;
+                }
+            });
+            std::snprintf(name, sizeof(name), "LPosI %9zu / %3zu", haystack_size, needle_size);
+            Benchmark(name, [&]()
+            {
+                for (std::size_t i = 0; i < iterations; ++i)
+                {
+                    ZyanISize index;
+                    ZyanStringLPosI(&h, &n, &index);
+                    checksum += index;
+                }
+            });
+            std::snprintf(name, sizeof(name), "std::string::find %9zu / %3zu", haystack_size,
+                needle_size);
+            Benchmark(name, [&]()
+            {
+                for (std::size_t i = 0; i < iterations; ++i)
+                {
+                    checksum += static_cast<ZyanISize>(haystack.find(needle));
+                }
+            });
+            EXPECT_EQ(checksum, static_cast<ZyanISize>(3 * iterations * (haystack_size -
+                needle_size)));
+        }
+    }
+
+    // Worst case input for naive algorithms
+    const std::string haystack(16 * 1024 * 1024, 'a');
+    for (const auto needle_size : needle_sizes)
+    {
+        const std::string needle = std::string(needle_size - 1, 'a') + 'b';
+        ZyanStringView h, n;
+        ZyanStringViewInsideBufferEx(&h, haystack.data(), haystack.size());
+        ZyanStringViewInsideBufferEx(&n, needle.data(), needle.size());
+        std::snprintf(name, sizeof(name), "LPos (worst case) %9zu / %3zu", haystack.size(),
+            needle_size);
+        Benchmark(name, [&]()
+        {
+            ZyanISize index;
+            ZyanStringLPos(&h, &n, &index);
+            EXPECT_EQ(index, -1);
+        });
+    }
+}
+
+TEST(StringBenchmark, DISABLED_ShortStrings)
+{
+    static const std::size_t count = 4 * 1024 * 1024;
+    static const char* const words[] = { "rax", "qword ptr", "vpbroadcastd", "0x7FFE0000",
+        "[rsp+0x28]" };
+
+    ZyanTrackingAllocator tracking;
+    ASSERT_EQ(ZyanTrackingInit(&tracking), ZYAN_STATUS_SUCCESS);
+
+    ZyanStringView views[5];
+    for (std::size_t i = 0; i < 5; ++i)
+    {
+        ASSERT_EQ(ZyanStringViewInsideBuffer(&views[i], words[i]), ZYAN_STATUS_SUCCESS);
+    }
+
+    ZyanUSize checksum = 0;
+    Benchmark("ZyanString short strings", [&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            ZyanString string;
+            ZyanStringInitEx(&string, 0, &tracking.allocator, ZYAN_STRING_DEFAULT_GROWTH_FACTOR,
+                ZYAN_STRING_DEFAULT_SHRINK_THRESHOLD);
+            ZyanStringAppend(&string, &views[i % 5]);
+            ZyanStringAppend(&string, &views[(i + 1) % 5]);
+            ZyanUSize size;
+            ZyanStringGetSize(&string, &size);
+            checksum += size;
+            ZyanStringDestroy(&string);
+        }
+    });
+    std::printf("%-40s %10llu\n", "allocations",
+        static_cast<unsigned long long>(tracking.statistics.allocation_count));
+
+    ZyanUSize expected = 0;
+    Benchmark("std::string short strings", [&]()
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            std::string string;
+            string += words[i % 5];
+            string += words[(i + 1) % 5];
+            expected += string.size();
+        }
+    });
+    EXPECT_EQ(checksum, expected);
+}
+
+TEST(StringBenchmark, DISABLED_CaseConversion)
+{
+    static const std::size_t total = 1024 * 1024 * 1024;
+    static const std::size_t sizes[] = { 8, 24, 64, 4096, 1024 * 1024 };
+
+    std::mt19937 gen(1337);
+    char name[64];
+    for (const auto size : sizes)
+    {
+        std::string text;
+        while (text.size() < size)
+        {
+            text += static_cast<char>(((gen() % 2) ? 'A' : 'a') + gen() % 26);
+            text += (gen() % 8) ? "" : "_";
+        }
+        text.resize(size);
+
+        ZyanStringView view;
+        ASSERT_EQ(ZyanStringViewInsideBufferEx(&view, text.data(), size), ZYAN_STATUS_SUCCESS);
+        ZyanString string;
+        ASSERT_EQ(ZyanStringDuplicate(&string, &view, 0), ZYAN_STATUS_SUCCESS);
+
+        // Every iteration converts the whole string, as the case alternates
+        const std::size_t iterations = total / size;
+        std::snprintf(name, sizeof(name), "ToLower/ToUpperCase %9zu", size);
+        Benchmark(name, [&]()
+        {
+            for (std::size_t i = 0; i < iterations / 2; ++i)
+            {
+                ZyanStringToLowerCase(&string);
+                ZyanStringToUpperCase(&string);
+            }
+        });
+
+        std::string other = text;
+        for (auto& c : other)
+        {
+            c ^= ((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z')) ? 32 : 0;
+        }
+        ZyanStringView v1, v2;
+        ASSERT_EQ(ZyanStringViewInsideBufferEx(&v1, text.data(), size), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanStringViewInsideBufferEx(&v2, other.data(), size), ZYAN_STATUS_SUCCESS);
+        ZyanUSize equal = 0;
+        std::snprintf(name, sizeof(name), "CompareI %9zu", size);
+        Benchmark(name, [&]()
+        {
+            for (std::size_t i = 0; i < iterations; ++i)
+            {
+                ZyanI32 result;
+                equal += ZyanStringCompareI(&v1, &v2, &result) == ZYAN_STATUS_TRUE;
+            }
+        });
+        EXPECT_EQ(equal, iterations);
+
+        ASSERT_EQ(ZyanStringDestroy(&string), ZYAN_STATUS_SUCCESS);
+    }
+}
+
 /* ============================================================================================== */
 /* Entry point                                                                                    */
 /* ============================================================================================== */
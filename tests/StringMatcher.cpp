@@ -0,0 +1,435 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanStringMatcher` implementation.
+ */
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/StringMatcher.h>
+#include "Benchmark.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Defines a match as (end index, pattern, index, size) tuple.
+ */
+using Match = std::tuple<ZyanUSize, ZyanUSize, ZyanUSize, ZyanUSize>;
+
+/**
+ * @brief   Returns a list of views for the given patterns.
+ *
+ * @param   patterns    The patterns.
+ *
+ * @return  The views.
+ */
+static std::vector<ZyanStringView> Views(const std::vector<std::string>& patterns)
+{
+    std::vector<ZyanStringView> views(patterns.size());
+    for (std::size_t i = 0; i < patterns.size(); ++i)
+    {
+        EXPECT_EQ(patterns[i].empty() ? ZyanStringViewInsideBuffer(&views[i], "") :
+            ZyanStringViewInsideBufferEx(&views[i], patterns[i].data(), patterns[i].size()),
+            ZYAN_STATUS_SUCCESS);
+    }
+    return views;
+}
+
+/**
+ * @brief   Returns all matches reported by the given matcher.
+ *
+ * @param   matcher     A pointer to the `ZyanStringMatcher` instance.
+ * @param   haystack    The string to search in.
+ *
+ * @return  The matches.
+ */
+static std::vector<Match> FindAll(const ZyanStringMatcher* matcher, const std::string& haystack)
+{
+    ZyanStringView view;
+    EXPECT_EQ(haystack.empty() ? ZyanStringViewInsideBuffer(&view, "") :
+        ZyanStringViewInsideBufferEx(&view, haystack.data(), haystack.size()),
+        ZYAN_STATUS_SUCCESS);
+
+    ZyanVector vector;
+    EXPECT_EQ(ZyanVectorInit(&vector, sizeof(ZyanStringMatch), 0, nullptr), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanStringMatcherFindAll(matcher, &view, &vector), ZYAN_STATUS_SUCCESS);
+
+    std::vector<Match> result;
+    for (ZyanUSize i = 0; i < vector.size; ++i)
+    {
+        const auto* match = static_cast<const ZyanStringMatch*>(ZyanVectorGet(&vector, i));
+        result.emplace_back(match->index + match->size - 1, match->pattern, match->index,
+            match->size);
+    }
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    return result;
+}
+
+/**
+ * @brief   Finds all matches by comparing every pattern at every position.
+ *
+ * @param   patterns            The patterns.
+ * @param   haystack            The string to search in.
+ * @param   case_insensitive    `true` to ignore bit `0x20` of all characters.
+ *
+ * @return  The matches, sorted by their end index and decreasing size.
+ */
+static std::vector<Match> ReferenceFindAll(const std::vector<std::string>& patterns,
+    const std::string& haystack, bool case_insensitive)
+{
+    const char mask = case_insensitive ? 0x20 : 0x00;
+    std::vector<Match> result;
+    for (std::size_t end = 0; end < haystack.size(); ++end)
+    {
+        std::vector<Match> matches;
+        for (std::size_t p = 0; p < patterns.size(); ++p)
+        {
+            const auto& pattern = patterns[p];
+            if (pattern.size() > end + 1)
+            {
+                continue;
+            }
+            const std::size_t index = end + 1 - pattern.size();
+            std::size_t i = 0;
+            while ((i < pattern.size()) && ((haystack[index + i] | mask) == (pattern[i] | mask)))
+            {
+                ++i;
+            }
+            if (i == pattern.size())
+            {
+                matches.emplace_back(end, p, index, pattern.size());
+            }
+        }
+        std::stable_sort(matches.begin(), matches.end(), [](const Match& a, const Match& b)
+        {
+            return std::get<3>(a) > std::get<3>(b);
+        });
+        result.insert(result.end(), matches.begin(), matches.end());
+    }
+    return result;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(StringMatcherTest, Basic)
+{
+    const std::vector<std::string> patterns = { "he", "she", "his", "hers" };
+    const auto views = Views(patterns);
+
+    ZyanStringMatcher matcher;
+    ASSERT_EQ(ZyanStringMatcherInit(&matcher, views.data(), views.size(), 0),
+        ZYAN_STATUS_SUCCESS);
+
+    const std::vector<Match> expected =
+    {
+        Match(3, 1, 1, 3),
+        Match(3, 0, 2, 2),
+        Match(5, 3, 2, 4)
+    };
+    EXPECT_EQ(FindAll(&matcher, "ushers"), expected);
+    EXPECT_TRUE(FindAll(&matcher, "USHERS").empty());
+    EXPECT_TRUE(FindAll(&matcher, "").empty());
+
+    ZyanUSize count;
+    ASSERT_EQ(ZyanStringMatcherGetStateCount(&matcher, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, 10);
+    ASSERT_EQ(ZyanStringMatcherGetClassCount(&matcher, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, 6);
+
+    EXPECT_EQ(ZyanStringMatcherDestroy(&matcher), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringMatcherTest, CaseInsensitive)
+{
+    const std::vector<std::string> patterns = { "MOV", "rax", "qWoRd ptr" };
+    const auto views = Views(patterns);
+
+    ZyanStringMatcher matcher;
+    ASSERT_EQ(ZyanStringMatcherInit(&matcher, views.data(), views.size(),
+        ZYAN_STRING_MATCHER_CASE_INSENSITIVE), ZYAN_STATUS_SUCCESS);
+
+    const std::vector<Match> expected =
+    {
+        Match(2, 0, 0, 3),
+        Match(6, 1, 4, 3),
+        Match(17, 2, 9, 9)
+    };
+    EXPECT_EQ(FindAll(&matcher, "mov RAX, QWORD PTR [rbx]"), expected);
+
+    // Both cases share a character class
+    ZyanUSize count;
+    ASSERT_EQ(ZyanStringMatcherGetClassCount(&matcher, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, 13);
+
+    EXPECT_EQ(ZyanStringMatcherDestroy(&matcher), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringMatcherTest, OverlappingAndDuplicates)
+{
+    const std::vector<std::string> patterns = { "a", "aa", "b", "a", "aaa" };
+    const auto views = Views(patterns);
+
+    ZyanStringMatcher matcher;
+    ASSERT_EQ(ZyanStringMatcherInit(&matcher, views.data(), views.size(), 0),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(FindAll(&matcher, "aaaab"), ReferenceFindAll(patterns, "aaaab", false));
+    EXPECT_EQ(FindAll(&matcher, "aaaab").size(), 4 * 2 + 3 + 2 + 1);
+    EXPECT_EQ(ZyanStringMatcherDestroy(&matcher), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringMatcherTest, BinaryPatterns)
+{
+    // All 256 characters occur in the patterns, so no class is shared
+    std::vector<std::string> patterns;
+    for (int i = 0; i < 256; ++i)
+    {
+        patterns.push_back(std::string(1, static_cast<char>(i)) + '\0');
+    }
+    const auto views = Views(patterns);
+
+    ZyanStringMatcher matcher;
+    ASSERT_EQ(ZyanStringMatcherInit(&matcher, views.data(), views.size(), 0),
+        ZYAN_STATUS_SUCCESS);
+    ZyanUSize count;
+    ASSERT_EQ(ZyanStringMatcherGetClassCount(&matcher, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, 256);
+
+    const std::string haystack("\xFF\0\0\x80\0", 5);
+    EXPECT_EQ(FindAll(&matcher, haystack), ReferenceFindAll(patterns, haystack, false));
+    EXPECT_EQ(FindAll(&matcher, haystack).size(), 3);
+    EXPECT_EQ(ZyanStringMatcherDestroy(&matcher), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringMatcherTest, InvalidArguments)
+{
+    ZyanStringMatcher matcher;
+    std::vector<std::string> patterns = { "abc", "" };
+    auto views = Views(patterns);
+    EXPECT_EQ(ZyanStringMatcherInit(&matcher, views.data(), views.size(), 0),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanStringMatcherInit(&matcher, nullptr, 1, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanStringMatcherInit(nullptr, views.data(), 1, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    // A matcher without patterns never matches
+    ASSERT_EQ(ZyanStringMatcherInit(&matcher, nullptr, 0, 0), ZYAN_STATUS_SUCCESS);
+    EXPECT_TRUE(FindAll(&matcher, "abc").empty());
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU32), 0, nullptr), ZYAN_STATUS_SUCCESS);
+    ZyanStringView view;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&view, "abc"), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanStringMatcherFindAll(&matcher, &view, &vector), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanStringMatcherFind(&matcher, &view, nullptr, nullptr),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanStringMatcherDestroy(&matcher), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringMatcherTest, Callback)
+{
+    const std::vector<std::string> patterns = { "ab", "b" };
+    const auto views = Views(patterns);
+
+    ZyanStringMatcher matcher;
+    ASSERT_EQ(ZyanStringMatcherInit(&matcher, views.data(), views.size(), 0),
+        ZYAN_STATUS_SUCCESS);
+    ZyanStringView haystack;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&haystack, "abababab"), ZYAN_STATUS_SUCCESS);
+
+    // `ZYAN_STATUS_FALSE` stops the search
+    ZyanUSize count = 0;
+    EXPECT_EQ(ZyanStringMatcherFind(&matcher, &haystack,
+        [](const ZyanStringMatch*, void* user_data)
+        {
+            return (++*static_cast<ZyanUSize*>(user_data) == 3) ? ZYAN_STATUS_FALSE :
+                ZYAN_STATUS_TRUE;
+        }, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, 3);
+
+    // Errors abort the search
+    count = 0;
+    EXPECT_EQ(ZyanStringMatcherFind(&matcher, &haystack,
+        [](const ZyanStringMatch*, void* user_data)
+        {
+            return (++*static_cast<ZyanUSize*>(user_data) == 5) ? ZYAN_STATUS_ACCESS_DENIED :
+                ZYAN_STATUS_SUCCESS;
+        }, &count), ZYAN_STATUS_ACCESS_DENIED);
+    EXPECT_EQ(count, 5);
+
+    EXPECT_EQ(ZyanStringMatcherDestroy(&matcher), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringMatcherTest, Random)
+{
+    std::mt19937 gen(1337);
+    for (int iteration = 0; iteration < 300; ++iteration)
+    {
+        static const char* const alphabets[] = { "ab", "aAbB", "abcdefgh" };
+        const std::string alphabet = alphabets[iteration % 3];
+        const bool case_insensitive = (iteration / 3) % 2;
+
+        std::vector<std::string> patterns(1 + gen() % 40);
+        for (auto& pattern : patterns)
+        {
+            const std::size_t size = 1 + gen() % 6;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                pattern += alphabet[gen() % alphabet.size()];
+            }
+        }
+        std::string haystack;
+        const std::size_t size = gen() % 300;
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            haystack += alphabet[gen() % alphabet.size()];
+        }
+
+        const auto views = Views(patterns);
+        ZyanStringMatcher matcher;
+        ASSERT_EQ(ZyanStringMatcherInit(&matcher, views.data(), views.size(),
+            case_insensitive ? ZYAN_STRING_MATCHER_CASE_INSENSITIVE : 0), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(FindAll(&matcher, haystack),
+            ReferenceFindAll(patterns, haystack, case_insensitive)) << iteration;
+        ASSERT_EQ(ZyanStringMatcherDestroy(&matcher), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+TEST(StringMatcherBenchmark, DISABLED_Keywords)
+{
+    static const char* const words[] =
+    {
+        "mov", "rax", "rbx", "push", "call", "qword", "ptr", "lea", "rsp", "ret"
+    };
+
+    std::mt19937 gen(1337);
+    std::string haystack;
+    while (haystack.size() < 16 * 1024 * 1024)
+    {
+        haystack += words[gen() % 10];
+        haystack += (gen() % 8) ? ' ' : '\n';
+    }
+    ZyanStringView view;
+    ASSERT_EQ(ZyanStringViewInsideBufferEx(&view, haystack.data(), haystack.size()),
+        ZYAN_STATUS_SUCCESS);
+
+    char name[64];
+    for (const std::size_t count : { 10, 100, 1000, 10000 })
+    {
+        // Random identifiers, only two patterns occur in the haystack
+        std::vector<std::string> patterns;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (i < 2)
+            {
+                patterns.push_back(words[i]);
+                continue;
+            }
+            std::string pattern;
+            while (pattern.size() < 4 + i % 6)
+            {
+                pattern += static_cast<char>('a' + gen() % 26);
+            }
+            patterns.push_back(pattern);
+        }
+        const auto views = Views(patterns);
+
+        ZyanStringMatcher matcher;
+        std::snprintf(name, sizeof(name), "ZyanStringMatcherInit (%zu)", count);
+        Benchmark(name, [&]()
+        {
+            ASSERT_EQ(ZyanStringMatcherInit(&matcher, views.data(), views.size(),
+                ZYAN_STRING_MATCHER_CASE_INSENSITIVE), ZYAN_STATUS_SUCCESS);
+        });
+
+        ZyanUSize matches = 0;
+        std::snprintf(name, sizeof(name), "ZyanStringMatcherFind (%zu)", count);
+        Benchmark(name, [&]()
+        {
+            ASSERT_EQ(ZyanStringMatcherFind(&matcher, &view,
+                [](const ZyanStringMatch*, void* user_data)
+                {
+                    ++*static_cast<ZyanUSize*>(user_data);
+                    return ZYAN_STATUS_SUCCESS;
+                }, &matches), ZYAN_STATUS_SUCCESS);
+        });
+        ZyanUSize states;
+        ASSERT_EQ(ZyanStringMatcherGetStateCount(&matcher, &states), ZYAN_STATUS_SUCCESS);
+        std::printf("  %zu matches, %zu states\n", static_cast<std::size_t>(matches),
+            static_cast<std::size_t>(states));
+        ASSERT_EQ(ZyanStringMatcherDestroy(&matcher), ZYAN_STATUS_SUCCESS);
+
+        if (count > 100)
+        {
+            continue;
+        }
+
+        // One `ZyanStringLPosI` pass per pattern
+        ZyanUSize lpos_matches = 0;
+        std::snprintf(name, sizeof(name), "ZyanStringLPosI (%zu)", count);
+        Benchmark(name, [&]()
+        {
+            for (const auto& pattern : views)
+            {
+                ZyanUSize index = 0;
+                ZyanISize found;
+                while ((index < haystack.size()) && (ZyanStringLPosIEx(&view, &pattern, &found,
+                    index, haystack.size() - index) == ZYAN_STATUS_TRUE))
+                {
+                    ++lpos_matches;
+                    index = static_cast<ZyanUSize>(found) + 1;
+                }
+            }
+        });
+        EXPECT_EQ(lpos_matches, matches);
+    }
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
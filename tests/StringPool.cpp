@@ -0,0 +1,413 @@
+/***************************************************************************************************
+
+  Zyan Core Library (Zycore-C)
+
+  Original Author : agent
+
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+
+***************************************************************************************************/
+
+/**
+ * @file
+ * @brief   Tests the `ZyanStringPool` implementation.
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include <gtest/gtest.h>
+#include <Zycore/StringPool.h>
+#include <Zycore/TrackingAllocator.h>
+#include "Benchmark.h"
+
+/* ============================================================================================== */
+/* Helper functions                                                                               */
+/* ============================================================================================== */
+
+/**
+ * @brief   Interns the given string.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ * @param   string  The string.
+ * @param   id      Receives the ID of the string.
+ *
+ * @return  The status code returned by `ZyanStringPoolIntern`.
+ */
+static ZyanStatus Intern(ZyanStringPool* pool, const std::string& string, ZyanU32* id)
+{
+    return ZyanStringPoolInternBuffer(pool, string.data(), string.size(), id);
+}
+
+/**
+ * @brief   Returns the string with the given ID.
+ *
+ * @param   pool    A pointer to the `ZyanStringPool` instance.
+ * @param   id      The ID of the string.
+ *
+ * @return  The string.
+ */
+static std::string Lookup(ZyanStringPool* pool, ZyanU32 id)
+{
+    ZyanStringView view;
+    EXPECT_EQ(ZyanStringPoolGetView(pool, id, &view), ZYAN_STATUS_SUCCESS);
+    const char* data;
+    ZyanUSize size;
+    EXPECT_EQ(ZyanStringViewGetData(&view, &data), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanStringViewGetSize(&view, &size), ZYAN_STATUS_SUCCESS);
+    return std::string(data, size);
+}
+
+/**
+ * @brief   Returns a list of `count` tokens, built from `distinct` different strings.
+ *
+ * @param   count       The number of tokens.
+ * @param   distinct    The number of distinct strings.
+ *
+ * @return  The tokens.
+ */
+static std::vector<std::string> Tokens(std::size_t count, std::size_t distinct)
+{
+    std::vector<std::string> tokens;
+    tokens.reserve(count);
+    ZyanU64 state = 1337;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        tokens.push_back("identifier_" + std::to_string((state >> 33) % distinct));
+    }
+    return tokens;
+}
+
+/* ============================================================================================== */
+/* Tests                                                                                          */
+/* ============================================================================================== */
+
+TEST(StringPoolTest, InitAndDestroy)
+{
+    ZyanStringPool pool;
+    ASSERT_EQ(ZyanStringPoolInit(&pool, 0), ZYAN_STATUS_SUCCESS);
+    ZyanUSize size;
+    ASSERT_EQ(ZyanStringPoolGetSize(&pool, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 0);
+    EXPECT_EQ(ZyanStringPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanStringPoolInit(nullptr, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanStringPoolInitEx(&pool, 0, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(StringPoolTest, Intern)
+{
+    ZyanStringPool pool;
+    ASSERT_EQ(ZyanStringPoolInit(&pool, 0), ZYAN_STATUS_SUCCESS);
+
+    ZyanU32 a, b, c, d;
+    EXPECT_EQ(Intern(&pool, "alpha", &a), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(Intern(&pool, "beta", &b), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(Intern(&pool, "alpha", &c), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(Intern(&pool, "alph", &d), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(a, 0);
+    EXPECT_EQ(b, 1);
+    EXPECT_EQ(c, a);
+    EXPECT_EQ(d, 2);
+
+    // Interning a `ZyanStringView` yields the same ID
+    ZyanStringView view;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&view, "beta"), ZYAN_STATUS_SUCCESS);
+    ZyanU32 id;
+    EXPECT_EQ(ZyanStringPoolIntern(&pool, &view, &id), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(id, b);
+
+    EXPECT_EQ(Lookup(&pool, a), "alpha");
+    EXPECT_EQ(Lookup(&pool, b), "beta");
+    EXPECT_EQ(Lookup(&pool, d), "alph");
+
+    ZyanUSize size;
+    ASSERT_EQ(ZyanStringPoolGetSize(&pool, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 3);
+
+    EXPECT_EQ(ZyanStringPoolInternBuffer(&pool, nullptr, 1, &id), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanStringPoolIntern(&pool, nullptr, &id), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    EXPECT_EQ(ZyanStringPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringPoolTest, EmptyAndLargeStrings)
+{
+    ZyanStringPool pool;
+    ASSERT_EQ(ZyanStringPoolInit(&pool, 256), ZYAN_STATUS_SUCCESS);
+
+    ZyanU32 empty, id;
+    EXPECT_EQ(Intern(&pool, "", &empty), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(ZyanStringPoolInternBuffer(&pool, nullptr, 0, &id), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(id, empty);
+    EXPECT_EQ(Lookup(&pool, empty), "");
+
+    // Strings larger than the block size get a dedicated block
+    const std::string large(10000, 'x');
+    ZyanU32 large_id;
+    EXPECT_EQ(Intern(&pool, large, &large_id), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(Intern(&pool, large, &id), ZYAN_STATUS_FALSE);
+    EXPECT_EQ(id, large_id);
+    EXPECT_EQ(Lookup(&pool, large_id), large);
+
+    // Embedded zero characters are part of the string
+    const std::string binary("a\0b", 3);
+    EXPECT_EQ(Intern(&pool, binary, &id), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(Lookup(&pool, id), binary);
+    EXPECT_EQ(Intern(&pool, "a", &id), ZYAN_STATUS_TRUE);
+
+    EXPECT_EQ(ZyanStringPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringPoolTest, StableViews)
+{
+    ZyanStringPool pool;
+    ASSERT_EQ(ZyanStringPoolInit(&pool, 1024), ZYAN_STATUS_SUCCESS);
+
+    std::vector<const char*> pointers;
+    std::vector<std::string> strings;
+    for (int i = 0; i < 10000; ++i)
+    {
+        strings.push_back("string_" + std::to_string(i));
+        ZyanU32 id;
+        ASSERT_EQ(Intern(&pool, strings.back(), &id), ZYAN_STATUS_TRUE);
+        ASSERT_EQ(id, static_cast<ZyanU32>(i));
+
+        ZyanStringView view;
+        ASSERT_EQ(ZyanStringPoolGetView(&pool, id, &view), ZYAN_STATUS_SUCCESS);
+        const char* data;
+        ASSERT_EQ(ZyanStringViewGetData(&view, &data), ZYAN_STATUS_SUCCESS);
+        pointers.push_back(data);
+    }
+
+    // The characters never move and are zero terminated
+    for (ZyanU32 i = 0; i < strings.size(); ++i)
+    {
+        ZyanStringView view;
+        ASSERT_EQ(ZyanStringPoolGetView(&pool, i, &view), ZYAN_STATUS_SUCCESS);
+        const char* data;
+        ASSERT_EQ(ZyanStringViewGetData(&view, &data), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(data, pointers[i]);
+        EXPECT_STREQ(data, strings[i].c_str());
+    }
+
+    EXPECT_EQ(ZyanStringPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringPoolTest, Find)
+{
+    ZyanStringPool pool;
+    ASSERT_EQ(ZyanStringPoolInit(&pool, 0), ZYAN_STATUS_SUCCESS);
+
+    ZyanU32 id;
+    ASSERT_EQ(Intern(&pool, "foo", &id), ZYAN_STATUS_TRUE);
+    ASSERT_EQ(Intern(&pool, "bar", &id), ZYAN_STATUS_TRUE);
+
+    ZyanStringView view;
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&view, "bar"), ZYAN_STATUS_SUCCESS);
+    ZyanU32 found = 0;
+    EXPECT_EQ(ZyanStringPoolFind(&pool, &view, &found), ZYAN_STATUS_TRUE);
+    EXPECT_EQ(found, id);
+    EXPECT_EQ(ZyanStringPoolFind(&pool, &view, nullptr), ZYAN_STATUS_TRUE);
+
+    // Lookups never add strings
+    ASSERT_EQ(ZyanStringViewInsideBuffer(&view, "baz"), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanStringPoolFind(&pool, &view, &found), ZYAN_STATUS_FALSE);
+    ZyanUSize size;
+    ASSERT_EQ(ZyanStringPoolGetSize(&pool, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 2);
+
+    EXPECT_EQ(ZyanStringPoolGetView(&pool, 2, &view), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanStringPoolGetView(&pool, 0xFFFFFFFF, &view), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanStringPoolGetView(&pool, 0, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    EXPECT_EQ(ZyanStringPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(StringPoolTest, CustomAllocator)
+{
+    ZyanTrackingAllocator tracking;
+    ASSERT_EQ(ZyanTrackingInit(&tracking), ZYAN_STATUS_SUCCESS);
+
+    ZyanStringPool pool;
+    ASSERT_EQ(ZyanStringPoolInitEx(&pool, 4096, &tracking.allocator), ZYAN_STATUS_SUCCESS);
+    for (const auto& token : Tokens(10000, 500))
+    {
+        ZyanU32 id;
+        ASSERT_TRUE(ZYAN_SUCCESS(Intern(&pool, token, &id)));
+    }
+    ASSERT_EQ(ZyanStringPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+
+    // All memory is released
+    ZyanTrackingStatistics statistics;
+    ASSERT_EQ(ZyanTrackingGetStatistics(&tracking, &statistics), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(statistics.bytes_live, 0);
+    EXPECT_EQ(statistics.allocation_count, statistics.deallocation_count);
+}
+
+TEST(StringPoolTest, ConcurrentAccess)
+{
+    ZyanStringPool pool;
+    ASSERT_EQ(ZyanStringPoolInit(&pool, 1024), ZYAN_STATUS_SUCCESS);
+
+    const auto tokens = Tokens(20000, 2000);
+    std::vector<ZyanU32> ids[4];
+    std::atomic<bool> failed(false);
+
+    // Multiple threads intern the same tokens and must agree on the IDs
+    std::vector<std::thread> threads;
+    for (auto& result : ids)
+    {
+        threads.emplace_back([&]()
+        {
+            for (const auto& token : tokens)
+            {
+                ZyanU32 id;
+                if (!ZYAN_SUCCESS(Intern(&pool, token, &id)) || (Lookup(&pool, id) != token))
+                {
+                    failed = true;
+                }
+                result.push_back(id);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_FALSE(failed);
+    for (const auto& result : ids)
+    {
+        EXPECT_EQ(result, ids[0]);
+    }
+    ZyanUSize size;
+    ASSERT_EQ(ZyanStringPoolGetSize(&pool, &size), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(size, 2000);
+
+    EXPECT_EQ(ZyanStringPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+TEST(StringPoolBenchmark, DISABLED_Intern)
+{
+    const auto tokens = Tokens(1000000, 20000);
+    ZyanU64 checksum_zyan = 0;
+    ZyanU64 checksum_std = 0;
+
+    ZyanTrackingAllocator tracking;
+    ASSERT_EQ(ZyanTrackingInit(&tracking), ZYAN_STATUS_SUCCESS);
+    ZyanStringPool pool;
+    ASSERT_EQ(ZyanStringPoolInitEx(&pool, 0, &tracking.allocator), ZYAN_STATUS_SUCCESS);
+    std::vector<ZyanU32> ids(tokens.size());
+    Benchmark("ZyanStringPool intern", [&]()
+    {
+        for (std::size_t i = 0; i < tokens.size(); ++i)
+        {
+            Intern(&pool, tokens[i], &ids[i]);
+            checksum_zyan += ids[i];
+        }
+    });
+
+    std::unordered_map<std::string, ZyanU32> map;
+    Benchmark("std::unordered_map intern", [&]()
+    {
+        for (const auto& token : tokens)
+        {
+            checksum_std += map.emplace(token, static_cast<ZyanU32>(map.size())).first->second;
+        }
+    });
+
+    // Comparing interned strings only requires comparing their IDs
+    ZyanUSize equal_ids = 0;
+    Benchmark("ZyanStringPool compare (IDs)", [&]()
+    {
+        for (std::size_t i = 1; i < ids.size(); ++i)
+        {
+            equal_ids += (ids[i] == ids[i - 1]);
+        }
+    });
+
+    std::vector<ZyanStringView> views(tokens.size());
+    for (std::size_t i = 0; i < tokens.size(); ++i)
+    {
+        ZyanStringViewInsideBufferEx(&views[i], tokens[i].data(), tokens[i].size());
+    }
+    ZyanUSize equal_strings = 0;
+    Benchmark("ZyanStringCompare", [&]()
+    {
+        for (std::size_t i = 1; i < views.size(); ++i)
+        {
+            ZyanI32 result;
+            ZyanStringCompare(&views[i], &views[i - 1], &result);
+            equal_strings += (result == 0);
+        }
+    });
+    EXPECT_EQ(equal_ids, equal_strings);
+
+    ZyanTrackingStatistics statistics;
+    ASSERT_EQ(ZyanTrackingGetStatistics(&tracking, &statistics), ZYAN_STATUS_SUCCESS);
+    std::printf("ZyanStringPool: %llu allocations, %llu bytes live\n",
+        static_cast<unsigned long long>(statistics.allocation_count),
+        static_cast<unsigned long long>(statistics.bytes_live));
+
+    // One `ZyanString` per distinct string for comparison
+    ZyanTrackingAllocator tracking_strings;
+    ASSERT_EQ(ZyanTrackingInit(&tracking_strings), ZYAN_STATUS_SUCCESS);
+    std::vector<ZyanString> strings(map.size());
+    for (const auto& entry : map)
+    {
+        ZyanStringInitEx(&strings[entry.second], entry.first.size(), &tracking_strings.allocator,
+            ZYAN_STRING_DEFAULT_GROWTH_FACTOR, ZYAN_STRING_DEFAULT_SHRINK_THRESHOLD);
+        ZyanStringView view;
+        ZyanStringViewInsideBufferEx(&view, entry.first.data(), entry.first.size());
+        ZyanStringAppend(&strings[entry.second], &view);
+    }
+    ASSERT_EQ(ZyanTrackingGetStatistics(&tracking_strings, &statistics), ZYAN_STATUS_SUCCESS);
+    std::printf("ZyanString:     %llu allocations, %llu bytes live\n",
+        static_cast<unsigned long long>(statistics.allocation_count),
+        static_cast<unsigned long long>(statistics.bytes_live));
+    for (auto& string : strings)
+    {
+        ZyanStringDestroy(&string);
+    }
+
+    EXPECT_EQ(checksum_zyan, checksum_std);
+    ASSERT_EQ(ZyanStringPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+/* ============================================================================================== */
+/* Entry point                                                                                    */
+/* ============================================================================================== */
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
+
+/* ============================================================================================== */
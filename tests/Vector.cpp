@@ -29,10 +29,21 @@
  * @brief   Tests the `ZyanVector` implementation.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
 #include <time.h>
 #include <gtest/gtest.h>
+#include <Zycore/Bitset.h>
 #include <Zycore/Comparison.h>
+#include <Zycore/EytzingerIndex.h>
+#include <Zycore/ThreadPool.h>
 #include <Zycore/Vector.h>
+#include "Benchmark.h"
 
 /* ============================================================================================== */
 /* Fixtures                                                                                       */
@@ -135,6 +146,163 @@ static ZyanStatus FreeZyanU16(ZyanU16* object)
     return ZYAN_STATUS_SUCCESS;
 }
 
+/**
+ * @brief   A record with a signed sort key and a payload that identifies its original position.
+ */
+struct SortRecord
+{
+    ZyanU32 payload;
+    ZyanI32 key;
+};
+
+/**
+ * @brief   Compares two `SortRecord` objects by their key.
+ *
+ * @param   left    A pointer to the first record.
+ * @param   right   A pointer to the second record.
+ *
+ * @return  The comparison result.
+ */
+static ZyanI32 CompareSortRecord(const SortRecord* left, const SortRecord* right)
+{
+    return (left->key < right->key) ? -1 : (left->key > right->key) ? 1 : 0;
+}
+
+ZYAN_INLINE ZYAN_DECLARE_VECTOR_FIND(FindU64, ZyanU64)
+ZYAN_INLINE ZYAN_DECLARE_VECTOR_LOWER_BOUND(LowerBoundU64, ZyanU64)
+ZYAN_INLINE ZYAN_DECLARE_VECTOR_UPPER_BOUND(UpperBoundU64, ZyanU64)
+ZYAN_INLINE ZYAN_DECLARE_VECTOR_BINARY_SEARCH(BinarySearchU64, ZyanU64)
+ZYAN_INLINE ZYAN_DECLARE_EYTZINGER_SEARCH(EytzingerSearchU64, ZyanU64)
+ZYAN_INLINE ZYAN_DECLARE_VECTOR_FIND_FOR_FIELD(FindRecord, SortRecord, ZyanI32, key)
+ZYAN_INLINE ZYAN_DECLARE_VECTOR_LOWER_BOUND_FOR_FIELD(LowerBoundRecord, SortRecord, ZyanI32, key)
+ZYAN_INLINE ZYAN_DECLARE_VECTOR_UPPER_BOUND_FOR_FIELD(UpperBoundRecord, SortRecord, ZyanI32, key)
+ZYAN_INLINE ZYAN_DECLARE_VECTOR_BINARY_SEARCH_FOR_FIELD(BinarySearchRecord, SortRecord, ZyanI32,
+    key)
+
+/**
+ * @brief   A `qsort` compatible comparison function for `ZyanU64` values.
+ *
+ * @param   left    A pointer to the first value.
+ * @param   right   A pointer to the second value.
+ *
+ * @return  The comparison result.
+ */
+static int CompareU64(const void* left, const void* right)
+{
+    const ZyanU64 a = *static_cast<const ZyanU64*>(left);
+    const ZyanU64 b = *static_cast<const ZyanU64*>(right);
+    return (a < b) ? -1 : (a > b) ? 1 : 0;
+}
+
+/**
+ * @brief   A `ZyanVectorPredicate` that matches all `ZyanU64` values that are divisible by the
+ *          given divisor.
+ *
+ * @param   element     A pointer to the element.
+ * @param   user_data   A pointer to the `ZyanU64` divisor.
+ *
+ * @return  `ZYAN_TRUE`, if the element is divisible by the divisor or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool IsDivisibleU64(const void* element, void* user_data)
+{
+    return (*static_cast<const ZyanU64*>(element) % *static_cast<const ZyanU64*>(user_data)) ?
+        ZYAN_FALSE : ZYAN_TRUE;
+}
+
+/**
+ * @brief   A `ZyanVectorPredicate` that matches `ZyanU64` elements divisible by 3 and counts how
+ *          often it was invoked for every value.
+ *
+ * @param   element     A pointer to the element.
+ * @param   user_data   A pointer to a `std::vector<ZyanUSize>` that receives the call counts,
+ *                      indexed by the element value.
+ *
+ * @return  `ZYAN_TRUE`, if the element is divisible by 3 or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool CountCallsU64(const void* element, void* user_data)
+{
+    const ZyanU64 value = *static_cast<const ZyanU64*>(element);
+    ++(*static_cast<std::vector<ZyanUSize>*>(user_data))[static_cast<std::size_t>(value)];
+    return (value % 3) ? ZYAN_FALSE : ZYAN_TRUE;
+}
+
+/**
+ * @brief   The `ZyanU16` values passed to `RecordZyanU16`.
+ */
+static std::vector<ZyanU16> destroyed_values;
+
+/**
+ * @brief   A destructor for `ZyanU16` objects that records the destroyed values.
+ *
+ * @param   object  A pointer to the object.
+ */
+static void RecordZyanU16(void* object)
+{
+    destroyed_values.push_back(*static_cast<const ZyanU16*>(object));
+}
+
+/**
+ * @brief   A `ZyanVectorPredicate` that matches all odd `ZyanU16` values.
+ *
+ * @param   element     A pointer to the element.
+ * @param   user_data   Unused.
+ *
+ * @return  `ZYAN_TRUE`, if the element is odd or `ZYAN_FALSE`, if not.
+ */
+static ZyanBool IsOddU16(const void* element, void* user_data)
+{
+    ZYAN_UNUSED(user_data);
+    return (*static_cast<const ZyanU16*>(element) & 1) ? ZYAN_TRUE : ZYAN_FALSE;
+}
+
+/**
+ * @brief   A `ZyanVectorRangeFunction` that adds the index plus one to every `ZyanU64` element of
+ *          the range.
+ *
+ * @param   elements    A pointer to the first element of the range.
+ * @param   index       The index of the first element of the range.
+ * @param   count       The number of elements in the range.
+ * @param   user_data   A pointer to a `ZyanUSize` that receives the minimum range size.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus AddIndexToRange(void* elements, ZyanUSize index, ZyanUSize count,
+    void* user_data)
+{
+    auto* const values = static_cast<ZyanU64*>(elements);
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        values[i] += index + i + 1;
+    }
+
+    auto* const minimum = static_cast<std::atomic<ZyanUSize>*>(user_data);
+    ZyanUSize current = minimum->load();
+    while ((count < current) && !minimum->compare_exchange_weak(current, count))
+    {
+    }
+
+    return ZYAN_STATUS_SUCCESS;
+}
+
+/**
+ * @brief   A `ZyanVectorRangeFunction` that fails for all ranges except the first one.
+ *
+ * @param   elements    A pointer to the first element of the range.
+ * @param   index       The index of the first element of the range.
+ * @param   count       The number of elements in the range.
+ * @param   user_data   Unused.
+ *
+ * @return  A zyan status code.
+ */
+static ZyanStatus FailRange(void* elements, ZyanUSize index, ZyanUSize count, void* user_data)
+{
+    ZYAN_UNUSED(elements);
+    ZYAN_UNUSED(count);
+    ZYAN_UNUSED(user_data);
+
+    return index ? ZYAN_STATUS_INVALID_OPERATION : ZYAN_STATUS_SUCCESS;
+}
+
 /* ============================================================================================== */
 /* Tests                                                                                          */
 /* ============================================================================================== */
@@ -205,6 +373,203 @@ TEST(VectorTest, InitCustomBuffer)
     EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
 }
 
+TEST(VectorTest, InitAligned)
+{
+    ZyanVector vector;
+
+    EXPECT_EQ(ZyanVectorInitAligned(&vector, sizeof(ZyanU16), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), 0), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanVectorInitAligned(&vector, sizeof(ZyanU16), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), 48), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanVectorInitAligned(&vector, sizeof(ZyanU16), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL), 64), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector.alignment, static_cast<ZyanUSize>(64));
+
+    for (ZyanU16 i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(reinterpret_cast<ZyanUPointer>(vector.data) % 64, 0u);
+    }
+
+    ZyanVector copy;
+    ASSERT_EQ(ZyanVectorDuplicate(&copy, &vector, 0), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(copy.alignment, static_cast<ZyanUSize>(64));
+    EXPECT_EQ(reinterpret_cast<ZyanUPointer>(copy.data) % 64, 0u);
+    EXPECT_EQ(ZyanVectorDestroy(&copy), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU16 i = 0; i < 1000; ++i)
+    {
+        ASSERT_EQ(*static_cast<const ZyanU16*>(ZyanVectorGet(&vector, 0)), i);
+        ASSERT_EQ(ZyanVectorDelete(&vector, 0), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(reinterpret_cast<ZyanUPointer>(vector.data) % 64, 0u);
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, GrowthPolicies)
+{
+    const ZyanGrowthPolicy* policy = ZyanGrowthPolicyGeometric();
+    EXPECT_EQ(policy->calculate(policy, 1, 100), static_cast<ZyanUSize>(150));
+
+    policy = ZyanGrowthPolicyPowerOfTwo();
+    EXPECT_EQ(policy->calculate(policy, 1, 100), static_cast<ZyanUSize>(128));
+    EXPECT_EQ(policy->calculate(policy, 1, 128), static_cast<ZyanUSize>(128));
+
+    policy = ZyanGrowthPolicySizeClass();
+    EXPECT_EQ(policy->calculate(policy, 1, 20), static_cast<ZyanUSize>(32));
+    EXPECT_EQ(policy->calculate(policy, 4, 100), static_cast<ZyanUSize>(160));
+    EXPECT_EQ(policy->calculate(policy, 1, 10000), static_cast<ZyanUSize>(16384));
+
+    ZyanGrowthPolicy linear;
+    EXPECT_EQ(ZyanGrowthPolicyInitLinear(nullptr, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanGrowthPolicyInitLinear(&linear, 1024), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(linear.calculate(&linear, 8, 100), static_cast<ZyanUSize>(150));
+    EXPECT_EQ(linear.calculate(&linear, 8, 1000), static_cast<ZyanUSize>(1128));
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU32), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanVectorSetGrowthPolicy(&vector, &linear), ZYAN_STATUS_SUCCESS);
+
+    // The capacity never exceeds the size by more than the linear threshold
+    for (ZyanU32 i = 0; i < 100000; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+        ASSERT_LE(vector.capacity - vector.size, 1024 / sizeof(ZyanU32));
+    }
+    for (ZyanU32 i = 0; i < 100000; i += 113)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU32, &vector, i), i);
+    }
+
+    EXPECT_EQ(ZyanVectorSetGrowthPolicy(&vector, ZyanGrowthPolicyPowerOfTwo()),
+        ZYAN_STATUS_SUCCESS);
+    const ZyanU32 value = 0;
+    ASSERT_EQ(ZyanVectorResize(&vector, 200000), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorPushBack(&vector, &value), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector.capacity, static_cast<ZyanUSize>(262144));
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+
+    ZyanU32 buffer[4];
+    ASSERT_EQ(ZyanVectorInitCustomBuffer(&vector, sizeof(ZyanU32), buffer,
+        ZYAN_ARRAY_LENGTH(buffer), reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanVectorSetGrowthPolicy(&vector, &linear), ZYAN_STATUS_INVALID_OPERATION);
+}
+
+ZYAN_DECLARE_SMALL_VECTOR(SmallVectorU16, ZyanU16, 8);
+
+TEST(VectorTest, InitSmallBuffer)
+{
+    SmallVectorU16 small;
+    ZyanVector* const vector = &small.vector;
+
+    EXPECT_EQ(ZyanVectorInitSmallBufferEx(vector, sizeof(ZyanU16), small.buffer,
+        ZYAN_ARRAY_LENGTH(small.buffer), reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL),
+        nullptr, 2, 4), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanVectorInitSmallBuffer(vector, sizeof(ZyanU16), small.buffer,
+        ZYAN_ARRAY_LENGTH(small.buffer), reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)),
+        ZYAN_STATUS_SUCCESS);
+
+    // The small buffer is used until it overflows
+    for (ZyanU16 i = 0; i < 8; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(vector->data, static_cast<void*>(small.buffer));
+    ASSERT_EQ(ZyanVectorDeleteRange(vector, 2, 6), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorShrinkToFit(vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector->data, static_cast<void*>(small.buffer));
+    EXPECT_EQ(vector->capacity, static_cast<ZyanUSize>(8));
+
+    // Overflowing moves the elements to the heap transparently
+    const ZyanU16 values[10] = { 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+    ASSERT_EQ(ZyanVectorInsertRange(vector, 2, values, ZYAN_ARRAY_LENGTH(values)),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_NE(vector->data, static_cast<void*>(small.buffer));
+    EXPECT_FALSE(vector->in_small_buffer);
+    ASSERT_EQ(vector->size, static_cast<ZyanUSize>(12));
+    for (ZyanU16 i = 0; i < 12; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU16, vector, i), i);
+    }
+    for (ZyanU16 i = 12; i < 1000; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanU16 i = 0; i < 990; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPopBack(vector), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanU16 i = 0; i < 10; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU16, vector, i), i);
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(vector), ZYAN_STATUS_SUCCESS);
+
+    // Vectors that never overflow do not allocate any memory
+    ASSERT_EQ(ZyanVectorInitSmallBuffer(vector, sizeof(ZyanU16), small.buffer,
+        ZYAN_ARRAY_LENGTH(small.buffer), reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)),
+        ZYAN_STATUS_SUCCESS);
+    const ZyanU16 value = 42;
+    ASSERT_EQ(ZyanVectorPushBack(vector, &value), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(small.buffer[0], value);
+    EXPECT_EQ(ZyanVectorDestroy(vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, InitVirtual)
+{
+    ZyanVector vector;
+
+    EXPECT_EQ(ZyanVectorInitVirtual(&vector, sizeof(ZyanU64), 0, 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanVectorInitVirtual(&vector, sizeof(ZyanU64), 16, 8,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    static const ZyanUSize max_capacity = 1024 * 1024;
+    ASSERT_EQ(ZyanVectorInitVirtual(&vector, sizeof(ZyanU64), 0, max_capacity,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+
+    const void* const data = vector.data;
+    for (ZyanU64 i = 0; i < max_capacity; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    const ZyanU64* const first = static_cast<const ZyanU64*>(ZyanVectorGet(&vector, 0));
+    EXPECT_EQ(vector.data, data);
+    EXPECT_EQ(vector.capacity, max_capacity);
+
+    const ZyanU64 value = 0;
+    EXPECT_EQ(ZyanVectorPushBack(&vector, &value), ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+    EXPECT_EQ(ZyanVectorInsert(&vector, 0, &value), ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+
+    ASSERT_EQ(ZyanVectorResize(&vector, 10), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorShrinkToFit(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(vector.capacity, static_cast<ZyanUSize>(10));
+    EXPECT_EQ(vector.data, data);
+    EXPECT_EQ(ZyanVectorGet(&vector, 0), first);
+
+    for (ZyanU64 i = 10; i < 10000; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+    for (ZyanU64 i = 0; i < 10000; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU64, &vector, i), i);
+    }
+    EXPECT_EQ(vector.data, data);
+
+    ZyanVector copy;
+    ASSERT_EQ(ZyanVectorDuplicate(&copy, &vector, 0), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(copy.size, static_cast<ZyanUSize>(10000));
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &copy, 9999), static_cast<ZyanU64>(9999));
+    EXPECT_EQ(ZyanVectorDestroy(&copy), ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
 TEST(VectorTest, Destructor)
 {
     ZyanVector vector;
@@ -249,6 +614,32 @@ TEST(VectorTest, Destructor)
     }
 }
 
+TEST(VectorTest, DestructorOnRemove)
+{
+    ZyanVector vector;
+    ZyanU16 buffer[16];
+    ASSERT_EQ(ZyanVectorInitCustomBuffer(&vector, sizeof(ZyanU16), &buffer,
+        ZYAN_ARRAY_LENGTH(buffer), &RecordZyanU16), ZYAN_STATUS_SUCCESS);
+    for (ZyanU16 i = 0; i < ZYAN_ARRAY_LENGTH(buffer); ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+
+    // Only the removed elements are destroyed, moved elements are not
+    destroyed_values.clear();
+    ASSERT_EQ(ZyanVectorRemoveIf(&vector, &IsOddU16, nullptr, nullptr), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(destroyed_values, std::vector<ZyanU16>({ 1, 3, 5, 7, 9, 11, 13, 15 }));
+
+    destroyed_values.clear();
+    ASSERT_EQ(ZyanVectorDeleteSwapBack(&vector, 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(destroyed_values, std::vector<ZyanU16>({ 2 }));
+    EXPECT_EQ(buffer[1], 14);
+
+    destroyed_values.clear();
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(destroyed_values, std::vector<ZyanU16>({ 0, 14, 4, 6, 8, 10, 12 }));
+}
+
 TEST(VectorTest, TestGrowingAndShrinking)
 {
     ZyanVector vector;
@@ -283,6 +674,504 @@ TEST(VectorTest, TestGrowingAndShrinking)
     EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
 }
 
+TEST(VectorTest, Sort)
+{
+    std::mt19937_64 rng(1337);
+    for (ZyanUSize size : { 0, 1, 2, 15, 16, 17, 100, 1000, 50000 })
+    {
+        for (ZyanU64 modulo : { 2, 1000, 0 })
+        {
+            std::vector<ZyanU64> expected(size);
+            for (auto& value : expected)
+            {
+                value = modulo ? rng() % modulo : rng();
+            }
+
+            ZyanVector vector;
+            ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), size,
+                reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+            if (size)
+            {
+                ASSERT_EQ(ZyanVectorPushBackRange(&vector, expected.data(), size),
+                    ZYAN_STATUS_SUCCESS);
+            }
+
+            ASSERT_EQ(ZyanVectorSort(&vector,
+                reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), ZYAN_STATUS_SUCCESS);
+            std::sort(expected.begin(), expected.end());
+            for (ZyanUSize i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU64, &vector, i), expected[i]);
+            }
+
+            // Already sorted and reversed input
+            ASSERT_EQ(ZyanVectorSort(&vector,
+                reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), ZYAN_STATUS_SUCCESS);
+            std::reverse(static_cast<ZyanU64*>(vector.data),
+                static_cast<ZyanU64*>(vector.data) + size);
+            ASSERT_EQ(ZyanVectorSort(&vector,
+                reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), ZYAN_STATUS_SUCCESS);
+            for (ZyanUSize i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU64, &vector, i), expected[i]);
+            }
+
+            EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+        }
+    }
+
+    // Sub-ranges and elements larger than the internal swap buffer
+    struct LargeElement
+    {
+        ZyanU32 value;
+        ZyanU8 padding[96];
+    };
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(LargeElement), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0; i < 1000; ++i)
+    {
+        LargeElement element;
+        element.value = 999 - i;
+        std::fill(std::begin(element.padding), std::end(element.padding),
+            static_cast<ZyanU8>(element.value));
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &element), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(ZyanVectorSortEx(&vector, reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric32),
+        1, 1000), ZYAN_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(ZyanVectorSortEx(&vector, nullptr, 0, 1000), ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanVectorSortEx(&vector, reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric32),
+        100, 800), ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0; i < 1000; ++i)
+    {
+        const auto& element = ZYAN_VECTOR_GET(LargeElement, &vector, i);
+        const ZyanU32 expected = ((i < 100) || (i >= 900)) ? 999 - i : 100 + (i - 100);
+        ASSERT_EQ(element.value, expected);
+        ASSERT_EQ(element.padding[95], static_cast<ZyanU8>(expected));
+    }
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, SortByKey)
+{
+    std::mt19937 rng(1337);
+    std::vector<SortRecord> expected(100000);
+    for (ZyanU32 i = 0; i < expected.size(); ++i)
+    {
+        expected[i].payload = i;
+        expected[i].key = static_cast<ZyanI32>(rng() % 2000) - 1000;
+    }
+
+    SortRecord buffer[4];
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInitCustomBuffer(&vector, sizeof(SortRecord), buffer,
+        ZYAN_ARRAY_LENGTH(buffer), reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanVectorSortByKey(&vector, offsetof(SortRecord, key), 3, ZYAN_TRUE),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanVectorSortByKey(&vector, offsetof(SortRecord, key), 8, ZYAN_TRUE),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+    ASSERT_EQ(ZyanVectorPushBackRange(&vector, expected.data(), 4), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorSortByKey(&vector, offsetof(SortRecord, key), sizeof(ZyanI32),
+        ZYAN_TRUE), ZYAN_STATUS_SUCCESS);
+    EXPECT_TRUE(std::is_sorted(buffer, buffer + 4, [](const SortRecord& a, const SortRecord& b)
+    {
+        return a.key < b.key;
+    }));
+
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(SortRecord), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorPushBackRange(&vector, expected.data(), expected.size()),
+        ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorSortByKey(&vector, offsetof(SortRecord, key), sizeof(ZyanI32),
+        ZYAN_TRUE), ZYAN_STATUS_SUCCESS);
+
+    // The radix sort is stable
+    std::stable_sort(expected.begin(), expected.end(), [](const SortRecord& a, const SortRecord& b)
+    {
+        return a.key < b.key;
+    });
+    for (ZyanUSize i = 0; i < expected.size(); ++i)
+    {
+        const auto& record = ZYAN_VECTOR_GET(SortRecord, &vector, i);
+        ASSERT_EQ(record.key, expected[i].key);
+        ASSERT_EQ(record.payload, expected[i].payload);
+    }
+
+    // Sort back by the unsigned payload
+    ASSERT_EQ(ZyanVectorSortByKey(&vector, offsetof(SortRecord, payload), sizeof(ZyanU32),
+        ZYAN_FALSE), ZYAN_STATUS_SUCCESS);
+    for (ZyanU32 i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(SortRecord, &vector, i).payload, i);
+    }
+
+    // Compare with the generic sort
+    ASSERT_EQ(ZyanVectorSort(&vector, reinterpret_cast<ZyanComparison>(&CompareSortRecord)),
+        ZYAN_STATUS_SUCCESS);
+    for (ZyanUSize i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(SortRecord, &vector, i).key, expected[i].key);
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, TypedSearch)
+{
+    std::mt19937_64 rng(1337);
+    std::vector<ZyanU64> values(1000);
+    for (auto& value : values)
+    {
+        value = (rng() % 500) * 2;
+    }
+    std::sort(values.begin(), values.end());
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(FindU64(&vector, 0), -1);
+    EXPECT_EQ(LowerBoundU64(&vector, 0), static_cast<ZyanUSize>(0));
+    EXPECT_EQ(UpperBoundU64(&vector, 0), static_cast<ZyanUSize>(0));
+    ASSERT_EQ(ZyanVectorPushBackRange(&vector, values.data(), values.size()), ZYAN_STATUS_SUCCESS);
+
+    for (ZyanU64 value = 0; value < 1002; ++value)
+    {
+        const auto lower = std::lower_bound(values.begin(), values.end(), value);
+        const auto upper = std::upper_bound(values.begin(), values.end(), value);
+        const ZyanBool exists = (lower != upper) ? ZYAN_TRUE : ZYAN_FALSE;
+
+        EXPECT_EQ(FindU64(&vector, value), exists ? lower - values.begin() : -1);
+        EXPECT_EQ(LowerBoundU64(&vector, value),
+            static_cast<ZyanUSize>(lower - values.begin()));
+        EXPECT_EQ(UpperBoundU64(&vector, value),
+            static_cast<ZyanUSize>(upper - values.begin()));
+
+        ZyanUSize index;
+        EXPECT_EQ(BinarySearchU64(&vector, value, &index), exists);
+        EXPECT_EQ(index, static_cast<ZyanUSize>(lower - values.begin()));
+
+        // Must match the generic binary-search
+        ZyanUSize index_generic;
+        const ZyanStatus status = ZyanVectorBinarySearch(&vector, &value, &index_generic,
+            reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64));
+        EXPECT_EQ(status == ZYAN_STATUS_TRUE, exists == ZYAN_TRUE);
+        EXPECT_EQ(index, index_generic);
+    }
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+
+    // Field variants
+    const SortRecord records[] =
+    {
+        { 0, -5 }, { 1, -5 }, { 2, 0 }, { 3, 7 }, { 4, 7 }, { 5, 7 }, { 6, 9 }
+    };
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(SortRecord), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorPushBackRange(&vector, records, ZYAN_ARRAY_LENGTH(records)),
+        ZYAN_STATUS_SUCCESS);
+
+    EXPECT_EQ(FindRecord(&vector, 7), 3);
+    EXPECT_EQ(FindRecord(&vector, 8), -1);
+    EXPECT_EQ(LowerBoundRecord(&vector, -6), static_cast<ZyanUSize>(0));
+    EXPECT_EQ(LowerBoundRecord(&vector, 7), static_cast<ZyanUSize>(3));
+    EXPECT_EQ(UpperBoundRecord(&vector, 7), static_cast<ZyanUSize>(6));
+    EXPECT_EQ(UpperBoundRecord(&vector, 9), static_cast<ZyanUSize>(7));
+
+    ZyanUSize index;
+    EXPECT_EQ(BinarySearchRecord(&vector, -5, &index), ZYAN_TRUE);
+    EXPECT_EQ(index, static_cast<ZyanUSize>(0));
+    EXPECT_EQ(BinarySearchRecord(&vector, 8, &index), ZYAN_FALSE);
+    EXPECT_EQ(index, static_cast<ZyanUSize>(6));
+    EXPECT_EQ(BinarySearchRecord(&vector, 10, &index), ZYAN_FALSE);
+    EXPECT_EQ(index, static_cast<ZyanUSize>(7));
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, EytzingerIndex)
+{
+    std::mt19937_64 rng(1337);
+    for (ZyanUSize size = 0; size < 300; size += (size < 40) ? 1 : 37)
+    {
+        std::vector<ZyanU64> values(size);
+        for (auto& value : values)
+        {
+            value = (rng() % (size + 1)) * 2;
+        }
+        std::sort(values.begin(), values.end());
+
+        ZyanVector vector;
+        ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), size,
+            reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+        if (size)
+        {
+            ASSERT_EQ(ZyanVectorPushBackRange(&vector, values.data(), size),
+                ZYAN_STATUS_SUCCESS);
+        }
+
+        ZyanEytzingerIndex eytzinger;
+        ASSERT_EQ(ZyanEytzingerIndexInit(&eytzinger, &vector), ZYAN_STATUS_SUCCESS);
+        ZyanUSize eytzinger_size;
+        ASSERT_EQ(ZyanEytzingerIndexGetSize(&eytzinger, &eytzinger_size), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(eytzinger_size, size);
+
+        for (ZyanU64 value = 0; value < size * 2 + 3; ++value)
+        {
+            const auto lower = std::lower_bound(values.begin(), values.end(), value);
+            const ZyanUSize expected_index = static_cast<ZyanUSize>(lower - values.begin());
+            const ZyanStatus expected_status = ((lower != values.end()) && (*lower == value)) ?
+                ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE;
+
+            ZyanUSize index;
+            ASSERT_EQ(ZyanVectorBinarySearch(&vector, &value, &index,
+                reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), expected_status);
+            ASSERT_EQ(index, expected_index);
+            ASSERT_EQ(ZyanEytzingerIndexSearch(&eytzinger, &value, &index,
+                reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), expected_status);
+            ASSERT_EQ(index, expected_index);
+            ASSERT_EQ(EytzingerSearchU64(&eytzinger, value, &index),
+                expected_status == ZYAN_STATUS_TRUE);
+            ASSERT_EQ(index, expected_index);
+
+            // Sub-range search
+            if (size > 2)
+            {
+                const auto sub_lower = std::lower_bound(values.begin() + 1, values.end() - 1,
+                    value);
+                ASSERT_EQ(ZyanVectorBinarySearchEx(&vector, &value, &index,
+                    reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64), 1, size - 2),
+                    ((sub_lower != values.end() - 1) && (*sub_lower == value)) ?
+                        ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+                ASSERT_EQ(index, static_cast<ZyanUSize>(sub_lower - values.begin()));
+            }
+        }
+
+        EXPECT_EQ(ZyanEytzingerIndexDestroy(&eytzinger), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(VectorTest, FindBytes)
+{
+    static const ZyanUSize element_sizes[] = { 1, 2, 3, 4, 8 };
+    static const ZyanUSize counts[] = { 0, 1, 63, 64, 65, 127, 128, 200, 1000 };
+
+    std::mt19937 rng(1337);
+    for (const auto element_size : element_sizes)
+    {
+        for (const auto count : counts)
+        {
+            // Elements either equal the needle or differ from it in exactly one byte, so that
+            // every byte lane of the SIMD comparison is exercised
+            std::vector<ZyanU8> needle(element_size);
+            for (auto& byte : needle)
+            {
+                byte = static_cast<ZyanU8>(rng());
+            }
+            std::vector<ZyanU8> data(element_size * count);
+            for (ZyanUSize i = 0; i < count; ++i)
+            {
+                std::copy(needle.begin(), needle.end(), data.begin() + i * element_size);
+                if (rng() % 8)
+                {
+                    data[i * element_size + rng() % element_size] ^= 1 << (rng() % 8);
+                }
+            }
+            const auto matches = [&](ZyanUSize i)
+            {
+                return std::equal(needle.begin(), needle.end(), data.begin() + i * element_size);
+            };
+
+            ZyanVector vector;
+            ASSERT_EQ(ZyanVectorInit(&vector, element_size, count,
+                reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+            if (count)
+            {
+                ASSERT_EQ(ZyanVectorPushBackRange(&vector, data.data(), count),
+                    ZYAN_STATUS_SUCCESS);
+            }
+
+            for (ZyanUSize j = 0; j < 16; ++j)
+            {
+                const ZyanUSize index = count ? rng() % count : 0;
+                const ZyanUSize length = rng() % (count - index + 1);
+                ZyanISize expected = -1;
+                for (ZyanUSize i = index; i < index + length; ++i)
+                {
+                    if (matches(i))
+                    {
+                        expected = static_cast<ZyanISize>(i);
+                        break;
+                    }
+                }
+                ZyanISize found_index;
+                ASSERT_EQ(ZyanVectorFindBytesEx(&vector, needle.data(), &found_index, index,
+                    length), (expected >= 0) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+                ASSERT_EQ(found_index, expected);
+            }
+
+            ZyanISize expected = -1;
+            ZyanBitset expected_matches;
+            ASSERT_EQ(ZyanBitsetInit(&expected_matches, count + 5), ZYAN_STATUS_SUCCESS);
+            for (ZyanUSize i = 0; i < count; ++i)
+            {
+                if (matches(i))
+                {
+                    ASSERT_EQ(ZyanBitsetSet(&expected_matches, i), ZYAN_STATUS_SUCCESS);
+                    expected = (expected < 0) ? static_cast<ZyanISize>(i) : expected;
+                }
+            }
+
+            ZyanISize found_index;
+            EXPECT_EQ(ZyanVectorFindBytes(&vector, needle.data(), &found_index),
+                (expected >= 0) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+            EXPECT_EQ(found_index, expected);
+
+            // Bits beyond the vector size must be cleared as well
+            ZyanBitset bitset;
+            ASSERT_EQ(ZyanBitsetInit(&bitset, count + 5), ZYAN_STATUS_SUCCESS);
+            ASSERT_EQ(ZyanBitsetSetAll(&bitset), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(ZyanVectorFindAllBytes(&vector, needle.data(), &bitset),
+                (expected >= 0) ? ZYAN_STATUS_TRUE : ZYAN_STATUS_FALSE);
+            for (ZyanUSize i = 0; i < count + 5; ++i)
+            {
+                ASSERT_EQ(ZyanBitsetTest(&bitset, i), ZyanBitsetTest(&expected_matches, i));
+            }
+            EXPECT_EQ(ZyanBitsetDestroy(&bitset), ZYAN_STATUS_SUCCESS);
+            EXPECT_EQ(ZyanBitsetDestroy(&expected_matches), ZYAN_STATUS_SUCCESS);
+
+            // Edge cases
+            if (count)
+            {
+                ZyanBitset small;
+                ASSERT_EQ(ZyanBitsetInit(&small, count - 1), ZYAN_STATUS_SUCCESS);
+                EXPECT_EQ(ZyanVectorFindAllBytes(&vector, needle.data(), &small),
+                    ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+                EXPECT_EQ(ZyanBitsetDestroy(&small), ZYAN_STATUS_SUCCESS);
+            }
+            EXPECT_EQ(ZyanVectorFindBytesEx(&vector, needle.data(), &found_index, 0, count + 1),
+                ZYAN_STATUS_OUT_OF_RANGE);
+            EXPECT_EQ(ZyanVectorFindBytes(&vector, ZYAN_NULL, &found_index),
+                ZYAN_STATUS_INVALID_ARGUMENT);
+
+            EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+        }
+    }
+}
+
+TEST(VectorTest, ParallelSort)
+{
+    static const ZyanUSize thread_counts[] = { 1, 2, 3, 7 };
+    static const ZyanUSize sizes[] = { 0, 1000, 32768, 100003, 250000 };
+
+    std::mt19937 rng(1337);
+    for (const auto thread_count : thread_counts)
+    {
+        ZyanThreadPool pool;
+        ASSERT_EQ(ZyanThreadPoolInit(&pool, thread_count), ZYAN_STATUS_SUCCESS);
+        ZyanUSize count;
+        ASSERT_EQ(ZyanThreadPoolGetThreadCount(&pool, &count), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(count, thread_count);
+
+        for (const auto size : sizes)
+        {
+            // Few distinct keys, so that many equal elements end up on both sides of every merge
+            ZyanVector vector;
+            ASSERT_EQ(ZyanVectorInit(&vector, sizeof(SortRecord), size,
+                reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+            for (ZyanUSize i = 0; i < size; ++i)
+            {
+                const SortRecord record = { static_cast<ZyanU32>(i),
+                    static_cast<ZyanI32>(rng() % 1000) - 500 };
+                ASSERT_EQ(ZyanVectorPushBack(&vector, &record), ZYAN_STATUS_SUCCESS);
+            }
+
+            ASSERT_EQ(ZyanVectorParallelSort(&vector, &pool,
+                reinterpret_cast<ZyanComparison>(&CompareSortRecord)), ZYAN_STATUS_SUCCESS);
+
+            std::vector<ZyanU32> payloads(size);
+            for (ZyanUSize i = 0; i < size; ++i)
+            {
+                const auto* record = static_cast<const SortRecord*>(ZyanVectorGet(&vector, i));
+                if (i > 0)
+                {
+                    const auto* previous =
+                        static_cast<const SortRecord*>(ZyanVectorGet(&vector, i - 1));
+                    ASSERT_LE(previous->key, record->key);
+                }
+                payloads[i] = record->payload;
+            }
+            std::sort(payloads.begin(), payloads.end());
+            for (ZyanUSize i = 0; i < size; ++i)
+            {
+                ASSERT_EQ(payloads[i], i);
+            }
+
+            EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+        }
+
+        EXPECT_EQ(ZyanThreadPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+    }
+
+    // Edge cases
+    ZyanThreadPool pool;
+    ASSERT_EQ(ZyanThreadPoolInit(&pool, 1), ZYAN_STATUS_SUCCESS);
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), 0,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanVectorParallelSort(&vector, nullptr,
+        reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanVectorParallelSort(&vector, &pool, nullptr), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanThreadPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorTest, ParallelForEach)
+{
+    static const ZyanUSize thread_counts[] = { 1, 4 };
+    static const ZyanUSize sizes[] = { 0, 1, 100, 8191, 100000 };
+    static const ZyanUSize grain_sizes[] = { 0, 1, 1000 };
+
+    for (const auto thread_count : thread_counts)
+    {
+        ZyanThreadPool pool;
+        ASSERT_EQ(ZyanThreadPoolInit(&pool, thread_count), ZYAN_STATUS_SUCCESS);
+
+        for (const auto size : sizes)
+        {
+            for (const auto grain_size : grain_sizes)
+            {
+                ZyanVector vector;
+                ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), size,
+                    reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+                const ZyanU64 zero = 0;
+                ASSERT_EQ(ZyanVectorResizeEx(&vector, size, &zero), ZYAN_STATUS_SUCCESS);
+
+                // Every element must be visited exactly once with the correct index
+                std::atomic<ZyanUSize> minimum(size);
+                ASSERT_EQ(ZyanVectorParallelForEach(&vector, &pool, grain_size, &AddIndexToRange,
+                    &minimum), ZYAN_STATUS_SUCCESS);
+                for (ZyanUSize i = 0; i < size; ++i)
+                {
+                    ASSERT_EQ(*static_cast<const ZyanU64*>(ZyanVectorGet(&vector, i)), i + 1);
+                }
+                const ZyanUSize grain = grain_size ? grain_size :
+                    ZYAN_VECTOR_DEFAULT_PARALLEL_GRAIN_SIZE;
+                EXPECT_GE(minimum.load(), ZYAN_MIN(grain, size));
+
+                const ZyanStatus expected = (size / grain >= 2) ?
+                    ZYAN_STATUS_INVALID_OPERATION : ZYAN_STATUS_SUCCESS;
+                EXPECT_EQ(ZyanVectorParallelForEach(&vector, &pool, grain_size, &FailRange,
+                    nullptr), expected);
+
+                EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+            }
+        }
+
+        EXPECT_EQ(ZyanThreadPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+    }
+}
+
 TEST_P(VectorTestFilled, ElementAccess)
 {
     static const ZyanU64 element_in = 1337;
@@ -378,6 +1267,74 @@ TEST_P(VectorTestFilled, Insert)
     }
 }
 
+TEST_P(VectorTestFilled, Append)
+{
+    static const ZyanU64 elements[4] =
+    {
+        1337, 1338, 1339, 1340
+    };
+    const ZyanUSize count = ZYAN_ARRAY_LENGTH(elements);
+
+    EXPECT_EQ(ZyanVectorPushBackRange(&m_vector, nullptr, count), ZYAN_STATUS_INVALID_ARGUMENT);
+    EXPECT_EQ(ZyanVectorPushBackRange(&m_vector, &elements, 0), ZYAN_STATUS_INVALID_ARGUMENT);
+
+    if (m_has_fixed_capacity)
+    {
+        void* uninitialized;
+        EXPECT_EQ(ZyanVectorPushBackRange(&m_vector, &elements, count),
+            ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+        EXPECT_EQ(ZyanVectorAppendUninitialized(&m_vector, 1, &uninitialized),
+            ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+        EXPECT_EQ(ZyanVectorAppendVector(&m_vector, &m_vector),
+            ZYAN_STATUS_INSUFFICIENT_BUFFER_SIZE);
+        EXPECT_EQ(m_vector.size, m_vector.capacity);
+        EXPECT_EQ(ZyanVectorResize(&m_vector, m_vector.capacity / 2 - count * 2),
+            ZYAN_STATUS_SUCCESS);
+    }
+
+    const ZyanUSize size = m_vector.size;
+
+    EXPECT_EQ(ZyanVectorPushBackRange(&m_vector, &elements, count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(m_vector.size, size + count);
+
+    ZyanU64* uninitialized;
+    EXPECT_EQ(ZyanVectorAppendUninitialized(&m_vector, count,
+        reinterpret_cast<void**>(&uninitialized)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(uninitialized, ZyanVectorGet(&m_vector, size + count));
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        uninitialized[i] = elements[count - i - 1];
+    }
+
+    // Append the vector to itself
+    EXPECT_EQ(ZyanVectorAppendVector(&m_vector, &m_vector), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(m_vector.size, (size + count * 2) * 2);
+
+    for (ZyanUSize i = 0; i < m_vector.size; ++i)
+    {
+        const ZyanUSize j = i % (size + count * 2);
+        const ZyanU64 element_out = ZYAN_VECTOR_GET(ZyanU64, &m_vector, i);
+
+        if (j < size)
+        {
+            EXPECT_EQ(element_out, j);
+        } else
+        if (j < size + count)
+        {
+            EXPECT_EQ(element_out, elements[j - size]);
+        } else
+        {
+            EXPECT_EQ(element_out, elements[count - (j - size - count) - 1]);
+        }
+    }
+
+    ZyanU32 buffer[1];
+    ZyanVector other;
+    ASSERT_EQ(ZyanVectorInitCustomBuffer(&other, sizeof(ZyanU32), buffer, 1,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(ZyanVectorAppendVector(&m_vector, &other), ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
 TEST_P(VectorTestFilled, Delete)
 {
     EXPECT_EQ(ZyanVectorDeleteRange(&m_vector, m_vector.size, 1), ZYAN_STATUS_OUT_OF_RANGE);
@@ -407,6 +1364,102 @@ TEST_P(VectorTestFilled, Delete)
     }
 }
 
+TEST_P(VectorTestFilled, DeleteSwapBack)
+{
+    EXPECT_EQ(ZyanVectorDeleteSwapBack(&m_vector, m_vector.size), ZYAN_STATUS_OUT_OF_RANGE);
+
+    const ZyanUSize size = m_vector.size;
+    EXPECT_EQ(ZyanVectorDeleteSwapBack(&m_vector, 10), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(m_vector.size, size - 1);
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, 10), size - 1);
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, 9), 9);
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, 11), 11);
+
+    // Deleting the last element does not move anything
+    EXPECT_EQ(ZyanVectorDeleteSwapBack(&m_vector, m_vector.size - 1), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(m_vector.size, size - 2);
+    EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, m_vector.size - 1), size - 3);
+
+    while (m_vector.size)
+    {
+        EXPECT_EQ(ZyanVectorDeleteSwapBack(&m_vector, 0), ZYAN_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(ZyanVectorDeleteSwapBack(&m_vector, 0), ZYAN_STATUS_OUT_OF_RANGE);
+}
+
+TEST_P(VectorTestFilled, RemoveIf)
+{
+    const ZyanUSize size = m_vector.size;
+
+    ZyanU64 divisor = 3;
+    ZyanUSize count;
+    EXPECT_EQ(ZyanVectorRemoveIf(&m_vector, &IsDivisibleU64, &divisor, &count),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, (size + 2) / 3);
+    EXPECT_EQ(m_vector.size, size - count);
+
+    // The remaining elements keep their order
+    ZyanU64 expected = 1;
+    for (ZyanUSize i = 0; i < m_vector.size; ++i, ++expected)
+    {
+        if (!(expected % 3))
+        {
+            ++expected;
+        }
+        EXPECT_EQ(ZYAN_VECTOR_GET(ZyanU64, &m_vector, i), expected);
+    }
+
+    // Nothing matches anymore
+    EXPECT_EQ(ZyanVectorRemoveIf(&m_vector, &IsDivisibleU64, &divisor, &count),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, static_cast<ZyanUSize>(0));
+
+    divisor = 1;
+    EXPECT_EQ(ZyanVectorRemoveIf(&m_vector, &IsDivisibleU64, &divisor, nullptr),
+        ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(m_vector.size, static_cast<ZyanUSize>(0));
+
+    EXPECT_EQ(ZyanVectorRemoveIf(&m_vector, nullptr, &divisor, nullptr),
+        ZYAN_STATUS_INVALID_ARGUMENT);
+}
+
+TEST(VectorTest, RemoveIfCallsPredicateOnce)
+{
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), 0, nullptr), ZYAN_STATUS_SUCCESS);
+    for (ZyanU64 i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(ZyanVectorPushBack(&vector, &i), ZYAN_STATUS_SUCCESS);
+    }
+
+    // The first element already matches, which used to be tested twice
+    std::vector<ZyanUSize> calls(100);
+    ZyanUSize count;
+    ASSERT_EQ(ZyanVectorRemoveIf(&vector, &CountCallsU64, &calls, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, static_cast<ZyanUSize>(34));
+    EXPECT_EQ(vector.size, static_cast<ZyanUSize>(66));
+    for (ZyanUSize i = 0; i < calls.size(); ++i)
+    {
+        EXPECT_EQ(calls[i], static_cast<ZyanUSize>(1)) << "element " << i;
+    }
+
+    // A single match after the kept elements
+    const ZyanU64 value = 99;
+    ASSERT_EQ(ZyanVectorPushBack(&vector, &value), ZYAN_STATUS_SUCCESS);
+    std::fill(calls.begin(), calls.end(), 0);
+    ASSERT_EQ(ZyanVectorRemoveIf(&vector, &CountCallsU64, &calls, &count), ZYAN_STATUS_SUCCESS);
+    EXPECT_EQ(count, static_cast<ZyanUSize>(1));
+    EXPECT_EQ(vector.size, static_cast<ZyanUSize>(66));
+    for (ZyanUSize i = 0; i < vector.size; ++i)
+    {
+        EXPECT_EQ(calls[static_cast<std::size_t>(ZYAN_VECTOR_GET(ZyanU64, &vector, i))],
+            static_cast<ZyanUSize>(1));
+    }
+    EXPECT_EQ(calls[99], static_cast<ZyanUSize>(1));
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
 TEST_P(VectorTestFilled, Find)
 {
     ZyanISize index;
@@ -523,6 +1576,341 @@ INSTANTIATE_TEST_SUITE_P(Param, VectorTestFilled, ::testing::Values(false, true)
 
 /* ---------------------------------------------------------------------------------------------- */
 
+/* ============================================================================================== */
+/* Benchmarks                                                                                     */
+/* ============================================================================================== */
+
+TEST(VectorBenchmark, DISABLED_Sort)
+{
+    static const ZyanUSize count = 10000000;
+
+    std::mt19937_64 rng(1337);
+    std::vector<ZyanU64> values(count);
+    for (auto& value : values)
+    {
+        value = rng();
+    }
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), count,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+
+    ASSERT_EQ(ZyanVectorPushBackRange(&vector, values.data(), count), ZYAN_STATUS_SUCCESS);
+    Benchmark("qsort", [&]()
+    {
+        std::qsort(vector.data, vector.size, vector.element_size, &CompareU64);
+    });
+
+    ASSERT_EQ(ZyanVectorClear(&vector), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorPushBackRange(&vector, values.data(), count), ZYAN_STATUS_SUCCESS);
+    Benchmark("ZyanVectorSort", [&]()
+    {
+        ASSERT_EQ(ZyanVectorSort(&vector,
+            reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64)), ZYAN_STATUS_SUCCESS);
+    });
+
+    ASSERT_EQ(ZyanVectorClear(&vector), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorPushBackRange(&vector, values.data(), count), ZYAN_STATUS_SUCCESS);
+    Benchmark("ZyanVectorSortByKey", [&]()
+    {
+        ASSERT_EQ(ZyanVectorSortByKey(&vector, 0, sizeof(ZyanU64), ZYAN_FALSE),
+            ZYAN_STATUS_SUCCESS);
+    });
+
+    std::sort(values.begin(), values.end());
+    for (ZyanUSize i = 0; i < count; ++i)
+    {
+        ASSERT_EQ(ZYAN_VECTOR_GET(ZyanU64, &vector, i), values[i]);
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorBenchmark, DISABLED_BinarySearch)
+{
+    static const ZyanUSize count = 1000000;
+    static const ZyanUSize lookups = 10000000;
+
+    std::mt19937_64 rng(1337);
+    std::vector<ZyanU64> values(count);
+    for (auto& value : values)
+    {
+        value = rng() % (count * 4);
+    }
+    std::sort(values.begin(), values.end());
+    std::vector<ZyanU64> keys(lookups);
+    for (auto& key : keys)
+    {
+        key = rng() % (count * 4);
+    }
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), count,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorPushBackRange(&vector, values.data(), count), ZYAN_STATUS_SUCCESS);
+
+    ZyanUSize checksum_generic = 0;
+    Benchmark("ZyanVectorBinarySearch", [&]()
+    {
+        for (const auto& key : keys)
+        {
+            ZyanUSize index;
+            ZyanVectorBinarySearch(&vector, &key, &index,
+                reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64));
+            checksum_generic += index;
+        }
+    });
+
+    ZyanUSize checksum_typed = 0;
+    Benchmark("ZYAN_DECLARE_VECTOR_BINARY_SEARCH", [&]()
+    {
+        for (const auto& key : keys)
+        {
+            ZyanUSize index;
+            BinarySearchU64(&vector, key, &index);
+            checksum_typed += index;
+        }
+    });
+    EXPECT_EQ(checksum_generic, checksum_typed);
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
+TEST(VectorBenchmark, DISABLED_RemoveIf)
+{
+    static const ZyanUSize counts[] = { 100000, 1000000 };
+
+    for (const auto count : counts)
+    {
+        ZyanVector vector;
+        ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), count,
+            reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+        char name[64];
+
+        // The element-wise delete is quadratic, so it is only measured for the smaller vector
+        ZyanU64 divisor = 2;
+        if (count <= 100000)
+        {
+            for (ZyanU64 i = 0; i < count; ++i)
+            {
+                ZyanVectorPushBack(&vector, &i);
+            }
+            snprintf(name, sizeof(name), "ZyanVectorDelete (%zu)", count);
+            Benchmark(name, [&]()
+            {
+                for (ZyanUSize i = 0; i < vector.size;)
+                {
+                    if (IsDivisibleU64(ZyanVectorGet(&vector, i), &divisor))
+                    {
+                        ZyanVectorDelete(&vector, i);
+                        continue;
+                    }
+                    ++i;
+                }
+            });
+            EXPECT_EQ(vector.size, count / 2);
+            ZyanVectorClear(&vector);
+        }
+
+        for (ZyanU64 i = 0; i < count; ++i)
+        {
+            ZyanVectorPushBack(&vector, &i);
+        }
+        snprintf(name, sizeof(name), "ZyanVectorRemoveIf (%zu)", count);
+        Benchmark(name, [&]()
+        {
+            ZyanVectorRemoveIf(&vector, &IsDivisibleU64, &divisor, nullptr);
+        });
+        EXPECT_EQ(vector.size, count / 2);
+
+        EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(VectorBenchmark, DISABLED_FindBytes)
+{
+    static const ZyanUSize counts[] = { 1000, 100000, 1000000 };
+    static const ZyanUSize total = 100000000;
+
+    for (const auto count : counts)
+    {
+        std::vector<ZyanU32> values(count);
+        for (ZyanUSize i = 0; i < count; ++i)
+        {
+            values[i] = static_cast<ZyanU32>(i);
+        }
+        ZyanVector vector;
+        ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU32), count,
+            reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanVectorPushBackRange(&vector, values.data(), count), ZYAN_STATUS_SUCCESS);
+
+        // Searches for the last element, so that the whole vector is scanned
+        const ZyanU32 key = static_cast<ZyanU32>(count - 1);
+        const ZyanUSize iterations = total / count;
+        char name[64];
+
+        ZyanISize checksum_generic = 0;
+        snprintf(name, sizeof(name), "ZyanVectorFind (%zu)", count);
+        Benchmark(name, [&]()
+        {
+            for (ZyanUSize i = 0; i < iterations; ++i)
+            {
+                ZyanISize index;
+                ZyanVectorFind(&vector, &key, &index,
+                    reinterpret_cast<ZyanEqualityComparison>(&ZyanEqualsNumeric32));
+                checksum_generic += index;
+            }
+        });
+
+        ZyanISize checksum_bytes = 0;
+        snprintf(name, sizeof(name), "ZyanVectorFindBytes (%zu)", count);
+        Benchmark(name, [&]()
+        {
+            for (ZyanUSize i = 0; i < iterations; ++i)
+            {
+                ZyanISize index;
+                ZyanVectorFindBytes(&vector, &key, &index);
+                checksum_bytes += index;
+            }
+        });
+        EXPECT_EQ(checksum_generic, checksum_bytes);
+
+        EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(VectorBenchmark, DISABLED_SearchLayouts)
+{
+    static const ZyanUSize lookups = 4000000;
+
+    // From L1 sized to DRAM sized vectors of `ZyanU64` values
+    for (ZyanUSize count : { 4096, 32768, 1048576, 16777216 })
+    {
+        std::printf("%zu elements (%zu KiB)\n", static_cast<size_t>(count),
+            static_cast<size_t>(count * sizeof(ZyanU64) / 1024));
+
+        std::mt19937_64 rng(1337);
+        std::vector<ZyanU64> values(count);
+        for (auto& value : values)
+        {
+            value = rng() % (count * 4);
+        }
+        std::sort(values.begin(), values.end());
+        std::vector<ZyanU64> keys(lookups);
+        for (auto& key : keys)
+        {
+            key = rng() % (count * 4);
+        }
+
+        ZyanVector vector;
+        ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), count,
+            reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+        ASSERT_EQ(ZyanVectorPushBackRange(&vector, values.data(), count), ZYAN_STATUS_SUCCESS);
+        ZyanEytzingerIndex eytzinger;
+        ASSERT_EQ(ZyanEytzingerIndexInit(&eytzinger, &vector), ZYAN_STATUS_SUCCESS);
+
+        ZyanComparison const comparison =
+            reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64);
+        ZyanUSize checksum_generic = 0;
+        Benchmark("  ZyanVectorBinarySearch", [&]()
+        {
+            for (const auto& key : keys)
+            {
+                ZyanUSize index;
+                ZyanVectorBinarySearch(&vector, &key, &index, comparison);
+                checksum_generic += index;
+            }
+        });
+
+        ZyanUSize checksum_eytzinger = 0;
+        Benchmark("  ZyanEytzingerIndexSearch", [&]()
+        {
+            for (const auto& key : keys)
+            {
+                ZyanUSize index;
+                ZyanEytzingerIndexSearch(&eytzinger, &key, &index, comparison);
+                checksum_eytzinger += index;
+            }
+        });
+
+        ZyanUSize checksum_typed = 0;
+        Benchmark("  ZYAN_DECLARE_VECTOR_BINARY_SEARCH", [&]()
+        {
+            for (const auto& key : keys)
+            {
+                ZyanUSize index;
+                BinarySearchU64(&vector, key, &index);
+                checksum_typed += index;
+            }
+        });
+
+        ZyanUSize checksum_typed_eytzinger = 0;
+        Benchmark("  ZYAN_DECLARE_EYTZINGER_SEARCH", [&]()
+        {
+            for (const auto& key : keys)
+            {
+                ZyanUSize index;
+                EytzingerSearchU64(&eytzinger, key, &index);
+                checksum_typed_eytzinger += index;
+            }
+        });
+
+        EXPECT_EQ(checksum_generic, checksum_eytzinger);
+        EXPECT_EQ(checksum_generic, checksum_typed_eytzinger);
+        EXPECT_EQ(checksum_generic, checksum_typed);
+
+        EXPECT_EQ(ZyanEytzingerIndexDestroy(&eytzinger), ZYAN_STATUS_SUCCESS);
+        EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+    }
+}
+
+TEST(VectorBenchmark, DISABLED_ParallelSort)
+{
+    static const ZyanUSize count = 10000000;
+    static const ZyanUSize thread_counts[] = { 1, 2, 4, 8, 16, 32 };
+
+    std::mt19937_64 rng(1337);
+    std::vector<ZyanU64> values(count);
+    for (auto& value : values)
+    {
+        value = rng();
+    }
+    std::vector<ZyanU64> expected(values);
+    std::sort(expected.begin(), expected.end());
+
+    ZyanVector vector;
+    ASSERT_EQ(ZyanVectorInit(&vector, sizeof(ZyanU64), count,
+        reinterpret_cast<ZyanMemberProcedure>(ZYAN_NULL)), ZYAN_STATUS_SUCCESS);
+    ASSERT_EQ(ZyanVectorPushBackRange(&vector, values.data(), count), ZYAN_STATUS_SUCCESS);
+
+    Benchmark("ZyanVectorSort", [&]()
+    {
+        ZyanVectorSort(&vector, reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64));
+    });
+
+    // The calling thread participates, so `n` threads correspond to `n - 1` worker threads
+    for (const auto thread_count : thread_counts)
+    {
+        ZyanThreadPool pool;
+        ASSERT_EQ(ZyanThreadPoolInit(&pool, thread_count - 1), ZYAN_STATUS_SUCCESS);
+        ZyanVectorClear(&vector);
+        ASSERT_EQ(ZyanVectorPushBackRange(&vector, values.data(), count), ZYAN_STATUS_SUCCESS);
+
+        char name[64];
+        snprintf(name, sizeof(name), "ZyanVectorParallelSort (%zu threads)", thread_count);
+        Benchmark(name, [&]()
+        {
+            ZyanVectorParallelSort(&vector, &pool,
+                reinterpret_cast<ZyanComparison>(&ZyanCompareNumeric64));
+        });
+        EXPECT_TRUE(!std::memcmp(vector.data, expected.data(), count * sizeof(ZyanU64)));
+
+        EXPECT_EQ(ZyanThreadPoolDestroy(&pool), ZYAN_STATUS_SUCCESS);
+    }
+
+    EXPECT_EQ(ZyanVectorDestroy(&vector), ZYAN_STATUS_SUCCESS);
+}
+
 /* ============================================================================================== */
 /* Entry point                                                                                    */
 /* ============================================================================================== */